@@ -16,6 +16,9 @@ class HuntTestRunnerGenerator
     require_relative 'type_sanitizer'
   end
 
+  # options which only steer batch mode and do not change the generated runners
+  BATCH_OPTIONS = %i[batch manifest jobs output_dir].freeze
+
   def self.default_options
     {
       includes: [],
@@ -46,6 +49,26 @@ class HuntTestRunnerGenerator
     options
   end
 
+  def self.default_runner_name(input_file, output_dir = nil)
+    runner_name = input_file.gsub('.c', '_Runner.c')
+    output_dir.nil? || output_dir.empty? ? runner_name : File.join(output_dir, File.basename(runner_name))
+  end
+
+  # each line of a manifest names a test file and, optionally, its runner
+  def self.read_manifest(manifest_file, output_dir = nil)
+    File.readlines(manifest_file).map(&:strip).reject { |line| line.empty? || line.start_with?('#') }.map do |line|
+      input_file, output_file = line.split(/\s+/, 2)
+      [input_file, output_file || default_runner_name(input_file, output_dir)]
+    end
+  end
+
+  def self.processor_count
+    require 'etc'
+    Etc.respond_to?(:nprocessors) ? Etc.nprocessors : 1
+  rescue LoadError
+    1
+  end
+
   def run(input_file, output_file, options = nil)
     @options.merge!(options) unless options.nil?
 
@@ -70,24 +93,116 @@ class HuntTestRunnerGenerator
     all_files_used.uniq
   end
 
+  # Generate runners for many [input_file, output_file] pairs in one process.
+  # Runners whose test file and options are unchanged since the last batch
+  # are skipped, and runners whose content would not change are not rewritten,
+  # so their timestamps only move when a rebuild is really needed.
+  def run_batch(jobs, options = nil)
+    @options.merge!(options) unless options.nil?
+    worker_count = (@options[:jobs] || HuntTestRunnerGenerator.processor_count).to_i
+    results = run_in_workers(jobs, [[worker_count, jobs.size].min, 1].max)
+    {
+      generated: results.select { |_file, status| status == :generated }.map(&:first),
+      skipped: results.select { |_file, status| status == :skipped }.map(&:first)
+    }
+  end
+
+  # Generate a runner for every test file, each with its own main_<file>()
+  # entry point, plus aggregate_file whose main() calls all of them within a
+  # single HuntAggregateBegin()/HuntAggregateEnd() summary. Linking these
+  # together yields one test binary for the whole project.
+  def run_aggregate(jobs, aggregate_file, options = nil)
+    @options.merge!(options) unless options.nil?
+    @options[:main_name] = :auto
+    @options[:aggregate] = true
+    results = run_batch(jobs)
+    write_if_changed(aggregate_file) do |output|
+      create_aggregate_main(output, jobs.map(&:first))
+    end
+    results
+  end
+
+  def run_batch_job(input_file, output_file)
+    stamp = batch_stamp(input_file)
+    stamp_file = output_file + '.stamp'
+    return :skipped if File.exist?(output_file) && File.exist?(stamp_file) && File.read(stamp_file) == stamp
+
+    run(input_file, output_file)
+    File.open(stamp_file, 'w') { |f| f << stamp }
+    :generated
+  end
+
   def generate(input_file, output_file, tests, used_mocks, testfile_includes)
-    File.open(output_file, 'w') do |output|
+    write_if_changed(output_file) do |output|
       create_header(output, used_mocks, testfile_includes)
       create_externs(output, tests, used_mocks)
       create_mock_management(output, used_mocks)
       create_suite_setup(output)
       create_suite_teardown(output)
-      create_reset(output, used_mocks)
+      create_reset(output, input_file, used_mocks)
       create_main(output, input_file, tests, used_mocks)
     end
 
     return unless @options[:header_file] && !@options[:header_file].empty?
 
-    File.open(@options[:header_file], 'w') do |output|
+    write_if_changed(@options[:header_file]) do |output|
       create_h_file(output, @options[:header_file], tests, testfile_includes, used_mocks)
     end
   end
 
+  def write_if_changed(filename)
+    require 'stringio'
+    output = StringIO.new
+    yield output
+    return false if File.exist?(filename) && File.read(filename) == output.string
+
+    File.open(filename, 'w') { |f| f << output.string }
+    true
+  end
+
+  def batch_stamp(input_file)
+    require 'digest'
+    @options_digest ||= Digest::SHA256.hexdigest(File.read(__FILE__) +
+      @options.reject { |key, _value| BATCH_OPTIONS.include?(key) }.sort_by { |key, _value| key.to_s }.inspect)
+    "#{Digest::SHA256.hexdigest(input_file + "\n" + File.read(input_file))} #{@options_digest}\n"
+  end
+
+  # Windows and JRuby have no fork(), there the runners are generated in-process
+  def run_in_workers(jobs, worker_count)
+    if worker_count < 2 || !Process.respond_to?(:fork)
+      return jobs.map { |input_file, output_file| [output_file, run_batch_job(input_file, output_file)] }
+    end
+
+    slices = Array.new(worker_count) { [] }
+    jobs.each_with_index { |job, index| slices[index % worker_count] << job }
+    workers = slices.map do |slice|
+      reader, writer = IO.pipe
+      pid = fork do
+        reader.close
+        status = 0
+        begin
+          results = slice.map { |input_file, output_file| [output_file, run_batch_job(input_file, output_file)] }
+        rescue StandardError => e
+          results = "#{e.class}: #{e.message}"
+          status = 1
+        end
+        writer.write(Marshal.dump(results))
+        writer.close
+        exit!(status)
+      end
+      writer.close
+      [pid, reader]
+    end
+    workers.flat_map do |pid, reader|
+      results = Marshal.load(reader.read)
+      reader.close
+      Process.wait(pid)
+      raise "Runner generation failed: #{results}" unless $?.success?
+
+      results
+    end
+  end
+
   def find_tests(source)
     tests_and_line_numbers = []
 
@@ -111,18 +226,25 @@ class HuntTestRunnerGenerator
                            .map { |line| line.gsub(substring_unre, substring_unsubs) } # unhide the problematic characters previously removed
 
     lines.each_with_index do |line, _index|
+      # find tests driven by tables, combinations or benchmarks, which expand to a plain test function
+      if line =~ /^\s*(?:TEST_PARAMS|TEST_PARAMS_NAMED|TEST_COMBINATIONS|TEST_BENCHMARK\w*)\s*\(\s*((?:#{@options[:test_prefix]})\w*)\s*[,)]/m
+        tests_and_line_numbers << { test: Regexp.last_match(1), args: nil, call: 'void', params: nil, table: true, line_number: 0 }
+        next
+      end
+
       # find tests
-      next unless line =~ /^((?:\s*TEST_CASE\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]}).*)\s*\(\s*(.*)\s*\)/m
+      next unless line =~ /^((?:\s*(?:TEST_CASE|TEST_TIME_BUDGET)\s*\(.*?\)\s*)*)\s*void\s+((?:#{@options[:test_prefix]}).*)\s*\(\s*(.*)\s*\)/m
       arguments = Regexp.last_match(1)
       name = Regexp.last_match(2)
       call = Regexp.last_match(3)
       params = Regexp.last_match(4)
       args = nil
-      if @options[:use_param_tests] && !arguments.empty?
+      if @options[:use_param_tests] && arguments =~ /TEST_CASE/
         args = []
         arguments.scan(/\s*TEST_CASE\s*\((.*)\)\s*$/) { |a| args << a[0] }
       end
-      tests_and_line_numbers << { test: name, args: args, call: call, params: params, line_number: 0 }
+      budget = arguments[/TEST_TIME_BUDGET\s*\((.*?)\)\s*$/, 1]
+      tests_and_line_numbers << { test: name, args: args, call: call, params: params, budget: budget, line_number: 0 }
     end
     tests_and_line_numbers.uniq! { |v| v[:test] }
 
@@ -131,7 +253,8 @@ class HuntTestRunnerGenerator
     source_index = 0
     tests_and_line_numbers.size.times do |i|
       source_lines[source_index..-1].each_with_index do |line, index|
-        next unless line =~ /\s+#{tests_and_line_numbers[i][:test]}(?:\s|\()/
+        pattern = tests_and_line_numbers[i][:table] ? /TEST_(?:PARAMS\w*|COMBINATIONS|BENCHMARK\w*)\s*\(\s*#{tests_and_line_numbers[i][:test]}\s*[,)]/ : /\s+#{tests_and_line_numbers[i][:test]}(?:\s|\()/
+        next unless line =~ pattern
         source_index += index
         tests_and_line_numbers[i][:line_number] = source_index + 1
         break
@@ -297,33 +420,44 @@ class HuntTestRunnerGenerator
     output.puts('  Hunt.CurrentTestLineNumber = TestLineNum; \\')
     output.puts('  if (HuntTestMatches()) { \\') if @options[:cmdline_args]
     output.puts('  Hunt.NumberOfTests++; \\')
+    output.puts('  HUNT_TRACE_TEST_START(); \\')
+    output.puts('  HUNT_RUSAGE_START(); \\')
     output.puts('  HUNT_EXEC_TIME_START(); \\')
+    output.puts('  HUNT_PERF_COUNTERS_START(); \\')
     output.puts('  CMock_Init(); \\') unless used_mocks.empty?
     output.puts('  HUNT_CLR_DETAILS(); \\') unless used_mocks.empty?
     output.puts('  if (TEST_PROTECT()) \\')
     output.puts('  { \\')
     output.puts('    CEXCEPTION_T e; \\') if cexception
     output.puts('    Try { \\') if cexception
+    output.puts('      HUNT_PHASE_START(HUNT_PHASE_SETUP); \\')
     output.puts("      #{@options[:setup_name]}(); \\")
+    output.puts('      HUNT_PHASE_START(HUNT_PHASE_TEST); \\')
     output.puts("      TestFunc(#{va_args2}); \\")
     output.puts('    } Catch(e) { TEST_ASSERT_EQUAL_HEX32_MESSAGE(CEXCEPTION_NONE, e, "Unhandled Exception!"); } \\') if cexception
     output.puts('  } \\')
     output.puts('  if (TEST_PROTECT()) \\')
     output.puts('  { \\')
+    output.puts('    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \\')
     output.puts("    #{@options[:teardown_name]}(); \\")
+    output.puts('    HUNT_PHASE_START(HUNT_PHASE_VERIFY); \\') unless used_mocks.empty?
     output.puts('    CMock_Verify(); \\') unless used_mocks.empty?
     output.puts('  } \\')
+    output.puts('  HUNT_PHASE_STOP(); \\')
     output.puts('  CMock_Destroy(); \\') unless used_mocks.empty?
+    output.puts('  HUNT_PERF_COUNTERS_STOP(); \\')
     output.puts('  HUNT_EXEC_TIME_STOP(); \\')
+    output.puts('  HUNT_RUSAGE_STOP(); \\')
     output.puts('  HuntConcludeTest(); \\')
     output.puts('  } \\') if @options[:cmdline_args]
     output.puts("}\n")
   end
 
-  def create_reset(output, used_mocks)
+  def create_reset(output, filename, used_mocks)
+    reset_name = @options[:aggregate] ? "#{@options[:test_reset_name]}_#{file_identifier(filename)}" : @options[:test_reset_name]
     output.puts("\n/*=======Test Reset Option=====*/")
-    output.puts("void #{@options[:test_reset_name]}(void);")
-    output.puts("void #{@options[:test_reset_name]}(void)")
+    output.puts("void #{reset_name}(void);")
+    output.puts("void #{reset_name}(void)")
     output.puts('{')
     output.puts('  CMock_Verify();') unless used_mocks.empty?
     output.puts('  CMock_Destroy();') unless used_mocks.empty?
@@ -333,9 +467,17 @@ class HuntTestRunnerGenerator
     output.puts('}')
   end
 
+  def file_identifier(filename)
+    TypeSanitizer.sanitize_c_identifier(File.basename(filename, '.c'))
+  end
+
+  def main_name_for(filename)
+    @options[:main_name].to_sym == :auto ? "main_#{file_identifier(filename)}" : @options[:main_name].to_s
+  end
+
   def create_main(output, filename, tests, used_mocks)
     output.puts("\n\n/*=======MAIN=====*/")
-    main_name = @options[:main_name].to_sym == :auto ? "main_#{filename.gsub('.c', '')}" : (@options[:main_name]).to_s
+    main_name = main_name_for(filename)
     if @options[:cmdline_args]
       if main_name != 'main'
         output.puts("#{@options[:main_export_decl]} int #{main_name}(int argc, char** argv);")
@@ -375,18 +517,27 @@ class HuntTestRunnerGenerator
       output.puts("int #{main_name}(void)")
       output.puts('{')
     end
+    output.puts('  HUNT_TRACE_BEGIN("suiteSetUp", "suite");')
     output.puts('  suite_setup();')
+    output.puts('  HUNT_TRACE_END();')
     output.puts("  HuntBegin(\"#{filename.gsub(/\\/, '\\\\\\')}\");")
     if @options[:use_param_tests]
       tests.each do |test|
         if test[:args].nil? || test[:args].empty?
+          create_time_budget(output, test)
           output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]}, RUN_TEST_NO_ARGS);")
         else
-          test[:args].each { |args| output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]}, #{args});") }
+          test[:args].each do |args|
+            create_time_budget(output, test)
+            output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]}, #{args});")
+          end
         end
       end
     else
-      tests.each { |test| output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]});") }
+      tests.each do |test|
+        create_time_budget(output, test)
+        output.puts("  RUN_TEST(#{test[:test]}, #{test[:line_number]});")
+      end
     end
     output.puts
     output.puts('  CMock_Guts_MemFreeFinal();') unless used_mocks.empty?
@@ -394,6 +545,41 @@ class HuntTestRunnerGenerator
     output.puts('}')
   end
 
+  # a TEST_TIME_BUDGET holds for the next test to run, which checks it when it concludes
+  def create_time_budget(output, test)
+    output.puts("  HUNT_SET_TIME_BUDGET(#{test[:budget]});") if test[:budget]
+  end
+
+  def create_aggregate_main(output, filenames)
+    main_args = @options[:cmdline_args] ? '(argc, argv)' : '()'
+    output.puts('/* AUTOGENERATED FILE. DO NOT EDIT. */')
+    output.puts('#define HUNT_INCLUDE_SETUP_STUBS')
+    output.puts("#include \"#{@options[:framework]}.h\"")
+    output.puts("\n/*=======Test File Runners=====*/")
+    filenames.each do |filename|
+      output.puts("extern int #{main_name_for(filename)}(#{@options[:cmdline_args] ? 'int argc, char** argv' : 'void'});")
+    end
+    output.puts("\n\n/*=======MAIN=====*/")
+    output.puts("int main(#{@options[:cmdline_args] ? 'int argc, char** argv' : 'void'})")
+    output.puts('{')
+    output.puts('  int num_failures = 0;')
+    if @options[:cmdline_args]
+      output.puts('  int parse_status = HuntParseOptions(argc, argv);')
+      output.puts('  if (parse_status > 0)')
+      output.puts('    return parse_status;')
+      output.puts('  if (parse_status < 0)')
+      output.puts('  {')
+      filenames.each { |filename| output.puts("    (void)#{main_name_for(filename)}(argc, argv);") }
+      output.puts('    return 0;')
+      output.puts('  }')
+    end
+    output.puts('  HuntAggregateBegin();')
+    filenames.each { |filename| output.puts("  num_failures += #{main_name_for(filename)}#{main_args};") }
+    output.puts('  (void)HuntAggregateEnd();')
+    output.puts('  return num_failures;')
+    output.puts('}')
+  end
+
   def create_h_file(output, filename, tests, testfile_includes, used_mocks)
     filename = File.basename(filename).gsub(/[-\/\\\.\,\s]/, '_').upcase
     output.puts('/* AUTOGENERATED FILE. DO NOT EDIT. */')
@@ -421,6 +607,7 @@ end
 
 if $0 == __FILE__
   options = { includes: [] }
+  batch = false
 
   # parse out all the options first (these will all be removed as we go)
   ARGV.reject! do |arg|
@@ -428,6 +615,9 @@ if $0 == __FILE__
     when '-cexception'
       options[:plugins] = [:cexception]
       true
+    when '-batch'
+      batch = true
+      true
     when /\.*\.ya?ml/
       options = HuntTestRunnerGenerator.grab_config(arg)
       true
@@ -441,9 +631,22 @@ if $0 == __FILE__
     end
   end
 
+  if batch || options[:manifest] || options[:aggregate]
+    jobs = ARGV.map { |input_file| [input_file, HuntTestRunnerGenerator.default_runner_name(input_file, options[:output_dir])] }
+    jobs += HuntTestRunnerGenerator.read_manifest(options[:manifest], options[:output_dir]) if options[:manifest]
+    if options[:aggregate]
+      aggregate_file = options.delete(:aggregate)
+      HuntTestRunnerGenerator.new(options).run_aggregate(jobs, aggregate_file)
+    else
+      HuntTestRunnerGenerator.new(options).run_batch(jobs)
+    end
+    exit 0
+  end
+
   # make sure there is at least one parameter left (the input file)
   unless ARGV[0]
     puts ["\nusage: ruby #{__FILE__} (files) (options) input_test_file (output)",
+          "       ruby #{__FILE__} (files) (options) -batch input_test_file...",
           "\n  input_test_file         - this is the C file you want to create a runner for",
           '  output                  - this is the name of the runner file to generate',
           '                            defaults to (input_test_file)_Runner',
@@ -461,12 +664,18 @@ if $0 == __FILE__
           '    --suite_setup=""      - code to execute for setup of entire suite',
           '    --suite_teardown=""   - code to execute for teardown of entire suite',
           '    --use_param_tests=1   - enable parameterized tests (disabled by default)',
-          '    --header_file=""      - path/name of test header file to generate too'].join("\n")
+          '    --header_file=""      - path/name of test header file to generate too',
+          '  batch options:',
+          '    -batch                - generate a runner for every input_test_file listed',
+          '    --manifest=""         - file listing one input_test_file (and optional output) per line',
+          '    --output_dir=""       - directory for batch runners (defaults to next to each test)',
+          '    --jobs=N              - number of worker processes (defaults to number of cores)',
+          '    --aggregate=""        - also write this runner, whose main() runs all the others'].join("\n")
     exit 1
   end
 
   # create the default test runner name if not specified
-  ARGV[1] = ARGV[0].gsub('.c', '_Runner.c') unless ARGV[1]
+  ARGV[1] = HuntTestRunnerGenerator.default_runner_name(ARGV[0]) unless ARGV[1]
 
   HuntTestRunnerGenerator.new(options).run(ARGV[0], ARGV[1])
 end
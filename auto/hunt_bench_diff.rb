@@ -0,0 +1,117 @@
+# ==========================================
+#   Hunt Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+
+# !/usr/bin/ruby
+#
+# hunt_bench_diff.rb
+#
+# Compares two benchmark baseline files, as written by a test runner given
+# --bench-save=path, and prints a table of the changes in median time per
+# iteration. Like the runner's --bench-compare, a change only counts when a
+# one-sided Mann-Whitney U test finds it significant and it exceeds the
+# threshold.
+
+class HuntBenchDiff
+  ALPHA = 0.05
+
+  attr_reader :report, :slower, :faster
+
+  def initialize(threshold = 5.0)
+    @threshold = threshold
+    @report = ''
+    @slower = []
+    @faster = []
+  end
+
+  # Reads "file:test t1 t2 ..." lines into a hash of test => samples
+  def self.load(filename)
+    File.readlines(filename).each_with_object({}) do |line, benchmarks|
+      name, *samples = line.split
+      next if name.nil? || name.start_with?('#')
+
+      benchmarks[name] = samples.map(&:to_f)
+    end
+  end
+
+  def self.median(samples)
+    sorted = samples.sort
+    (sorted[(sorted.size - 1) / 2] + sorted[sorted.size / 2]) / 2.0
+  end
+
+  # Probability of a U statistic at least as large as that of current over
+  # baseline, with ties counting as one half, when neither is slower
+  def self.p_slower(current, baseline)
+    n = current.size
+    m = baseline.size
+    u2 = current.product(baseline).sum { |c, b| c > b ? 2 : (c == b ? 1 : 0) }
+    most = (n * m) - ((u2 + 1) / 2)
+
+    # coefficients of the Gaussian binomial (n+m over n) count the ways to get each U
+    counts = [1] + [0] * ((n * m) + n)
+    (1..n).each do |i|
+      (counts.size - 1).downto(m + i) { |j| counts[j] -= counts[j - (m + i)] }
+      (i...counts.size).each { |j| counts[j] += counts[j - i] }
+    end
+    counts[0..most].sum.to_f / counts[0..(n * m)].sum
+  end
+
+  def run(baseline_file, current_file)
+    baseline = HuntBenchDiff.load(baseline_file)
+    current = HuntBenchDiff.load(current_file)
+    width = [(baseline.keys | current.keys).map(&:length).max || 0, 'Benchmark'.length].max
+
+    @report = format("%-#{width}s %14s %14s %9s\n", 'Benchmark', 'Baseline', 'Current', 'Change')
+    (baseline.keys | current.keys).each do |name|
+      @report += diff_line(name, baseline[name], current[name], width)
+    end
+    @report
+  end
+
+  private
+
+  def diff_line(name, before, after, width)
+    return format("%-#{width}s %14s %14s\n", name, '-', "#{format('%.2f', HuntBenchDiff.median(after))} ns") if before.nil? || before.empty?
+    return format("%-#{width}s %14s %14s\n", name, "#{format('%.2f', HuntBenchDiff.median(before))} ns", '-') if after.nil? || after.empty?
+
+    old_median = HuntBenchDiff.median(before)
+    new_median = HuntBenchDiff.median(after)
+    change = old_median > 0 ? ((new_median - old_median) * 100.0 / old_median) : 0.0
+    verdict = ''
+    if (change > @threshold) && (HuntBenchDiff.p_slower(after, before) < ALPHA)
+      verdict = 'SLOWER'
+      @slower << name
+    elsif (-change > @threshold) && (HuntBenchDiff.p_slower(before, after) < ALPHA)
+      verdict = 'faster'
+      @faster << name
+    end
+    format("%-#{width}s %11.2f ns %11.2f ns %+8.1f%% %s\n", name, old_median, new_median, change, verdict).rstrip + "\n"
+  end
+end
+
+if $0 == __FILE__
+
+  # parse out the command options
+  opts, args = ARGV.partition { |v| v =~ /^--\w+/ }
+  threshold = 5.0
+  opts.each do |o|
+    threshold = Regexp.last_match(1).to_f if o =~ /^--threshold=([\d.]+)%?$/
+  end
+
+  # make sure we have what we need
+  if args.size != 2
+    puts "\nusage: ruby #{__FILE__} [--threshold=5%] baseline_file current_file"
+    exit 1
+  end
+
+  begin
+    diff = HuntBenchDiff.new(threshold)
+    puts diff.run(args[0], args[1])
+    exit(diff.slower.empty? ? 0 : 1)
+  rescue StandardError => e
+    puts e
+    exit 1
+  end
+end
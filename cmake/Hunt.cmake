@@ -0,0 +1,152 @@
+###################################################################################
+#                                                                                 #
+# NAME: Hunt.cmake                                                                #
+#                                                                                 #
+# AUTHOR: Mike Karlesky, Mark VanderVoord, Greg Williams.                         #
+#                                                                                 #
+# License: MIT                                                                    #
+#                                                                                 #
+###################################################################################
+#
+# Builds a Hunt test executable from a single test file and registers each of
+# its tests with CTest, so that `ctest -j` can spread them across cores:
+#
+#   include(Hunt)
+#   hunt_add_test(test_widget test/test_widget.c
+#       SOURCES          src/widget.c
+#       LINK_LIBRARIES   my_lib
+#       GENERATOR_CONFIG test/hunt_config.yml
+#       LABELS           unit widget
+#       TIMEOUT          10
+#       RESOURCE_LOCK    serial_port)
+#
+# The runner is generated at build time by auto/generate_test_runner.rb, with
+# command line arguments enabled. Hunt itself is compiled into each executable,
+# so that its COMPILE_DEFINITIONS (HUNT_INCLUDE_EXEC_TIME, HUNT_SUPPORT_64 and
+# the like) reach src/hunt.c as well as the tests. After every build the executable is asked
+# for its list of tests (`-l`) and one CTest test is added per entry, each of
+# them running the executable with `-e <test name>`.
+#
+# Options:
+#   SOURCES            extra sources compiled into the test executable
+#   LINK_LIBRARIES     libraries the test executable links against
+#   INCLUDE_DIRECTORIES extra include directories for the test executable
+#   COMPILE_DEFINITIONS extra definitions for the test executable
+#   GENERATOR_CONFIG   YAML file passed to generate_test_runner.rb
+#   GENERATOR_OPTIONS  extra options passed to generate_test_runner.rb
+#   TEST_PREFIX        prefix of the CTest names (default: "<TARGET>.")
+#   LABELS             CTest labels of every test
+#   TIMEOUT            CTest timeout of every test, in seconds
+#   RESOURCE_LOCK      CTest resource locks of every test
+#   PROPERTIES         any other CTest properties, as name/value pairs
+#   WORKING_DIRECTORY  directory the tests run in (default: current binary dir)
+
+if(CMAKE_VERSION VERSION_LESS 3.10)
+    message(FATAL_ERROR "Hunt.cmake requires CMake 3.10 or newer")
+endif()
+include_guard(GLOBAL)
+
+get_filename_component(HUNT_ROOT_DIR "${CMAKE_CURRENT_LIST_DIR}/.." ABSOLUTE)
+set(HUNT_DISCOVER_SCRIPT "${CMAKE_CURRENT_LIST_DIR}/HuntDiscoverTests.cmake")
+
+find_program(HUNT_RUBY_EXECUTABLE ruby)
+
+function(hunt_add_test TARGET TEST_FILE)
+    cmake_parse_arguments(HUNT
+        ""
+        "GENERATOR_CONFIG;TEST_PREFIX;TIMEOUT;WORKING_DIRECTORY"
+        "SOURCES;LINK_LIBRARIES;INCLUDE_DIRECTORIES;COMPILE_DEFINITIONS;GENERATOR_OPTIONS;LABELS;RESOURCE_LOCK;PROPERTIES"
+        ${ARGN})
+
+    if(NOT HUNT_RUBY_EXECUTABLE)
+        message(FATAL_ERROR "hunt_add_test: ruby is required to generate the runner for ${TARGET}")
+    endif()
+    if(NOT DEFINED HUNT_TEST_PREFIX)
+        set(HUNT_TEST_PREFIX "${TARGET}.")
+    endif()
+    if(NOT HUNT_WORKING_DIRECTORY)
+        set(HUNT_WORKING_DIRECTORY "${CMAKE_CURRENT_BINARY_DIR}")
+    endif()
+
+    # Generate the runner whenever the test file or the generator changes
+    get_filename_component(test_file "${TEST_FILE}" ABSOLUTE)
+    set(runner "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_Runner.c")
+    set(generator "${HUNT_ROOT_DIR}/auto/generate_test_runner.rb")
+    set(config_args "")
+    set(config_deps "")
+    if(HUNT_GENERATOR_CONFIG)
+        get_filename_component(config "${HUNT_GENERATOR_CONFIG}" ABSOLUTE)
+        set(config_args "${config}")
+        set(config_deps "${config}")
+    endif()
+
+    add_custom_command(
+        OUTPUT  "${runner}"
+        COMMAND "${HUNT_RUBY_EXECUTABLE}" "${generator}" ${config_args}
+                "--cmdline_args=1" ${HUNT_GENERATOR_OPTIONS} "${test_file}" "${runner}"
+        DEPENDS "${test_file}" "${generator}" ${config_deps}
+        COMMENT "Generating Hunt runner for ${TARGET}"
+        VERBATIM)
+
+    add_executable(${TARGET} "${test_file}" "${runner}" "${HUNT_ROOT_DIR}/src/hunt.c" ${HUNT_SOURCES})
+    target_include_directories(${TARGET} PRIVATE "${HUNT_ROOT_DIR}/src")
+    target_compile_definitions(${TARGET} PRIVATE HUNT_USE_COMMAND_LINE_ARGS)
+    if(HUNT_LINK_LIBRARIES)
+        target_link_libraries(${TARGET} PRIVATE ${HUNT_LINK_LIBRARIES})
+    endif()
+    if(HUNT_INCLUDE_DIRECTORIES)
+        target_include_directories(${TARGET} PRIVATE ${HUNT_INCLUDE_DIRECTORIES})
+    endif()
+    if(HUNT_COMPILE_DEFINITIONS)
+        target_compile_definitions(${TARGET} PRIVATE ${HUNT_COMPILE_DEFINITIONS})
+    endif()
+
+    # CTest properties of every test, written out as CMake arguments
+    set(properties "")
+    if(HUNT_LABELS)
+        string(APPEND properties " LABELS [==[${HUNT_LABELS}]==]")
+    endif()
+    if(HUNT_TIMEOUT)
+        string(APPEND properties " TIMEOUT [==[${HUNT_TIMEOUT}]==]")
+    endif()
+    if(HUNT_RESOURCE_LOCK)
+        string(APPEND properties " RESOURCE_LOCK [==[${HUNT_RESOURCE_LOCK}]==]")
+    endif()
+    list(LENGTH HUNT_PROPERTIES count)
+    math(EXPR odd "${count} % 2")
+    if(odd)
+        message(FATAL_ERROR "hunt_add_test: PROPERTIES of ${TARGET} must be name/value pairs")
+    endif()
+    while(HUNT_PROPERTIES)
+        list(GET HUNT_PROPERTIES 0 name)
+        list(GET HUNT_PROPERTIES 1 value)
+        list(REMOVE_AT HUNT_PROPERTIES 0 1)
+        string(APPEND properties " ${name} [==[${value}]==]")
+    endwhile()
+
+    set(ctest_file         "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_tests.cmake")
+    set(ctest_include_file "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_include.cmake")
+    set(params_file        "${CMAKE_CURRENT_BINARY_DIR}/${TARGET}_discover.cmake")
+    file(WRITE "${params_file}"
+        "set(HUNT_TEST_PREFIX [==[${HUNT_TEST_PREFIX}]==])\n"
+        "set(HUNT_TEST_PROPERTIES [===[${properties}]===])\n"
+        "set(HUNT_WORKING_DIRECTORY [==[${HUNT_WORKING_DIRECTORY}]==])\n"
+        "set(HUNT_CTEST_FILE [==[${ctest_file}]==])\n")
+
+    add_custom_command(TARGET ${TARGET} POST_BUILD
+        COMMAND "${CMAKE_COMMAND}"
+                "-DHUNT_EXECUTABLE=$<TARGET_FILE:${TARGET}>"
+                "-DHUNT_PARAMS_FILE=${params_file}"
+                -P "${HUNT_DISCOVER_SCRIPT}"
+        BYPRODUCTS "${ctest_file}"
+        VERBATIM)
+
+    # CTest reads the discovered tests, or reports the executable as missing
+    file(WRITE "${ctest_include_file}"
+        "if(EXISTS [==[${ctest_file}]==])\n"
+        "  include([==[${ctest_file}]==])\n"
+        "else()\n"
+        "  add_test([==[${TARGET}_NOT_BUILT]==] [==[${TARGET}_NOT_BUILT]==])\n"
+        "endif()\n")
+    set_property(DIRECTORY APPEND PROPERTY TEST_INCLUDE_FILES "${ctest_include_file}")
+endfunction()
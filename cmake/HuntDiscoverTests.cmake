@@ -0,0 +1,50 @@
+###################################################################################
+#                                                                                 #
+# NAME: HuntDiscoverTests.cmake                                                   #
+#                                                                                 #
+# AUTHOR: Mike Karlesky, Mark VanderVoord, Greg Williams.                         #
+#                                                                                 #
+# License: MIT                                                                    #
+#                                                                                 #
+###################################################################################
+#
+# Run by hunt_add_test() after each build of a test executable, as
+#   cmake -DHUNT_EXECUTABLE=<exe> -DHUNT_PARAMS_FILE=<file> -P HuntDiscoverTests.cmake
+# Lists the tests of the executable and writes one add_test() for each of them.
+
+include("${HUNT_PARAMS_FILE}")
+
+execute_process(
+    COMMAND "${HUNT_EXECUTABLE}" -l
+    WORKING_DIRECTORY "${HUNT_WORKING_DIRECTORY}"
+    OUTPUT_VARIABLE output
+    RESULT_VARIABLE result)
+
+if(NOT result EQUAL 0)
+    message(FATAL_ERROR "Unable to list the tests of ${HUNT_EXECUTABLE}:\n${output}")
+endif()
+
+# Keep semicolons in parameterized test names from splitting the list
+string(REPLACE ";" "\;" output "${output}")
+string(REPLACE "\n" ";" lines "${output}")
+
+set(content "# Generated by HuntDiscoverTests.cmake, do not edit\n")
+foreach(line IN LISTS lines)
+    # Tests are listed two spaces in, below the name of the test file
+    if(NOT line MATCHES "^  ([^ ].*)$")
+        continue()
+    endif()
+    set(test "${CMAKE_MATCH_1}")
+    string(REGEX REPLACE "\r$" "" test "${test}")
+    string(REGEX REPLACE "\\(RUN_TEST_NO_ARGS\\)$" "" test "${test}")
+
+    set(name "${HUNT_TEST_PREFIX}${test}")
+    string(APPEND content
+        "add_test([==[${name}]==] [==[${HUNT_EXECUTABLE}]==] -e [==[${test}]==])\n"
+        "set_tests_properties([==[${name}]==] PROPERTIES"
+        " WORKING_DIRECTORY [==[${HUNT_WORKING_DIRECTORY}]==]"
+        " SKIP_REGULAR_EXPRESSION [==[:IGNORE]==]"
+        "${HUNT_TEST_PROPERTIES})\n")
+endforeach()
+
+file(WRITE "${HUNT_CTEST_FILE}" "${content}")
@@ -256,7 +256,7 @@
  *
  * Example:
  *
- * TEST - PASS (10 ms)
+ * TEST - PASS (10.25 ms)
  */
 /* #define HUNT_INCLUDE_EXEC_TIME */
 
@@ -9,6 +9,7 @@
 #include "hunt_output_Spy.h"
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
 
 TEST_GROUP(HuntFixture);
 
@@ -109,6 +110,73 @@ TEST(HuntFixture, CallocFillsWithZero)
     free(m);
 }
 
+#define TEST_ASSERT_ALIGNED(alignment, mem) \
+    TEST_ASSERT_EQUAL_UINT(0, (size_t)(HUNT_PTR_TO_INT)(mem) & ((alignment) - 1))
+
+TEST(HuntFixture, MallocIsAlignedToMallocAlignment)
+{
+    void* m1 = malloc(1);
+    void* m2 = malloc(3);
+    TEST_ASSERT_ALIGNED(HUNT_MALLOC_ALIGNMENT, m1);
+    TEST_ASSERT_ALIGNED(HUNT_MALLOC_ALIGNMENT, m2);
+    free(m2);
+    free(m1);
+}
+
+TEST(HuntFixture, AlignedAllocIsAligned)
+{
+    size_t alignment;
+    for (alignment = 16; alignment <= 64; alignment *= 2)
+    {
+        char* m = (char*)aligned_alloc(alignment, 10);
+        TEST_ASSERT_NOT_NULL(m);
+        TEST_ASSERT_ALIGNED(alignment, m);
+        memset(m, 0xAA, 10);
+        free(m);
+    }
+}
+
+TEST(HuntFixture, AlignedAllocRejectsAlignmentNotPowerOfTwo)
+{
+    TEST_ASSERT_NULL(aligned_alloc(24, 10));
+    TEST_ASSERT_NULL(memalign(0, 10));
+}
+
+TEST(HuntFixture, MemalignIsAligned)
+{
+    void* m = memalign(32, 20);
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT_ALIGNED(32, m);
+    free(m);
+}
+
+TEST(HuntFixture, PosixMemalignIsAligned)
+{
+    void* m = NULL;
+    TEST_ASSERT_EQUAL_INT(0, posix_memalign(&m, 64, 10));
+    TEST_ASSERT_NOT_NULL(m);
+    TEST_ASSERT_ALIGNED(64, m);
+    free(m);
+}
+
+TEST(HuntFixture, PosixMemalignRejectsBadAlignment)
+{
+    void* m = NULL;
+    TEST_ASSERT_EQUAL_INT(EINVAL, posix_memalign(&m, 24, 10));
+    TEST_ASSERT_EQUAL_INT(EINVAL, posix_memalign(&m, sizeof(void*) / 2, 10));
+    TEST_ASSERT_NULL(m);
+}
+
+TEST(HuntFixture, ReallocOfAlignedMemoryKeepsContents)
+{
+    char* m1 = (char*)aligned_alloc(32, 10);
+    char* m2;
+    strcpy(m1, "123456789");
+    m2 = (char*)realloc(m1, 40);
+    STRCMP_EQUAL("123456789", m2);
+    free(m2);
+}
+
 static char *p1;
 static char *p2;
 
@@ -307,6 +375,28 @@ TEST(HuntCommandOptions, GroupFilterReallyFilters)
     TEST_ASSERT_EQUAL(saved, Hunt.NumberOfTests);
 }
 
+static const char* timeBudgetScale[] = {
+        "testrunner.exe",
+        "-t", "250",
+        "-n", "testname"
+};
+
+TEST(HuntCommandOptions, OptionScaleTimeBudgets)
+{
+    TEST_ASSERT_EQUAL(0, HuntGetCommandLineOptions(5, timeBudgetScale));
+    STRCMP_EQUAL("testname", HuntFixture.NameFilter);
+#ifdef HUNT_USE_TIME_BUDGETS
+    TEST_ASSERT_EQUAL(250, HuntTimeBudgetScale);
+    HuntTimeBudgetScale = HUNT_TIME_BUDGET_SCALE;
+#endif
+    TEST_ASSERT_EQUAL(1, HuntGetCommandLineOptions(2, timeBudgetScale));
+}
+
+TEST_WITH_TIME_BUDGET(HuntCommandOptions, TestWithinItsTimeBudget, 1000000000)
+{
+    TEST_ASSERT_EQUAL(0, HuntGetCommandLineOptions(1, timeBudgetScale));
+}
+
 IGNORE_TEST(HuntCommandOptions, TestShouldBeIgnored)
 {
     TEST_FAIL_MESSAGE("This test should not run!");
@@ -318,11 +408,7 @@ TEST_GROUP(LeakDetection);
 
 TEST_SETUP(LeakDetection)
 {
-#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
-    HuntOutputCharSpy_Create(200);
-#else
     HuntOutputCharSpy_Create(1000);
-#endif
 }
 
 TEST_TEAR_DOWN(LeakDetection)
@@ -382,6 +468,91 @@ TEST(LeakDetection, DetectsLeak)
 #endif
 }
 
+TEST(LeakDetection, ReportsWhereLeaksWereAllocated)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(HUNT_MALLOC_CALL_SITES)
+    TEST_IGNORE();
+#else
+    void* m = malloc(10);
+    TEST_ASSERT_NOT_NULL(m);
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    HuntMalloc_EndTest();
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "This test leaks! 1 block, 10 bytes: 10 bytes in 1 block from "));
+    CHECK(strstr(HuntOutputCharSpy_Get(), "hunt_fixture_Test.c:"));
+    free(m);
+#endif
+}
+
+TEST(LeakDetection, SumsUpLeaksOfEachCallSite)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(HUNT_MALLOC_CALL_SITES)
+    TEST_IGNORE();
+#else
+    void* m[3];
+    int i;
+    m[0] = malloc(4);
+    m[0] = realloc(m[0], 16);
+    for (i = 1; i < 3; i++) m[i] = malloc(8);
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    HuntMalloc_EndTest();
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "This test leaks! 3 blocks, 32 bytes: "));
+    CHECK(strstr(HuntOutputCharSpy_Get(), "16 bytes in 2 blocks from "));
+    CHECK(strstr(HuntOutputCharSpy_Get(), "16 bytes in 1 block from "));
+    for (i = 0; i < 3; i++) free(m[i]);
+#endif
+}
+
+TEST(LeakDetection, RegistryKeepsTrackOfManyBlocks)
+{
+#if !defined(USING_OUTPUT_SPY) || defined(HUNT_EXCLUDE_STDLIB_MALLOC)
+    TEST_IGNORE();
+#else
+    void* m[100];
+    int i;
+    for (i = 0; i < 100; i++) m[i] = malloc(2);
+    for (i = 1; i < 100; i += 2) free(m[i]);
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    HuntMalloc_EndTest();
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "This test leaks! 50 blocks, 100 bytes: "));
+    CHECK(strstr(HuntOutputCharSpy_Get(), "100 bytes in 50 blocks"));
+    for (i = 0; i < 100; i += 2) free(m[i]);
+#endif
+}
+
+TEST(LeakDetection, BlocksPastTheRegistryAreNotRegistered)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(HUNT_EXCLUDE_STDLIB_MALLOC)
+    TEST_IGNORE();
+#elif HUNT_MALLOC_REGISTRY_SIZE > 4
+    TEST_IGNORE_MESSAGE("Build with '-D HUNT_MALLOC_REGISTRY_SIZE=4' to fill the registry in the internal heap");
+#else
+    void* m[4];
+    int i;
+    for (i = 0; i < 4; i++) m[i] = malloc(1);
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    HuntMalloc_EndTest();
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "This test leaks! 3 blocks, 3 bytes: "));
+    CHECK(strstr(HuntOutputCharSpy_Get(), ", 1 block not registered"));
+    for (i = 0; i < 4; i++) free(m[i]);
+#endif
+}
+
 TEST(LeakDetection, BufferOverrunFoundDuringFree)
 {
 #ifndef USING_OUTPUT_SPY
@@ -420,6 +591,24 @@ TEST(LeakDetection, BufferOverrunFoundDuringRealloc)
 #endif
 }
 
+TEST(LeakDetection, BufferOverrunOfAlignedMemoryFoundDuringFree)
+{
+#ifndef USING_OUTPUT_SPY
+    TEST_IGNORE();
+#else
+    char* s = (char*)aligned_alloc(16, 10);
+    TEST_ASSERT_NOT_NULL(s);
+    s[10] = (char)0xFF;
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    free(s);
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "Buffer overrun detected during free()"));
+#endif
+}
+
 TEST(LeakDetection, BufferGuardWriteFoundDuringFree)
 {
 #ifndef USING_OUTPUT_SPY
@@ -478,6 +667,108 @@ TEST(LeakDetection, PointerSettingMax)
 
 /*------------------------------------------------------------ */
 
+TEST_GROUP(MallocStats);
+
+TEST_SETUP(MallocStats) { }
+TEST_TEAR_DOWN(MallocStats) { }
+
+TEST(MallocStats, CountsAllocationsAndFrees)
+{
+    HuntMallocStats stats;
+    void* m = malloc(10);
+    void* n = calloc(2, 4);
+    free(n);
+    HuntMalloc_GetStats(&stats);
+    free(m);
+    TEST_ASSERT_EQUAL_UINT(2, stats.Allocations);
+    TEST_ASSERT_EQUAL_UINT(1, stats.Frees);
+    TEST_ASSERT_EQUAL_UINT(18, stats.BytesAllocated);
+    TEST_ASSERT_EQUAL_UINT(10, stats.LiveBytes);
+    TEST_ASSERT_EQUAL_UINT(18, stats.PeakLiveBytes);
+}
+
+TEST(MallocStats, CountsBytesCopiedByRealloc)
+{
+    HuntMallocStats stats;
+    void* m = malloc(8);
+    void* n = malloc(8);
+    m = realloc(m, 16);
+    HuntMalloc_GetStats(&stats);
+    free(m);
+    free(n);
+    TEST_ASSERT_EQUAL_UINT(8, stats.ReallocCopyBytes);
+    TEST_ASSERT_EQUAL_UINT(24, stats.LiveBytes);
+}
+
+TEST(MallocStats, SortsSizesIntoPowerOfTwoClasses)
+{
+    HuntMallocStats stats;
+    void* m[4];
+    m[0] = malloc(1);
+    m[1] = malloc(3);
+    m[2] = malloc(4);
+    m[3] = malloc(7);
+    HuntMalloc_GetStats(&stats);
+    free(m[3]);
+    free(m[2]);
+    free(m[1]);
+    free(m[0]);
+    TEST_ASSERT_EQUAL_UINT(1, stats.SizeClasses[0]);
+    TEST_ASSERT_EQUAL_UINT(1, stats.SizeClasses[1]);
+    TEST_ASSERT_EQUAL_UINT(2, stats.SizeClasses[2]);
+    TEST_ASSERT_EQUAL_UINT(0, stats.SizeClasses[3]);
+}
+
+TEST(MallocStats, MaxAllocations)
+{
+#ifndef USING_OUTPUT_SPY
+    TEST_IGNORE();
+#else
+    void* m;
+    HuntOutputCharSpy_Create(1000);
+    m = malloc(1);
+    TEST_ASSERT_MAX_ALLOCATIONS(1);
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_MAX_ALLOCATIONS(0);
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "Too many allocations"));
+    free(m);
+    HuntOutputCharSpy_Destroy();
+#endif
+}
+
+TEST(MallocStats, NoAllocationsIn)
+{
+#ifndef USING_OUTPUT_SPY
+    TEST_IGNORE();
+#else
+    void* volatile m = NULL;
+    char s[8];
+    HuntOutputCharSpy_Create(1000);
+    TEST_ASSERT_NO_ALLOCATIONS_IN(strcpy(s, "static"));
+    STRCMP_EQUAL("static", s);
+    TEST_ASSERT_NO_ALLOCATIONS_BEGIN
+    const char t[] = { 'o', 'k', '\0' };
+    strcpy(s, t);
+    TEST_ASSERT_NO_ALLOCATIONS_END
+    STRCMP_EQUAL("ok", s);
+    HuntOutputCharSpy_Enable(1);
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_NO_ALLOCATIONS_IN({ m = malloc(1); });
+    EXPECT_ABORT_END
+    HuntOutputCharSpy_Enable(0);
+    Hunt.CurrentTestFailed = 0;
+    CHECK(strstr(HuntOutputCharSpy_Get(), "Allocated where no allocation was expected"));
+    free(m);
+    HuntOutputCharSpy_Destroy();
+#endif
+}
+
+/*------------------------------------------------------------ */
+
 TEST_GROUP(InternalMalloc);
 #define TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(first_mem_ptr, ptr) \
     ptr = malloc(10); free(ptr);                                   \
@@ -541,3 +832,94 @@ TEST(InternalMalloc, ReallocFailDoesNotFreeMem)
     TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(m, n2);
 #endif
 }
+
+TEST(InternalMalloc, FreeInAnyOrderStrandsNothing)
+{
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+    void* m = malloc(10);
+    void* n1 = malloc(10);
+    void* n2 = malloc(10);
+    void* big;
+
+    free(m);
+    free(n2);
+    free(n1);
+    big = malloc(HUNT_INTERNAL_HEAP_SIZE_BYTES/2 + 1);
+    free(big);
+    TEST_ASSERT_EQUAL_PTR(m, big);
+    TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(m, n1);
+#endif
+}
+
+TEST(InternalMalloc, FreedBlockIsReused)
+{
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+    void* m = malloc(10);
+    void* n1 = malloc(10);
+    void* n2 = malloc(10);
+    void* reused;
+
+    free(n1);
+    reused = malloc(10);
+    free(m);
+    free(n2);
+    free(reused);
+    TEST_ASSERT_EQUAL_PTR(n1, reused);
+    TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(m, n1);
+#endif
+}
+
+TEST(InternalMalloc, SmallerBlockOfTheSameClassDoesNotHideOneThatFits)
+{
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+    HuntMallocStats stats;
+    size_t overhead;
+    void* m;
+    void* n1;
+    void* n2;
+    void* rest;
+    void* reused;
+
+    HuntMalloc_GetStats(&stats);
+    overhead = stats.HeapFreeBytes;
+    m = malloc(4);
+    HuntMalloc_GetStats(&stats);
+    overhead -= stats.HeapFreeBytes + 4;
+    free(m);
+
+    /* blocks of 88 and 72 bytes, in one size class, with the rest of the heap in use */
+    m = malloc(88 - overhead);
+    n1 = malloc(4);
+    n2 = malloc(72 - overhead);
+    HuntMalloc_GetStats(&stats);
+    rest = (stats.HeapLargestFree > overhead) ? malloc(stats.HeapLargestFree - overhead) : NULL;
+    free(m);
+    free(n2);
+    reused = malloc(80 - overhead);
+    free(reused);
+    free(n1);
+    free(rest);
+    TEST_ASSERT_EQUAL_PTR(m, reused);
+    TEST_ASSERT_MEMORY_ALL_FREE_LIFO_ORDER(m, n1);
+#endif
+}
+
+TEST(InternalMalloc, ReportsFragmentationAndHighWater)
+{
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+    HuntMallocStats stats;
+    void* m = malloc(10);
+    void* n1 = malloc(10);
+    void* n2 = malloc(10);
+
+    free(n1);
+    HuntMalloc_GetStats(&stats);
+    TEST_ASSERT_TRUE(stats.HeapLargestFree < stats.HeapFreeBytes);
+    TEST_ASSERT_TRUE(stats.HeapHighWater >= 3 * (10 + 2 * sizeof(size_t)));
+    free(m);
+    free(n2);
+    HuntMalloc_GetStats(&stats);
+    TEST_ASSERT_EQUAL_UINT(stats.HeapFreeBytes, stats.HeapLargestFree);
+    TEST_ASSERT_TRUE(stats.HeapFreeBytes + sizeof(size_t) > HUNT_INTERNAL_HEAP_SIZE_BYTES);
+#endif
+}
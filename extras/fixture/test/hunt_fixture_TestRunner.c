@@ -17,6 +17,13 @@ TEST_GROUP_RUNNER(HuntFixture)
     RUN_TEST_CASE(HuntFixture, ReallocNullPointerIsLikeMalloc);
     RUN_TEST_CASE(HuntFixture, ReallocSizeZeroFreesMemAndReturnsNullPointer);
     RUN_TEST_CASE(HuntFixture, CallocFillsWithZero);
+    RUN_TEST_CASE(HuntFixture, MallocIsAlignedToMallocAlignment);
+    RUN_TEST_CASE(HuntFixture, AlignedAllocIsAligned);
+    RUN_TEST_CASE(HuntFixture, AlignedAllocRejectsAlignmentNotPowerOfTwo);
+    RUN_TEST_CASE(HuntFixture, MemalignIsAligned);
+    RUN_TEST_CASE(HuntFixture, PosixMemalignIsAligned);
+    RUN_TEST_CASE(HuntFixture, PosixMemalignRejectsBadAlignment);
+    RUN_TEST_CASE(HuntFixture, ReallocOfAlignedMemoryKeepsContents);
     RUN_TEST_CASE(HuntFixture, PointerSet);
     RUN_TEST_CASE(HuntFixture, FreeNULLSafety);
     RUN_TEST_CASE(HuntFixture, ConcludeTestIncrementsFailCount);
@@ -35,23 +42,43 @@ TEST_GROUP_RUNNER(HuntCommandOptions)
     RUN_TEST_CASE(HuntCommandOptions, UnknownCommandIsIgnored);
     RUN_TEST_CASE(HuntCommandOptions, GroupOrNameFilterWithoutStringFails);
     RUN_TEST_CASE(HuntCommandOptions, GroupFilterReallyFilters);
+    RUN_TEST_CASE(HuntCommandOptions, OptionScaleTimeBudgets);
+    RUN_TEST_CASE(HuntCommandOptions, TestWithinItsTimeBudget);
     RUN_TEST_CASE(HuntCommandOptions, TestShouldBeIgnored);
 }
 
 TEST_GROUP_RUNNER(LeakDetection)
 {
     RUN_TEST_CASE(LeakDetection, DetectsLeak);
+    RUN_TEST_CASE(LeakDetection, ReportsWhereLeaksWereAllocated);
+    RUN_TEST_CASE(LeakDetection, SumsUpLeaksOfEachCallSite);
+    RUN_TEST_CASE(LeakDetection, RegistryKeepsTrackOfManyBlocks);
+    RUN_TEST_CASE(LeakDetection, BlocksPastTheRegistryAreNotRegistered);
     RUN_TEST_CASE(LeakDetection, BufferOverrunFoundDuringFree);
     RUN_TEST_CASE(LeakDetection, BufferOverrunFoundDuringRealloc);
+    RUN_TEST_CASE(LeakDetection, BufferOverrunOfAlignedMemoryFoundDuringFree);
     RUN_TEST_CASE(LeakDetection, BufferGuardWriteFoundDuringFree);
     RUN_TEST_CASE(LeakDetection, BufferGuardWriteFoundDuringRealloc);
     RUN_TEST_CASE(LeakDetection, PointerSettingMax);
 }
 
+TEST_GROUP_RUNNER(MallocStats)
+{
+    RUN_TEST_CASE(MallocStats, CountsAllocationsAndFrees);
+    RUN_TEST_CASE(MallocStats, CountsBytesCopiedByRealloc);
+    RUN_TEST_CASE(MallocStats, SortsSizesIntoPowerOfTwoClasses);
+    RUN_TEST_CASE(MallocStats, MaxAllocations);
+    RUN_TEST_CASE(MallocStats, NoAllocationsIn);
+}
+
 TEST_GROUP_RUNNER(InternalMalloc)
 {
     RUN_TEST_CASE(InternalMalloc, MallocPastBufferFails);
     RUN_TEST_CASE(InternalMalloc, CallocPastBufferFails);
     RUN_TEST_CASE(InternalMalloc, MallocThenReallocGrowsMemoryInPlace);
     RUN_TEST_CASE(InternalMalloc, ReallocFailDoesNotFreeMem);
+    RUN_TEST_CASE(InternalMalloc, FreeInAnyOrderStrandsNothing);
+    RUN_TEST_CASE(InternalMalloc, FreedBlockIsReused);
+    RUN_TEST_CASE(InternalMalloc, SmallerBlockOfTheSameClassDoesNotHideOneThatFits);
+    RUN_TEST_CASE(InternalMalloc, ReportsFragmentationAndHighWater);
 }
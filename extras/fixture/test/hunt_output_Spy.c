@@ -12,25 +12,28 @@
 #include <stdio.h>
 #include <string.h>
 
+/* Kept out of the heap, so that the tests of the small internal heap have all
+ * of it, and the spy is not among the allocations and leaks they check */
+#define SPY_BUFFER_SIZE 1000
+
 static int size;
 static int count;
-static char* buffer;
+static char buffer[SPY_BUFFER_SIZE];
 static int spy_enable;
 
 void HuntOutputCharSpy_Create(int s)
 {
     size = (s > 0) ? s : 0;
+    if (size > SPY_BUFFER_SIZE)
+        size = SPY_BUFFER_SIZE;
     count = 0;
     spy_enable = 0;
-    buffer = malloc((size_t)size);
-    TEST_ASSERT_NOT_NULL_MESSAGE(buffer, "Internal malloc failed in Spy Create():" __FILE__);
-    memset(buffer, 0, (size_t)size);
+    memset(buffer, 0, sizeof(buffer));
 }
 
 void HuntOutputCharSpy_Destroy(void)
 {
     size = 0;
-    free(buffer);
 }
 
 void HuntOutputCharSpy_OutputChar(int c)
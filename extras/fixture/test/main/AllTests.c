@@ -12,6 +12,7 @@ static void runAllTests(void)
     RUN_TEST_GROUP(HuntFixture);
     RUN_TEST_GROUP(HuntCommandOptions);
     RUN_TEST_GROUP(LeakDetection);
+    RUN_TEST_GROUP(MallocStats);
     RUN_TEST_GROUP(InternalMalloc);
 }
 
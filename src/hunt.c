@@ -4,9 +4,75 @@
     [Released under MIT License. Please refer to license.txt for details]
 ============================================================================ */
 
+/* clock_gettime() for timing tests is POSIX rather than ISO C, so ask for it before any system
+ * header. Builds without those features keep whatever the compiler defaults to. */
+#if defined(__unix__) && !defined(_POSIX_C_SOURCE) && \
+    (defined(HUNT_INCLUDE_EXEC_TIME) || defined(HUNT_INCLUDE_BENCHMARK) || defined(HUNT_INCLUDE_PHASE_TIMES) || \
+     defined(HUNT_INCLUDE_TRACE) || defined(HUNT_INCLUDE_PROFILER) || defined(HUNT_INCLUDE_RUSAGE))
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+/* dladdr() for the profiler is a GNU extension on Linux */
+#if defined(HUNT_INCLUDE_PROFILER) && defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+/* syscall() for traces, performance counters and pinning the CPU is not even POSIX */
+#if defined(__linux__) && !defined(_DEFAULT_SOURCE) && \
+    (defined(HUNT_INCLUDE_TRACE) || defined(HUNT_INCLUDE_PERF_COUNTERS) || \
+     ((defined(HUNT_INCLUDE_EXEC_TIME) || defined(HUNT_INCLUDE_BENCHMARK)) && \
+      (defined(HUNT_INCLUDE_BENCH_ENVIRONMENT) || defined(HUNT_PIN_CPU) || defined(HUNT_PRIORITY))))
+#define _DEFAULT_SOURCE
+#endif
+
 #include "hunt.h"
 #include <stddef.h>
 
+#if ((defined(HUNT_USE_HOST_CLOCK_NS) || defined(HUNT_USE_HOST_CLOCK_MS)) && !defined(_WIN32)) || defined(HUNT_USE_TRACE)
+#include <time.h>
+#endif
+
+#if (defined(HUNT_USE_HOST_CLOCK_NS) || defined(HUNT_USE_HOST_CLOCK_MS)) && defined(_WIN32)
+#include <windows.h>
+#endif
+
+#if defined(HUNT_USE_BENCH_BASELINE) || defined(HUNT_USE_SYSFS_CACHE_SIZE) || defined(HUNT_USE_BENCH_ENVIRONMENT) || defined(HUNT_USE_STATM) || defined(HUNT_USE_TRACE) || defined(HUNT_USE_PROFILER)
+#include <stdio.h>
+#endif
+
+#ifdef HUNT_USE_BENCH_EVICT_BUFFER
+#include <stdlib.h>
+#endif
+
+#ifdef HUNT_USE_PERF_EVENTS
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#endif
+
+#if defined(HUNT_USE_PERF_EVENTS) || (defined(HUNT_USE_BENCH_ENVIRONMENT) && defined(HUNT_PIN_CPU)) || (defined(HUNT_USE_TRACE) && defined(__linux__))
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(HUNT_USE_STATM) || defined(HUNT_USE_TRACE)
+#include <unistd.h>
+#endif
+
+#ifdef HUNT_USE_TRACE
+#include <fcntl.h>
+#endif
+
+#if (defined(HUNT_USE_BENCH_ENVIRONMENT) && defined(HUNT_PRIORITY)) || defined(HUNT_USE_RUSAGE)
+#include <sys/resource.h>
+#endif
+
+#ifdef HUNT_USE_PROFILER
+#include <dlfcn.h>
+#include <execinfo.h>
+#include <signal.h>
+#include <sys/time.h>
+#endif
+
 #ifdef AVR
 #include <avr/pgmspace.h>
 #else
@@ -25,6 +91,135 @@ void HUNT_OUTPUT_CHAR(int);
 
 struct HUNT_STORAGE_T Hunt;
 
+/* Set between HuntAggregateBegin() and HuntAggregateEnd(), while the runners
+ * of several test files share one process and one summary */
+static int HuntAggregating;
+static HUNT_COUNTER_TYPE HuntAggregateFileFailures;
+
+#ifdef HUNT_USE_PARAMS_CASES
+/* State of the parameterized test being run, see HuntRunParams() */
+static char HuntParamsName[HUNT_PARAMS_NAME_LENGTH];
+static const char *HuntParamsTestName;
+static HUNT_UINT HuntParamsFailures;
+static HUNT_UINT HuntParamsIgnores;
+#ifndef HUNT_EXCLUDE_SETJMP_H
+static jmp_buf HuntParamsFrame;
+#endif
+#endif
+#ifdef HUNT_INCLUDE_PARAMS
+static unsigned char HuntPairsCovered[(HUNT_PAIRWISE_MAX_PAIRS + 7) / 8];
+#endif
+
+#ifdef HUNT_USE_BENCH_BASELINE
+/* Baseline files of benchmarks, from --bench-save and --bench-compare */
+static const char *HuntBenchSavePath;
+static const char *HuntBenchComparePath;
+static FILE *HuntBenchSaveFile;
+#endif
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+/* Change worth failing a benchmark for against its baseline, and so the most noise it may have */
+static HUNT_UINT HuntBenchThreshold = HUNT_BENCH_THRESHOLD;
+
+/* Sizes of the benchmark sweep being run and the time per iteration of each, see HuntRunBenchmarkRange() */
+static HuntBenchFunction HuntBenchRangeFunc;
+static HUNT_UINT HuntBenchRangeSizes[HUNT_BENCH_MAX_POINTS];
+#ifndef HUNT_EXCLUDE_FLOAT
+static HUNT_FLOAT HuntBenchRangeTimes[HUNT_BENCH_MAX_POINTS];
+#endif
+#endif
+
+#ifdef HUNT_USE_PERF_EVENTS
+/* Performance counters of the current test, opened by the first test to run */
+static int HuntPerfOpened;
+static int HuntPerfFds[HUNT_PERF_EVENT_COUNT];
+static __u64 HuntPerfCounts[HUNT_PERF_EVENT_COUNT];
+#endif
+
+#ifdef HUNT_USE_RUSAGE
+/* Resources of the process before the current test, then what the test used of them */
+static struct rusage HuntRusageBefore;
+static struct rusage HuntRusageAfter;
+static long HuntRssBefore;
+static long HuntRssAfter;
+#endif
+
+#ifdef HUNT_USE_DURATIONS
+/* Time it takes to read the clock, measured by HuntBegin() */
+static HUNT_UINT HuntExecTimeOverhead;
+#endif
+
+#ifdef HUNT_USE_PHASE_HOOKS
+/* The phase the current test is in, see HuntPhaseStart() */
+static HUNT_PHASE_T HuntPhaseCurrent = HUNT_PHASE_COUNT;
+#endif
+
+#if defined(HUNT_INCLUDE_PHASE_TIMES) || defined(HUNT_USE_TRACE)
+static const char * const HuntPhaseNames[HUNT_PHASE_COUNT] = { "setUp", "test", "tearDown", "verify" };
+#endif
+
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+/* Time spent in each phase by the current test and by all tests so far */
+static HUNT_UINT HuntPhaseTimes[HUNT_PHASE_COUNT];
+static HUNT_UINT HuntPhaseTotals[HUNT_PHASE_COUNT];
+static HUNT_UINT HuntPhaseStartTime;
+static int HuntPhaseVerified;
+#endif
+
+#ifdef HUNT_USE_TRACE
+/* Trace file of --trace, and its events not written yet */
+static FILE *HuntTraceFile;
+static char HuntTraceBuffer[HUNT_TRACE_BUFFER_SIZE];
+static HUNT_UINT HuntTraceLength;
+static unsigned long HuntTracePid;
+static unsigned long HuntTraceTid;
+
+/* Spans begun and not ended, and how many of them were when the current test and phase began */
+static HUNT_UINT HuntTraceDepth;
+static HUNT_UINT HuntTraceTestDepth;
+static HUNT_UINT HuntTracePhaseDepth;
+#endif
+
+#ifdef HUNT_USE_PROFILER
+/* Folded stacks file of --profile, and the stacks sampled in the body of the current test */
+static FILE *HuntProfileFile;
+static void *HuntProfileFrames[HUNT_PROFILER_SAMPLES][HUNT_PROFILER_DEPTH];
+static int HuntProfileDepths[HUNT_PROFILER_SAMPLES];
+static volatile sig_atomic_t HuntProfileCount;
+static volatile sig_atomic_t HuntProfileDropped;
+#endif
+
+#ifdef HUNT_USE_SLOWEST_TESTS
+/* The slowest tests so far in a min-heap, so that the fastest of them is the next to go, and
+ * the durations of all tests in decades from 1 us to 1 s, see HuntRecordTestTime() */
+typedef struct {
+  const char *File;
+  const char *Name;
+  HUNT_LINE_TYPE Line;
+  HUNT_UINT Time;
+} HuntTestTime;
+
+static HuntTestTime HuntSlowestTests[HUNT_SLOWEST_TESTS];
+static HUNT_UINT HuntSlowestCount;
+static HUNT_UINT HuntTestTimeTotal;
+static HUNT_UINT HuntTestTimeCount;
+static HUNT_UINT HuntTestDurations[8];
+#endif
+
+#ifdef HUNT_USE_TIME_BUDGETS
+/* Percentage every time budget is scaled by, from HUNT_TIME_BUDGET_SCALE or the command line */
+HUNT_UINT HuntTimeBudgetScale = HUNT_TIME_BUDGET_SCALE;
+#endif
+#ifdef HUNT_INCLUDE_BENCHMARK
+static HUNT_UINT HuntBenchClockOverhead;
+#endif
+
+#ifdef HUNT_USE_BENCH_EVICT_BUFFER
+/* Memory that cold benchmark runs stream over to evict the caches, see HuntBenchEvict() */
+static unsigned char *HuntBenchEvictBuffer;
+static HUNT_UINT HuntBenchEvictBytes;
+#endif
+
 #ifdef HUNT_OUTPUT_COLOR
 const char PROGMEM HuntStrOk[]                            = "\033[42mOK\033[00m";
 const char PROGMEM HuntStrPass[]                          = "\033[42mPASS\033[00m";
@@ -66,6 +261,97 @@ static const char PROGMEM HuntStrBreaker[] = "-----------------------";
 static const char PROGMEM HuntStrResultsTests[] = " Tests ";
 static const char PROGMEM HuntStrResultsFailures[] = " Failures ";
 static const char PROGMEM HuntStrResultsIgnored[] = " Ignored ";
+#ifdef HUNT_USE_PARAMS_CASES
+static const char PROGMEM HuntStrParamsOf[] = " of ";
+static const char PROGMEM HuntStrParamsFailed[] = " Cases Failed";
+#endif
+#ifdef HUNT_INCLUDE_PARAMS
+static const char PROGMEM HuntStrErrAxes[] = "Too Many Axes, Define HUNT_COMBINATIONS_MAX_AXES";
+static const char PROGMEM HuntStrErrPairwise[] = "Too Many Pairs, Define HUNT_PAIRWISE_MAX_PAIRS";
+static const char PROGMEM HuntStrErrEmptyAxis[] = "Axis Has No Values";
+#endif
+#ifdef HUNT_INCLUDE_BENCHMARK
+static const char PROGMEM HuntStrBench[] = "BENCH";
+static const char PROGMEM HuntStrBenchMedian[] = " median ";
+static const char PROGMEM HuntStrBenchMin[] = " ns/op, min ";
+static const char PROGMEM HuntStrBenchMad[] = " ns/op, MAD ";
+static const char PROGMEM HuntStrBenchRuns[] = " ns/op, ";
+static const char PROGMEM HuntStrBenchIterations[] = " iterations";
+static const char PROGMEM HuntStrBenchCv[] = ", CV ";
+static const char PROGMEM HuntStrBenchNoisy[] = "% (noisier than the ";
+static const char PROGMEM HuntStrBenchNoisyThreshold[] = "% threshold)";
+static const char PROGMEM HuntStrBenchNoisyAB[] = " (noisier than the difference)";
+#ifndef HUNT_EXCLUDE_FLOAT
+static const char PROGMEM HuntStrBenchItems[] = "items";
+static const char PROGMEM HuntStrBenchBytes[] = "B";
+static const char PROGMEM HuntStrBigO[] = "BIG-O: ";
+static const char PROGMEM HuntStrBigORms[] = ", RMS ";
+static const char* const HuntBigONames[] = { "O(?)", "O(1)", "O(log n)", "O(n)", "O(n log n)", "O(n^2)" };
+#endif
+static const char PROGMEM HuntStrErrBenchLoop[] = "Benchmark Has No HUNT_BENCH_LOOP";
+static const char PROGMEM HuntStrBenchAB[] = "AB: B/A ";
+static const char PROGMEM HuntStrBenchABInterval[] = " (";
+static const char PROGMEM HuntStrBenchABConfidence[] = "% CI ";
+static const char PROGMEM HuntStrBenchABTo[] = " to ";
+static const char PROGMEM HuntStrBenchABMedianA[] = "), A ";
+static const char PROGMEM HuntStrBenchABMedianB[] = " ns/op, B ";
+static const char PROGMEM HuntStrBenchABPairs[] = " pairs";
+static const char PROGMEM HuntStrBenchABBelow[] = "B/A Below ";
+static const char PROGMEM HuntStrBenchABUpTo[] = "Up To ";
+static const char PROGMEM HuntStrErrBenchABFaster[] = "B Cannot Be 100 Percent Faster";
+static const char PROGMEM HuntStrBenchCold[] = "COLD";
+static const char PROGMEM HuntStrBenchWarm[] = "x warm";
+#ifdef HUNT_USE_BENCH_EVICT_BUFFER
+static const char PROGMEM HuntStrErrBenchEvict[] = "Unable To Allocate Memory To Evict The Caches";
+#endif
+#ifdef HUNT_USE_BENCH_BASELINE
+static const char PROGMEM HuntStrBenchSlower[] = "% Slower Than Baseline, Median ";
+static const char PROGMEM HuntStrBenchBaseline[] = " ns/op Was ";
+static const char PROGMEM HuntStrBenchUnit[] = " ns/op";
+static const char PROGMEM HuntStrErrBenchSave[] = "Unable To Write Benchmark Baseline";
+#endif
+#endif
+const char PROGMEM HuntStrErrBenchmark[] = "Hunt Benchmarks Disabled";
+const char PROGMEM HuntStrErrParams[] = "Hunt Parameterized Tests Disabled";
+#ifdef HUNT_USE_BENCH_ENVIRONMENT
+static const char PROGMEM HuntStrWarning[] = "WARNING: ";
+static const char PROGMEM HuntStrGovernorCpu[] = "CPU ";
+static const char PROGMEM HuntStrGovernor[] = " Scales Its Frequency With The ";
+static const char PROGMEM HuntStrGovernorEnd[] = " Governor, Times May Vary";
+#ifdef HUNT_PIN_CPU
+static const char PROGMEM HuntStrErrPinCpu[] = "Unable To Pin The Process To CPU ";
+#endif
+#ifdef HUNT_PRIORITY
+static const char PROGMEM HuntStrErrPriority[] = "Unable To Set The Nice Value To ";
+#endif
+#endif
+#ifdef HUNT_USE_TRACE
+static const char PROGMEM HuntStrErrTrace[] = "ERROR: Unable To Write Trace ";
+#endif
+#ifdef HUNT_USE_PROFILER
+static const char PROGMEM HuntStrErrProfile[] = "ERROR: Unable To Write Profile ";
+#endif
+static const char PROGMEM HuntStrHistogram[] = "HIST: count ";
+static const char PROGMEM HuntStrHistogramMax[] = ", max ";
+static const char PROGMEM HuntStrHistogramUnit[] = " ns";
+static const char PROGMEM HuntStrHistogramBelow[] = " Below ";
+static const char PROGMEM HuntStrErrHistogramEmpty[] = "Histogram Has No Samples";
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+static const char PROGMEM HuntStrPhases[] = "PHASES: ";
+#endif
+#ifdef HUNT_USE_SLOWEST_TESTS
+static const char PROGMEM HuntStrSlow[] = "SLOW: ";
+static const char PROGMEM HuntStrSlowShare[] = "% of all tests";
+static const char PROGMEM HuntStrSuite[] = "SUITE: ";
+static const char PROGMEM HuntStrSuiteTests[] = " tests in ";
+static const char PROGMEM HuntStrSuiteMean[] = ", mean ";
+static const char PROGMEM HuntStrDurations[] = "DURATIONS: ";
+#endif
+#ifdef HUNT_USE_TIME_BUDGETS
+static const char PROGMEM HuntStrExecTimeBelow[] = "Exec Time Below ";
+static const char PROGMEM HuntStrErrTimeBudget[] = " Exceeded Time Budget of ";
+static const char PROGMEM HuntStrTook[] = ", Took ";
+#endif
 static const char PROGMEM HuntStrDetail1Name[] = HUNT_DETAIL1_NAME " ";
 static const char PROGMEM HuntStrDetail2Name[] = " " HUNT_DETAIL2_NAME " ";
 
@@ -540,6 +826,18 @@ static void HuntTestResultsFailBegin(const HUNT_LINE_TYPE line) {
 
 /*-----------------------------------------------*/
 void HuntConcludeTest(void) {
+#ifdef HUNT_USE_TIME_BUDGETS
+  HuntCheckTimeBudget();
+#endif
+#ifdef HUNT_USE_SLOWEST_TESTS
+  HuntRecordTestTime();
+#endif
+#ifdef HUNT_USE_TRACE
+  HuntTraceTestStop();
+#endif
+#ifdef HUNT_USE_PROFILER
+  HuntProfileWrite();
+#endif
   if (Hunt.CurrentTestIgnored) {
     Hunt.TestIgnores++;
   } else if (!Hunt.CurrentTestFailed) {
@@ -552,6 +850,9 @@ void HuntConcludeTest(void) {
   Hunt.CurrentTestFailed = 0;
   Hunt.CurrentTestIgnored = 0;
   HUNT_PRINT_EXEC_TIME();
+  HUNT_PRINT_PERF_COUNTERS();
+  HUNT_PRINT_RUSAGE();
+  HUNT_PRINT_PHASE_TIMES();
   HUNT_PRINT_EOL();
   HUNT_FLUSH_CALL();
 }
@@ -1556,182 +1857,2979 @@ void HuntDefaultTestRun(HuntTestFunction Func, const char *FuncName, const int F
   Hunt.CurrentTestLineNumber = (HUNT_LINE_TYPE) FuncLineNum;
   Hunt.NumberOfTests++;
   HUNT_CLR_DETAILS();
+  HUNT_TRACE_TEST_START();
+  HUNT_RUSAGE_START();
   HUNT_EXEC_TIME_START();
+  HUNT_PERF_COUNTERS_START();
   if (TEST_PROTECT()) {
+    HUNT_PHASE_START(HUNT_PHASE_SETUP);
     setUp();
+    HUNT_PHASE_START(HUNT_PHASE_TEST);
     Func();
   }
   if (TEST_PROTECT()) {
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN);
     tearDown();
   }
+  HUNT_PHASE_STOP();
+  HUNT_PERF_COUNTERS_STOP();
   HUNT_EXEC_TIME_STOP();
+  HUNT_RUSAGE_STOP();
   HuntConcludeTest();
 }
 
+#ifdef HUNT_USE_PARAMS_CASES
+#ifndef HUNT_EXCLUDE_SETJMP_H
 /*-----------------------------------------------*/
-void HuntBegin(const char *filename) {
-  Hunt.TestFile = filename;
-  Hunt.CurrentTestName = NULL;
-  Hunt.CurrentTestLineNumber = 0;
-  Hunt.NumberOfTests = 0;
-  Hunt.TestFailures = 0;
-  Hunt.TestIgnores = 0;
-  Hunt.CurrentTestFailed = 0;
-  Hunt.CurrentTestIgnored = 0;
-
-  HUNT_CLR_DETAILS();
-  HUNT_OUTPUT_START();
+static void HuntCopyBytes(void *dst, const void *src, HUNT_UINT length) {
+  char *d = (char *) dst;
+  const char *s = (const char *) src;
+  while (length-- > 0) {
+    *d++ = *s++;
+  }
 }
+#endif
 
 /*-----------------------------------------------*/
-int HuntEnd(void) {
-  HUNT_PRINT_EOL();
-  HuntPrint(HuntStrBreaker);
-  HUNT_PRINT_EOL();
-  HuntPrintNumber((HUNT_INT) (Hunt.NumberOfTests));
-  HuntPrint(HuntStrResultsTests);
-  HuntPrintNumber((HUNT_INT) (Hunt.TestFailures));
-  HuntPrint(HuntStrResultsFailures);
-  HuntPrintNumber((HUNT_INT) (Hunt.TestIgnores));
-  HuntPrint(HuntStrResultsIgnored);
-  HUNT_PRINT_EOL();
-  if (Hunt.TestFailures == 0U) {
-    HuntPrint(HuntStrOk);
-  } else {
-    HuntPrint(HuntStrFail);
-#ifdef HUNT_DIFFERENTIATE_FINAL_FAIL
-    HUNT_OUTPUT_CHAR('E'); HUNT_OUTPUT_CHAR('D');
-#endif
+/* Appends a string to the name of a parameterized case, truncating it if needed. */
+static HUNT_UINT HuntParamsAppend(HUNT_UINT length, const char *string) {
+  while ((*string != 0) && (length < (HUNT_PARAMS_NAME_LENGTH - 2))) {
+    HuntParamsName[length++] = *string++;
   }
-  HUNT_PRINT_EOL();
-  HUNT_FLUSH_CALL();
-  HUNT_OUTPUT_COMPLETE();
-  return (int) (Hunt.TestFailures);
+  HuntParamsName[length] = 0;
+  return length;
 }
 
-/*-----------------------------------------------
- * Command Line Argument Support
- *-----------------------------------------------*/
-#ifdef HUNT_USE_COMMAND_LINE_ARGS
+/*-----------------------------------------------*/
+static HUNT_UINT HuntParamsAppendNumber(HUNT_UINT length, const HUNT_INT number) {
+  char digits[24];
+  int i = (int) sizeof(digits) - 1;
+  HUNT_UINT value = (number < 0) ? ((~((HUNT_UINT) number)) + 1) : (HUNT_UINT) number;
 
-char* HuntOptionIncludeNamed = NULL;
-char* HuntOptionExcludeNamed = NULL;
-int HuntVerbosity            = 1;
+  digits[i] = 0;
+  do {
+    digits[--i] = (char) ('0' + (value % 10));
+    value /= 10;
+  } while ((value > 0) && (i > 1));
+  if (number < 0) {
+    digits[--i] = '-';
+  }
+  return HuntParamsAppend(length, &digits[i]);
+}
 
 /*-----------------------------------------------*/
-int HuntParseOptions(int argc, char** argv)
-{
-    HuntOptionIncludeNamed = NULL;
-    HuntOptionExcludeNamed = NULL;
-    int i;
+/* Starts naming a case of a parameterized test "test[...]". */
+static HUNT_UINT HuntParamsNameBegin(const char *name) {
+  return HuntParamsAppend(HuntParamsAppend(0, name), "[");
+}
 
-    for (i = 1; i < argc; i++)
-    {
-        if (argv[i][0] == '-')
-        {
-            switch (argv[i][1])
-            {
-                case 'l': /* list tests */
-                    return -1;
-                case 'n': /* include tests with name including this string */
-                case 'f': /* an alias for -n */
-                    if (argv[i][2] == '=')
-                    {
-                        HuntOptionIncludeNamed = &argv[i][3];
-                    }
-                    else if (++i < argc)
-                    {
-                        HuntOptionIncludeNamed = argv[i];
-                    }
-                    else
-                    {
-                        HuntPrint("ERROR: No Test String to Include Matches For");
-                        HUNT_PRINT_EOL();
-                        return 1;
-                    }
-                    break;
-                case 'q': /* quiet */
-                    HuntVerbosity = 0;
-                    break;
-                case 'v': /* verbose */
-                    HuntVerbosity = 2;
-                    break;
-                case 'x': /* exclude tests with name including this string */
-                    if (argv[i][2] == '=')
-                    {
-                        HuntOptionExcludeNamed = &argv[i][3];
-                    }
-                    else if (++i < argc)
-                    {
-                        HuntOptionExcludeNamed = argv[i];
-                    }
-                    else
-                    {
-                        HuntPrint("ERROR: No Test String to Exclude Matches For");
-                        HUNT_PRINT_EOL();
-                        return 1;
-                    }
-                    break;
-                default:
-                    HuntPrint("ERROR: Unknown Option ");
-                    HUNT_OUTPUT_CHAR(argv[i][1]);
-                    HUNT_PRINT_EOL();
-                    return 1;
-            }
-        }
-    }
+/*-----------------------------------------------*/
+static const char* HuntParamsNameEnd(HUNT_UINT length) {
+  HuntParamsName[length] = ']';
+  HuntParamsName[length + 1] = 0;
+  return HuntParamsName;
+}
 
-    return 0;
+/*-----------------------------------------------*/
+/* Each case gets its own abort frame, the test's own frame is restored afterwards. */
+static void HuntParamsBegin(void) {
+  HuntParamsTestName = Hunt.CurrentTestName;
+  HuntParamsFailures = 0;
+  HuntParamsIgnores = 0;
+#ifndef HUNT_EXCLUDE_SETJMP_H
+  HuntCopyBytes(HuntParamsFrame, Hunt.AbortFrame, sizeof(jmp_buf));
+#endif
 }
 
 /*-----------------------------------------------*/
-int IsStringInBiggerString(const char* longstring, const char* shortstring)
-{
-    const char* lptr = longstring;
-    const char* sptr = shortstring;
-    const char* lnext = lptr;
+static void HuntParamsCase(HuntParamsFunction Func, const void *param, const char *name) {
+  Hunt.CurrentTestName = name;
+  HUNT_TRACE_BEGIN(name, "case");
+  if (TEST_PROTECT()) {
+    Func(param);
+  }
+  HUNT_TRACE_END();
+  if (Hunt.CurrentTestFailed) {
+    HuntParamsFailures++;
+    HUNT_PRINT_EOL();
+  } else if (Hunt.CurrentTestIgnored) {
+    HuntParamsIgnores++;
+    HUNT_PRINT_EOL();
+  }
+  Hunt.CurrentTestFailed = 0;
+  Hunt.CurrentTestIgnored = 0;
+}
 
-    if (*sptr == '*')
-    {
-        return 1;
-    }
+/*-----------------------------------------------*/
+/* The test itself fails if any case failed, and is ignored if every case was. */
+static void HuntParamsEnd(const HUNT_UINT count) {
+#ifndef HUNT_EXCLUDE_SETJMP_H
+  HuntCopyBytes(Hunt.AbortFrame, HuntParamsFrame, sizeof(jmp_buf));
+#endif
+  Hunt.CurrentTestName = HuntParamsTestName;
 
-    while (*lptr)
-    {
-        lnext = lptr + 1;
+  if (HuntParamsFailures > 0) {
+    HuntTestResultsFailBegin(Hunt.CurrentTestLineNumber);
+    HUNT_OUTPUT_CHAR(' ');
+    HuntPrintNumberUnsigned(HuntParamsFailures);
+    HuntPrint(HuntStrParamsOf);
+    HuntPrintNumberUnsigned(count);
+    HuntPrint(HuntStrParamsFailed);
+    Hunt.CurrentTestFailed = 1;
+  } else if ((count > 0) && (HuntParamsIgnores == count)) {
+    HuntTestResultsBegin(Hunt.TestFile, Hunt.CurrentTestLineNumber);
+    HuntPrint(HuntStrIgnore);
+    Hunt.CurrentTestIgnored = 1;
+  }
+}
+#endif
 
-        /* If they current bytes match, go on to the next bytes */
-        while (*lptr && *sptr && (*lptr == *sptr))
-        {
-            lptr++;
-            sptr++;
+/*-----------------------------------------------*/
+void HuntRunParams(HuntParamsFunction Func, HuntParamsFormatter Formatter,
+                   const void *table, const HUNT_UINT size, const HUNT_UINT count) {
+#ifndef HUNT_INCLUDE_PARAMS
+  (void) Func;
+  (void) Formatter;
+  (void) table;
+  (void) size;
+  (void) count;
+  HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrParams);
+#else
+  const char *param;
+  HUNT_UINT length;
+  HUNT_UINT i;
+
+  HuntParamsBegin();
+  for (i = 0; i < count; i++) {
+    param = (const char *) table + (i * size);
+    length = HuntParamsNameBegin(HuntParamsTestName);
+    if (Formatter != NULL) {
+      length = HuntParamsAppend(length, Formatter(param));
+    } else {
+      length = HuntParamsAppendNumber(length, (HUNT_INT) i);
+    }
+    HuntParamsCase(Func, param, HuntParamsNameEnd(length));
+  }
+  HuntParamsEnd(count);
+#endif
+}
 
-            /* We're done if we match the entire string or up to a wildcard */
-            if (*sptr == '*')
-                return 1;
-            if (*sptr == ',')
-                return 1;
-            if (*sptr == '"')
-                return 1;
-            if (*sptr == '\'')
-                return 1;
-            if (*sptr == ':')
-                return 2;
-            if (*sptr == 0)
-                return 1;
-        }
+#ifdef HUNT_INCLUDE_PARAMS
+/*-----------------------------------------------*/
+static HUNT_INT HuntAxisValue(const HuntAxis *axis, const HUNT_UINT index) {
+  if (axis->Values != NULL) {
+    return axis->Values[index];
+  }
+  return axis->First + ((HUNT_INT) index * axis->Step);
+}
 
-        /* Otherwise we start in the long pointer 1 character further and try again */
-        lptr = lnext;
-        sptr = shortstring;
+/*-----------------------------------------------*/
+/* Runs the combination picked by index[], naming the case after its values "test[1,64,-2]". */
+static void HuntCombinationCase(HuntParamsFunction Func, const HuntAxis *axes, const HUNT_UINT count,
+                                const HUNT_UINT *index, HUNT_INT *values) {
+  HUNT_UINT length = HuntParamsNameBegin(HuntParamsTestName);
+  HUNT_UINT i;
+
+  for (i = 0; i < count; i++) {
+    values[i] = HuntAxisValue(&axes[i], index[i]);
+    if (i > 0) {
+      length = HuntParamsAppend(length, ",");
     }
-
-    return 0;
+    length = HuntParamsAppendNumber(length, values[i]);
+  }
+  HuntParamsCase(Func, values, HuntParamsNameEnd(length));
 }
 
 /*-----------------------------------------------*/
-int HuntStringArgumentMatches(const char* str)
-{
+/* Counts index[] up like an odometer, returns 0 once every combination was visited. */
+static int HuntNextCombination(HUNT_UINT *index, const HuntAxis *axes, const HUNT_UINT count) {
+  HUNT_UINT i = count;
+
+  while (i-- > 0) {
+    if (++index[i] < axes[i].Count) {
+      return 1;
+    }
+    index[i] = 0;
+  }
+  return 0;
+}
+
+/*-----------------------------------------------*/
+/* Bit of the pair (value va of axis a, value vb of axis b) in HuntPairsCovered. */
+static HUNT_UINT HuntPairBit(HUNT_UINT offsets[][HUNT_COMBINATIONS_MAX_AXES], const HuntAxis *axes,
+                             HUNT_UINT a, HUNT_UINT va, HUNT_UINT b, HUNT_UINT vb) {
+  if (a > b) {
+    HUNT_UINT swap = a; a = b; b = swap;
+    swap = va; va = vb; vb = swap;
+  }
+  return offsets[a][b] + (va * axes[b].Count) + vb;
+}
+
+#define HUNT_PAIR_IS_COVERED(bit) (HuntPairsCovered[(bit) / 8] & (1u << ((bit) % 8)))
+#define HUNT_PAIR_SET_COVERED(bit) (HuntPairsCovered[(bit) / 8] |= (unsigned char) (1u << ((bit) % 8)))
+
+/*-----------------------------------------------*/
+/* Greedy all-pairs: every new case starts from the first pair not yet covered,
+ * then each remaining axis takes the value covering the most new pairs. */
+static HUNT_UINT HuntRunPairwise(HuntParamsFunction Func, const HuntAxis *axes, const HUNT_UINT count,
+                                 HUNT_UINT *index, HUNT_INT *values) {
+  HUNT_UINT offsets[HUNT_COMBINATIONS_MAX_AXES][HUNT_COMBINATIONS_MAX_AXES];
+  int chosen[HUNT_COMBINATIONS_MAX_AXES];
+  HUNT_UINT pairs = 0;
+  HUNT_UINT remaining;
+  HUNT_UINT first = 0;
+  HUNT_UINT cases = 0;
+  HUNT_UINT a, b, k, m, v, bit;
+
+  for (a = 0; a < count; a++) {
+    for (b = a + 1; b < count; b++) {
+      offsets[a][b] = pairs;
+      pairs += axes[a].Count * axes[b].Count;
+    }
+  }
+  if (pairs > HUNT_PAIRWISE_MAX_PAIRS) {
+    HuntParamsEnd(0);
+    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, HuntStrErrPairwise);
+    return 0; /* without setjmp.h the test goes on after failing */
+  }
+  for (bit = 0; bit < ((pairs + 7) / 8); bit++) {
+    HuntPairsCovered[bit] = 0;
+  }
+
+  remaining = pairs;
+  while (remaining > 0) {
+    /* seed this case with the first pair still missing */
+    while (HUNT_PAIR_IS_COVERED(first)) {
+      first++;
+    }
+    for (k = 0; k < count; k++) {
+      chosen[k] = 0;
+    }
+    for (a = 0; a < count; a++) {
+      for (b = a + 1; b < count; b++) {
+        if ((first >= offsets[a][b]) && (first < offsets[a][b] + (axes[a].Count * axes[b].Count))) {
+          index[a] = (first - offsets[a][b]) / axes[b].Count;
+          index[b] = (first - offsets[a][b]) % axes[b].Count;
+          chosen[a] = 1;
+          chosen[b] = 1;
+          break;
+        }
+      }
+      if (chosen[a]) {
+        break;
+      }
+    }
+
+    /* fill in the other axes, each with its most useful value */
+    for (k = 0; k < count; k++) {
+      HUNT_UINT best = 0;
+      HUNT_UINT bestNew = 0;
+      if (chosen[k]) {
+        continue;
+      }
+      for (v = 0; v < axes[k].Count; v++) {
+        HUNT_UINT newPairs = 0;
+        for (m = 0; m < count; m++) {
+          if (chosen[m] && !HUNT_PAIR_IS_COVERED(HuntPairBit(offsets, axes, k, v, m, index[m]))) {
+            newPairs++;
+          }
+        }
+        if ((v == 0) || (newPairs > bestNew)) {
+          best = v;
+          bestNew = newPairs;
+        }
+      }
+      index[k] = best;
+      chosen[k] = 1;
+    }
+
+    for (a = 0; a < count; a++) {
+      for (b = a + 1; b < count; b++) {
+        bit = HuntPairBit(offsets, axes, a, index[a], b, index[b]);
+        if (!HUNT_PAIR_IS_COVERED(bit)) {
+          HUNT_PAIR_SET_COVERED(bit);
+          remaining--;
+        }
+      }
+    }
+    HuntCombinationCase(Func, axes, count, index, values);
+    cases++;
+  }
+  return cases;
+}
+#endif
+
+/*-----------------------------------------------*/
+void HuntRunCombinations(HuntParamsFunction Func, const HuntAxis *axes, const HUNT_UINT count,
+                         const HUNT_COMBINATION_T mode) {
+#ifndef HUNT_INCLUDE_PARAMS
+  (void) Func;
+  (void) axes;
+  (void) count;
+  (void) mode;
+  HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrParams);
+#else
+  HUNT_UINT index[HUNT_COMBINATIONS_MAX_AXES];
+  HUNT_INT values[HUNT_COMBINATIONS_MAX_AXES];
+  HUNT_UINT cases = 0;
+  HUNT_UINT i;
+
+  if (count > HUNT_COMBINATIONS_MAX_AXES) {
+    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, HuntStrErrAxes);
+    return; /* without setjmp.h the test goes on after failing */
+  }
+  for (i = 0; i < count; i++) {
+    if (axes[i].Count == 0) {
+      HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrEmptyAxis);
+      return;
+    }
+    index[i] = 0;
+  }
+
+  HuntParamsBegin();
+  if ((mode == HUNT_PAIRWISE) && (count > 2)) {
+    cases = HuntRunPairwise(Func, axes, count, index, values);
+  } else {
+    /* with two axes or less, every pair is a combination anyway */
+    do {
+      HuntCombinationCase(Func, axes, count, index, values);
+      cases++;
+    } while (HuntNextCombination(index, axes, count));
+  }
+  HuntParamsEnd(cases);
+#endif
+}
+
+/*-----------------------------------------------
+ * Clock
+ *-----------------------------------------------*/
+
+#if defined(HUNT_USE_HOST_CLOCK_NS) || defined(HUNT_USE_HOST_CLOCK_MS)
+#ifdef _WIN32
+/*-----------------------------------------------*/
+/* The performance counter, which unlike timespec_get() never steps with the wall clock */
+static void HuntClockRead(HUNT_UINT *seconds, HUNT_UINT *nanoseconds) {
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER now;
+
+  if (frequency.QuadPart == 0) {
+    (void) QueryPerformanceFrequency(&frequency);
+  }
+  (void) QueryPerformanceCounter(&now);
+  *seconds = (HUNT_UINT) (now.QuadPart / frequency.QuadPart);
+  *nanoseconds = (HUNT_UINT) (((now.QuadPart % frequency.QuadPart) * 1000000000) / frequency.QuadPart);
+}
+#else
+/*-----------------------------------------------*/
+static void HuntClockRead(HUNT_UINT *seconds, HUNT_UINT *nanoseconds) {
+  struct timespec now;
+
+  (void) clock_gettime(HUNT_CLOCK_SOURCE, &now);
+  *seconds = (HUNT_UINT) now.tv_sec;
+  *nanoseconds = (HUNT_UINT) now.tv_nsec;
+}
+#endif
+#endif
+
+#ifdef HUNT_USE_HOST_CLOCK_NS
+/*-----------------------------------------------*/
+HUNT_UINT HuntClockNs(void) {
+  HUNT_UINT seconds, nanoseconds;
+
+  HuntClockRead(&seconds, &nanoseconds);
+  return (seconds * 1000000000u) + nanoseconds;
+}
+#endif
+
+#ifdef HUNT_USE_HOST_CLOCK_MS
+/*-----------------------------------------------*/
+HUNT_UINT HuntClockMs(void) {
+  HUNT_UINT seconds, nanoseconds;
+
+  HuntClockRead(&seconds, &nanoseconds);
+  return (seconds * 1000u) + (nanoseconds / 1000000u);
+}
+#endif
+
+#if defined(HUNT_USE_DURATIONS) || defined(HUNT_USE_SLOWEST_TESTS)
+/*-----------------------------------------------*/
+/* Prints dividend / divisor with two decimals. */
+static void HuntPrintQuotient(const HUNT_UINT dividend, const HUNT_UINT divisor) {
+  HUNT_UINT hundredths = (((dividend % divisor) * 100) + (divisor / 2)) / divisor;
+  HUNT_UINT whole = (dividend / divisor) + (hundredths / 100);
+
+  HuntPrintNumberUnsigned(whole);
+  HUNT_OUTPUT_CHAR('.');
+  HUNT_OUTPUT_CHAR((char) ('0' + ((hundredths % 100) / 10)));
+  HUNT_OUTPUT_CHAR((char) ('0' + (hundredths % 10)));
+}
+#endif
+
+#if defined(HUNT_USE_EXEC_TIME_NS) || defined(HUNT_INCLUDE_BENCHMARK) || defined(HUNT_INCLUDE_PHASE_TIMES)
+/*-----------------------------------------------*/
+/* The least time between two readings of the clock, which every exec time and every timed
+ * iteration of a cold benchmark includes once. */
+static HUNT_UINT HuntClockOverhead(void) {
+  HUNT_UINT i, start, elapsed;
+  HUNT_UINT overhead = 0;
+
+  for (i = 0; i < HUNT_EXEC_TIME_CALIBRATIONS; i++) {
+    start = (HUNT_UINT) HUNT_CLOCK_NS();
+    elapsed = (HUNT_UINT) HUNT_CLOCK_NS() - start;
+    if ((i == 0) || (elapsed < overhead)) {
+      overhead = elapsed;
+    }
+  }
+  return overhead;
+}
+#endif
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+/*-----------------------------------------------*/
+/* Where HuntDoNotOptimize() leaves its value, so that the compiler can't prove it unused */
+static const volatile void * volatile HuntOptimizerSink;
+
+void HuntDoNotOptimize(const volatile void *value) {
+  HuntOptimizerSink = value;
+}
+
+/*-----------------------------------------------*/
+void HuntClobberMemory(void) {
+  HuntOptimizerSink = HuntOptimizerSink;
+}
+#endif
+
+#ifdef HUNT_USE_DURATIONS
+/*-----------------------------------------------*/
+static HUNT_UINT HuntExecTimeWithoutOverhead(const HUNT_UINT elapsed) {
+  return (elapsed > HuntExecTimeOverhead) ? (elapsed - HuntExecTimeOverhead) : 0;
+}
+#endif
+
+/* The overhead is in nanoseconds, which exec times in milliseconds don't take off */
+#ifdef HUNT_USE_EXEC_TIME_NS
+#define HUNT_EXEC_TIME_ELAPSED(elapsed) HuntExecTimeWithoutOverhead(elapsed)
+#else
+#define HUNT_EXEC_TIME_ELAPSED(elapsed) (elapsed)
+#endif
+
+#ifdef HUNT_USE_DURATIONS
+/*-----------------------------------------------*/
+/* Prints "412 ns", "1.25 us", "12.50 ms" or "2.00 s". */
+static void HuntPrintDuration(const HUNT_UINT time) {
+  if (time < 1000u) {
+    HuntPrintNumberUnsigned(time);
+    HuntPrint(" ns");
+  } else if (time < 1000000u) {
+    HuntPrintQuotient(time, 1000u);
+    HuntPrint(" us");
+  } else if (time < 1000000000u) {
+    HuntPrintQuotient(time, 1000000u);
+    HuntPrint(" ms");
+  } else {
+    HuntPrintQuotient(time, 1000000000u);
+    HuntPrint(" s");
+  }
+}
+
+/*-----------------------------------------------*/
+/* Prints " (412 ns)", " (1.25 us)", " (12.50 ms)" or " (2.00 s)". */
+void HuntPrintExecTime(const HUNT_UINT elapsed) {
+  HuntPrint(" (");
+  HuntPrintDuration(HuntExecTimeWithoutOverhead(elapsed));
+  HUNT_OUTPUT_CHAR(')');
+}
+#endif
+
+#ifdef HUNT_USE_TIME_BUDGETS
+/*-----------------------------------------------*/
+/* Exec times are kept in nanoseconds, or in milliseconds of HUNT_CLOCK_MS() */
+static void HuntPrintExecTimeUnits(const HUNT_UINT time) {
+#ifdef HUNT_USE_EXEC_TIME_NS
+  HuntPrintDuration(time);
+#else
+  HuntPrintNumberUnsigned(time);
+  HuntPrint(" ms");
+#endif
+}
+
+/*-----------------------------------------------*/
+/* Scales in two parts, so that budgets of seconds in nanoseconds don't overflow 32 bits */
+static HUNT_UINT HuntScaleTimeBudget(const HUNT_UINT budget) {
+  return ((budget / 100u) * HuntTimeBudgetScale) + (((budget % 100u) * HuntTimeBudgetScale) / 100u);
+}
+
+/*-----------------------------------------------*/
+void HuntAssertExecTimeBelow(const HUNT_UINT budget,
+                             const char *msg,
+                             const HUNT_LINE_TYPE lineNumber) {
+  HUNT_UINT allowed;
+  HUNT_UINT elapsed;
+
+  RETURN_IF_FAIL_OR_IGNORE;
+
+  allowed = HuntScaleTimeBudget(budget);
+  elapsed = HUNT_EXEC_TIME_ELAPSED((HUNT_UINT) (HUNT_EXEC_TIME_NOW() - Hunt.CurrentTestStartTime));
+  if (elapsed >= allowed) {
+    HuntTestResultsFailBegin(lineNumber);
+    HuntPrint(HuntStrExpected);
+    HuntPrint(HuntStrExecTimeBelow);
+    HuntPrintExecTimeUnits(allowed);
+    HuntPrint(HuntStrWas);
+    HuntPrintExecTimeUnits(elapsed);
+    HuntAddMsgIfSpecified(msg);
+    HUNT_FAIL_AND_BAIL;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Fails a test that passed but took longer than the budget given by TEST_TIME_BUDGET, once
+ * its exec time is stopped. Each budget only holds for the test it was set for. */
+void HuntCheckTimeBudget(void) {
+  HUNT_UINT allowed;
+  HUNT_UINT elapsed;
+
+  if ((Hunt.CurrentTestBudget == 0) || Hunt.CurrentTestFailed || Hunt.CurrentTestIgnored) {
+    Hunt.CurrentTestBudget = 0;
+    return;
+  }
+  allowed = HuntScaleTimeBudget(Hunt.CurrentTestBudget);
+  elapsed = HUNT_EXEC_TIME_ELAPSED((HUNT_UINT) (Hunt.CurrentTestStopTime - Hunt.CurrentTestStartTime));
+  Hunt.CurrentTestBudget = 0;
+  if (elapsed > allowed) {
+    HuntTestResultsFailBegin(Hunt.CurrentTestLineNumber);
+    HuntPrint(HuntStrErrTimeBudget);
+    HuntPrintExecTimeUnits(allowed);
+    HuntPrint(HuntStrTook);
+    HuntPrintExecTimeUnits(elapsed);
+    Hunt.CurrentTestFailed = 1;
+  }
+}
+#endif
+
+#ifdef HUNT_USE_SLOWEST_TESTS
+/*-----------------------------------------------*/
+/* Labels of HuntTestDurations, a decade each */
+static const char * const HuntDurationNames[8] = {
+  "<1 us ", "<10 us ", "<100 us ", "<1 ms ", "<10 ms ", "<100 ms ", "<1 s ", ">=1 s "
+};
+
+/*-----------------------------------------------*/
+static void HuntSlowestSiftDown(HUNT_UINT index, const HUNT_UINT count) {
+  HuntTestTime swap;
+  HUNT_UINT child;
+
+  while ((child = (index * 2) + 1) < count) {
+    if (((child + 1) < count) && (HuntSlowestTests[child + 1].Time < HuntSlowestTests[child].Time)) {
+      child++;
+    }
+    if (HuntSlowestTests[index].Time <= HuntSlowestTests[child].Time) {
+      break;
+    }
+    swap = HuntSlowestTests[index];
+    HuntSlowestTests[index] = HuntSlowestTests[child];
+    HuntSlowestTests[child] = swap;
+    index = child;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Keeps the exec time of the test that concludes, if it ran. Takes constant memory: a test
+ * only enters the heap of the slowest ones by pushing out the fastest of them. */
+void HuntRecordTestTime(void) {
+  HuntTestTime test;
+  HUNT_UINT time;
+  HUNT_UINT index;
+  HUNT_UINT limit = 1000u;
+
+  if (Hunt.CurrentTestIgnored) {
+    return;
+  }
+  time = HUNT_EXEC_TIME_ELAPSED((HUNT_UINT) (Hunt.CurrentTestStopTime - Hunt.CurrentTestStartTime));
+  HuntTestTimeTotal += time;
+  HuntTestTimeCount++;
+#ifdef HUNT_USE_EXEC_TIME_NS
+  for (index = 0; (index < 7) && (time >= limit); index++) {
+    limit *= 10u;
+  }
+#else
+  limit = 1u;
+  for (index = 3; (index < 7) && (time >= limit); index++) {
+    limit *= 10u;
+  }
+#endif
+  HuntTestDurations[index]++;
+
+  test.File = Hunt.TestFile;
+  test.Name = Hunt.CurrentTestName;
+  test.Line = Hunt.CurrentTestLineNumber;
+  test.Time = time;
+  if (HuntSlowestCount < HUNT_SLOWEST_TESTS) {
+    /* sift the new test up from the bottom of the heap */
+    index = HuntSlowestCount++;
+    while ((index > 0) && (HuntSlowestTests[(index - 1) / 2].Time > time)) {
+      HuntSlowestTests[index] = HuntSlowestTests[(index - 1) / 2];
+      index = (index - 1) / 2;
+    }
+    HuntSlowestTests[index] = test;
+  } else if (time > HuntSlowestTests[0].Time) {
+    HuntSlowestTests[0] = test;
+    HuntSlowestSiftDown(0, HuntSlowestCount);
+  }
+}
+
+/*-----------------------------------------------*/
+/* Share of part in total in hundredths of a percent, halving both until part * 10000 fits */
+static HUNT_UINT HuntShareOfTotal(HUNT_UINT part, HUNT_UINT total) {
+  while (part > (((HUNT_UINT) -1) / 10000u)) {
+    part >>= 1;
+    total >>= 1;
+  }
+  return (total > 0) ? ((part * 10000u) / total) : 0;
+}
+
+/*-----------------------------------------------*/
+/* Prints the slowest tests from the slowest down, then the count, total and mean exec time
+ * of all tests and how many took how long. Sorts the heap in place, so it is printed once. */
+static void HuntPrintTestTimes(void) {
+  HuntTestTime swap;
+  HUNT_UINT i;
+
+  for (i = HuntSlowestCount; i > 1; i--) {
+    swap = HuntSlowestTests[0];
+    HuntSlowestTests[0] = HuntSlowestTests[i - 1];
+    HuntSlowestTests[i - 1] = swap;
+    HuntSlowestSiftDown(0, i - 1);
+  }
+  for (i = 0; i < HuntSlowestCount; i++) {
+    HuntPrint(HuntSlowestTests[i].File);
+    HUNT_OUTPUT_CHAR(':');
+    HuntPrintNumber((HUNT_INT) HuntSlowestTests[i].Line);
+    HUNT_OUTPUT_CHAR(':');
+    HuntPrint(HuntSlowestTests[i].Name);
+    HUNT_OUTPUT_CHAR(':');
+    HuntPrint(HuntStrSlow);
+    HuntPrintExecTimeUnits(HuntSlowestTests[i].Time);
+    HuntPrint(", ");
+    HuntPrintQuotient(HuntShareOfTotal(HuntSlowestTests[i].Time, HuntTestTimeTotal), 100u);
+    HuntPrint(HuntStrSlowShare);
+    HUNT_PRINT_EOL();
+  }
+
+  HuntPrint(HuntStrSuite);
+  HuntPrintNumberUnsigned(HuntTestTimeCount);
+  HuntPrint(HuntStrSuiteTests);
+  HuntPrintExecTimeUnits(HuntTestTimeTotal);
+  HuntPrint(HuntStrSuiteMean);
+  HuntPrintExecTimeUnits((HuntTestTimeCount > 0) ? (HuntTestTimeTotal / HuntTestTimeCount) : 0);
+  HUNT_PRINT_EOL();
+
+  HuntPrint(HuntStrDurations);
+  for (i = 0; i < 8; i++) {
+    if (i > 0) {
+      HuntPrint(", ");
+    }
+    HuntPrint(HuntDurationNames[i]);
+    HuntPrintNumberUnsigned(HuntTestDurations[i]);
+  }
+  HUNT_PRINT_EOL();
+}
+#endif
+
+/*-----------------------------------------------
+ * Trace
+ *-----------------------------------------------*/
+
+#ifdef HUNT_USE_TRACE
+/* Room kept in the buffer for one event, whose strings are cut short to fit */
+#define HUNT_TRACE_EVENT_MAX 1024
+#define HUNT_TRACE_STRING_MAX 200
+
+/*-----------------------------------------------*/
+/* Writes the buffered events with a single write, so runners that append to one file don't mix them up */
+static void HuntTraceFlush(void) {
+  if (HuntTraceLength > 0) {
+    (void) fwrite(HuntTraceBuffer, 1, (size_t) HuntTraceLength, HuntTraceFile);
+    HuntTraceLength = 0;
+  }
+}
+
+/*-----------------------------------------------*/
+static void HuntTraceAppend(const char *text) {
+  while (*text != 0) {
+    HuntTraceBuffer[HuntTraceLength++] = *text++;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Appends a JSON string, leaving out control characters */
+static void HuntTraceAppendString(const char *text) {
+  HUNT_UINT count = 0;
+
+  HuntTraceBuffer[HuntTraceLength++] = '"';
+  while ((text != NULL) && (*text != 0) && (count++ < HUNT_TRACE_STRING_MAX)) {
+    if ((*text == '"') || (*text == '\\')) {
+      HuntTraceBuffer[HuntTraceLength++] = '\\';
+    }
+    if ((unsigned char) *text >= 0x20) {
+      HuntTraceBuffer[HuntTraceLength++] = *text;
+    }
+    text++;
+  }
+  HuntTraceBuffer[HuntTraceLength++] = '"';
+}
+
+/*-----------------------------------------------*/
+/* Appends a number with at least width digits, padded with zeros */
+static void HuntTraceAppendNumber(unsigned long number, int width) {
+  char digits[24];
+  int i = (int) sizeof(digits);
+
+  do {
+    digits[--i] = (char) ('0' + (number % 10));
+    number /= 10;
+    width--;
+  } while ((number > 0) || (width > 0));
+  while (i < (int) sizeof(digits)) {
+    HuntTraceBuffer[HuntTraceLength++] = digits[i++];
+  }
+}
+
+/*-----------------------------------------------*/
+/* Starts an event up to its arguments, an end event has no name. Timestamps are the
+ * microseconds of CLOCK_MONOTONIC, which every process shares, so runners line up. */
+static void HuntTraceEventBegin(const char *name, const char *category, const char phase) {
+  struct timespec now;
+  unsigned long micros;
+
+  if (HuntTraceLength > (HUNT_TRACE_BUFFER_SIZE - HUNT_TRACE_EVENT_MAX)) {
+    HuntTraceFlush();
+  }
+  (void) clock_gettime(CLOCK_MONOTONIC, &now);
+  micros = (unsigned long) now.tv_nsec / 1000;
+
+  HuntTraceBuffer[HuntTraceLength++] = '{';
+  if (name != NULL) {
+    HuntTraceAppend("\"name\":");
+    HuntTraceAppendString(name);
+    HuntTraceAppend(",\"cat\":");
+    HuntTraceAppendString(category);
+    HuntTraceBuffer[HuntTraceLength++] = ',';
+  }
+  HuntTraceAppend("\"ph\":\"");
+  HuntTraceBuffer[HuntTraceLength++] = phase;
+  HuntTraceAppend("\",\"ts\":");
+  if (now.tv_sec > 0) {
+    HuntTraceAppendNumber((unsigned long) now.tv_sec, 0);
+    HuntTraceAppendNumber(micros, 6);
+  } else {
+    HuntTraceAppendNumber(micros, 0);
+  }
+  HuntTraceBuffer[HuntTraceLength++] = '.';
+  HuntTraceAppendNumber((unsigned long) now.tv_nsec % 1000, 3);
+  HuntTraceAppend(",\"pid\":");
+  HuntTraceAppendNumber(HuntTracePid, 0);
+  HuntTraceAppend(",\"tid\":");
+  HuntTraceAppendNumber(HuntTraceTid, 0);
+}
+
+/*-----------------------------------------------*/
+/* Every event ends in a comma, the closing bracket of the array may be left out of the file */
+static void HuntTraceEventEnd(void) {
+  HuntTraceAppend("},\n");
+}
+
+/*-----------------------------------------------*/
+/* Ends the spans begun since there were depth of them, those a failure jumped over included */
+static void HuntTraceEndTo(const HUNT_UINT depth) {
+  while (HuntTraceDepth > depth) {
+    HuntTraceEnd();
+  }
+}
+
+/*-----------------------------------------------*/
+/* Names the process after the test file, as Perfetto shows it */
+static void HuntTraceProcessName(const char *name) {
+  if (HuntTraceFile == NULL) {
+    return;
+  }
+  HuntTraceEventBegin("process_name", "__metadata", 'M');
+  HuntTraceAppend(",\"args\":{\"name\":");
+  HuntTraceAppendString(name);
+  HuntTraceAppend("}");
+  HuntTraceEventEnd();
+}
+
+/*-----------------------------------------------*/
+/* Ends what is left open and writes the events out, the file is kept open for another run */
+static void HuntTraceFinish(void) {
+  if (HuntTraceFile == NULL) {
+    return;
+  }
+  HuntTraceEndTo(0);
+  HuntTraceFlush();
+}
+
+/*-----------------------------------------------*/
+/* Opens the trace to append to it, and starts the JSON array if the file is new. Several
+ * runners, like those of make -j, may append to one file. Returns non-zero if it failed. */
+int HuntTraceOpen(const char *path) {
+  int fd;
+
+  if (HuntTraceFile != NULL) {
+    /* aggregated runners parse the options again */
+    return 0;
+  }
+  /* of runners started together, only the one that creates the file opens the JSON array */
+  fd = open(path, O_WRONLY | O_CREAT | O_EXCL | O_APPEND, 0666);
+  HuntTraceFile = (fd >= 0) ? fdopen(fd, "a") : fopen(path, "a");
+  if (HuntTraceFile == NULL) {
+    if (fd >= 0) {
+      (void) close(fd);
+    }
+    HuntPrint(HuntStrErrTrace);
+    HuntPrint(path);
+    HUNT_PRINT_EOL();
+    return 1;
+  }
+  (void) setvbuf(HuntTraceFile, NULL, _IONBF, 0);
+  if (fd >= 0) {
+    (void) fputs("[\n", HuntTraceFile);
+  }
+  HuntTracePid = (unsigned long) getpid();
+#ifdef __linux__
+  HuntTraceTid = (unsigned long) syscall(SYS_gettid);
+#else
+  HuntTraceTid = HuntTracePid;
+#endif
+  HuntTraceLength = 0;
+  HuntTraceDepth = 0;
+  return 0;
+}
+
+/*-----------------------------------------------*/
+void HuntTraceBegin(const char *name, const char *category) {
+  if (HuntTraceFile == NULL) {
+    return;
+  }
+  HuntTraceEventBegin(name, category, 'B');
+  HuntTraceEventEnd();
+  HuntTraceDepth++;
+}
+
+/*-----------------------------------------------*/
+void HuntTraceEnd(void) {
+  if (HuntTraceDepth == 0) {
+    return;
+  }
+  HuntTraceEventBegin(NULL, NULL, 'E');
+  HuntTraceEventEnd();
+  HuntTraceDepth--;
+}
+
+/*-----------------------------------------------*/
+void HuntTraceTestStart(void) {
+  if (HuntTraceFile == NULL) {
+    return;
+  }
+  HuntTraceTestDepth = HuntTraceDepth;
+  HuntTraceEventBegin(Hunt.CurrentTestName, "test", 'B');
+  HuntTraceAppend(",\"args\":{\"file\":");
+  HuntTraceAppendString(Hunt.TestFile);
+  HuntTraceAppend(",\"line\":");
+  HuntTraceAppendNumber((unsigned long) Hunt.CurrentTestLineNumber, 0);
+  HuntTraceAppend("}");
+  HuntTraceEventEnd();
+  HuntTraceDepth++;
+}
+
+/*-----------------------------------------------*/
+/* Ends the test with its result, which chrome://tracing shows along with the file and line */
+void HuntTraceTestStop(void) {
+  if (HuntTraceDepth <= HuntTraceTestDepth) {
+    return;
+  }
+  HuntTraceEndTo(HuntTraceTestDepth + 1);
+  HuntTraceEventBegin(NULL, NULL, 'E');
+  HuntTraceAppend(",\"args\":{\"result\":\"");
+  if (Hunt.CurrentTestIgnored) {
+    HuntTraceAppend("IGNORE");
+  } else if (Hunt.CurrentTestFailed) {
+    HuntTraceAppend("FAIL");
+  } else {
+    HuntTraceAppend("PASS");
+  }
+  HuntTraceAppend("\"}");
+  HuntTraceEventEnd();
+  HuntTraceDepth--;
+}
+#endif
+
+/*-----------------------------------------------
+ * Profiler
+ *-----------------------------------------------*/
+
+#ifdef HUNT_USE_PROFILER
+/* Frames of the signal handler and of the signal trampoline atop every sample */
+#define HUNT_PROFILER_SKIP 2
+
+/*-----------------------------------------------*/
+/* Keeps the stack in the next free sample on SIGPROF. Nothing here allocates, as
+ * HuntProfileOpen() had backtrace() load what it needs beforehand. */
+static void HuntProfileSample(int signal) {
+  int sample = (int) HuntProfileCount;
+
+  (void) signal;
+  if (sample >= HUNT_PROFILER_SAMPLES) {
+    HuntProfileDropped++;
+    return;
+  }
+  HuntProfileDepths[sample] = backtrace(HuntProfileFrames[sample], HUNT_PROFILER_DEPTH);
+  HuntProfileCount = sample + 1;
+}
+
+/*-----------------------------------------------*/
+/* Samples after every interval microseconds of cpu time from now on, or no longer for 0 */
+static void HuntProfileTimer(const long interval) {
+  struct itimerval timer;
+
+  timer.it_interval.tv_sec = interval / 1000000;
+  timer.it_interval.tv_usec = interval % 1000000;
+  timer.it_value = timer.it_interval;
+  (void) setitimer(ITIMER_PROF, &timer, NULL);
+}
+
+/*-----------------------------------------------*/
+static int HuntProfileSameStack(const int a, const int b) {
+  int i;
+
+  if (HuntProfileDepths[a] != HuntProfileDepths[b]) {
+    return 0;
+  }
+  for (i = HUNT_PROFILER_SKIP; i < HuntProfileDepths[a]; i++) {
+    if (HuntProfileFrames[a][i] != HuntProfileFrames[b][i]) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/*-----------------------------------------------*/
+/* Moves the frames of a sample to the start of their functions, so that samples taken at other
+ * lines of the same functions fold into one stack. A return address points past its call, so
+ * the byte before it is still in the caller. */
+static void HuntProfileFoldFrames(const int sample) {
+  char *address;
+  Dl_info info;
+  int i;
+
+  for (i = HUNT_PROFILER_SKIP; i < HuntProfileDepths[sample]; i++) {
+    address = (char *) HuntProfileFrames[sample][i] - ((i > HUNT_PROFILER_SKIP) ? 1 : 0);
+    if ((dladdr(address, &info) != 0) && (info.dli_sname != NULL)) {
+      address = (char *) info.dli_saddr;
+    }
+    HuntProfileFrames[sample][i] = address;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Writes the function of a frame, or its module and offset when dladdr() finds no symbol */
+static void HuntProfileWriteFrame(const void *frame) {
+  const char *address = (const char *) frame;
+  const char *module;
+  Dl_info info;
+
+  if (dladdr(address, &info) == 0) {
+    (void) fprintf(HuntProfileFile, "0x%lx", (unsigned long) address);
+  } else if (info.dli_sname != NULL) {
+    (void) fputs(info.dli_sname, HuntProfileFile);
+  } else {
+    for (module = info.dli_fname; *info.dli_fname != 0; info.dli_fname++) {
+      if (*info.dli_fname == '/') {
+        module = info.dli_fname + 1;
+      }
+    }
+    (void) fprintf(HuntProfileFile, "%s+0x%lx", module, (unsigned long) (address - (const char *) info.dli_fbase));
+  }
+}
+
+/*-----------------------------------------------*/
+/* Opens the file for the folded stacks and starts to catch SIGPROF, returns non-zero if it failed */
+int HuntProfileOpen(const char *path) {
+  struct sigaction action;
+  unsigned char *bytes = (unsigned char *) &action;
+  void *frame;
+  HUNT_UINT i;
+
+  if (HuntProfileFile != NULL) {
+    /* aggregated runners parse the options again */
+    return 0;
+  }
+  HuntProfileFile = fopen(path, "w");
+  if (HuntProfileFile == NULL) {
+    HuntPrint(HuntStrErrProfile);
+    HuntPrint(path);
+    HUNT_PRINT_EOL();
+    return 1;
+  }
+  /* the first backtrace() loads the unwinder, which must not happen in the signal handler */
+  (void) backtrace(&frame, 1);
+  for (i = 0; i < (HUNT_UINT) sizeof(action); i++) {
+    bytes[i] = 0;
+  }
+  action.sa_handler = HuntProfileSample;
+  action.sa_flags = SA_RESTART;
+  (void) sigemptyset(&action.sa_mask);
+  (void) sigaction(SIGPROF, &action, NULL);
+  return 0;
+}
+
+/*-----------------------------------------------*/
+/* Writes the samples of the test as folded stacks, "test;main;...;leaf count" for each distinct
+ * stack, and counts the samples that did not fit in a [dropped] frame. */
+void HuntProfileWrite(void) {
+  int count = (int) HuntProfileCount;
+  int same;
+  int i;
+  int j;
+
+  if (HuntProfileFile == NULL) {
+    return;
+  }
+  for (i = 0; i < count; i++) {
+    HuntProfileFoldFrames(i);
+  }
+  for (i = 0; i < count; i++) {
+    if (HuntProfileDepths[i] <= HUNT_PROFILER_SKIP) {
+      continue;
+    }
+    same = 1;
+    for (j = i + 1; j < count; j++) {
+      if (HuntProfileSameStack(i, j)) {
+        HuntProfileDepths[j] = 0;
+        same++;
+      }
+    }
+    (void) fputs(Hunt.CurrentTestName, HuntProfileFile);
+    for (j = HuntProfileDepths[i] - 1; j >= HUNT_PROFILER_SKIP; j--) {
+      (void) fputc(';', HuntProfileFile);
+      HuntProfileWriteFrame(HuntProfileFrames[i][j]);
+    }
+    (void) fprintf(HuntProfileFile, " %d\n", same);
+  }
+  if (HuntProfileDropped > 0) {
+    (void) fprintf(HuntProfileFile, "%s;[dropped] %d\n", Hunt.CurrentTestName, (int) HuntProfileDropped);
+  }
+  HuntProfileCount = 0;
+  HuntProfileDropped = 0;
+}
+#endif
+
+/*-----------------------------------------------
+ * Phase Times
+ *-----------------------------------------------*/
+
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+/*-----------------------------------------------*/
+static void HuntPhaseReset(HUNT_UINT *times) {
+  int i;
+  for (i = 0; i < (int) HUNT_PHASE_COUNT; i++) {
+    times[i] = 0;
+  }
+}
+#endif
+
+#ifdef HUNT_USE_PHASE_HOOKS
+/*-----------------------------------------------*/
+/* Stops the phase that runs, if any, and starts timing, tracing and profiling this one. setUp
+ * starts each test afresh, and a phase left by a failure is stopped by the next one or by
+ * HuntPhaseStop(). Only the body of a test is profiled. */
+void HuntPhaseStart(const HUNT_PHASE_T phase) {
+  HuntPhaseStop();
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+  if (phase == HUNT_PHASE_SETUP) {
+    HuntPhaseReset(HuntPhaseTimes);
+  } else if (phase == HUNT_PHASE_VERIFY) {
+    HuntPhaseVerified = 1;
+  }
+#endif
+  HuntPhaseCurrent = phase;
+#ifdef HUNT_USE_TRACE
+  HuntTracePhaseDepth = HuntTraceDepth;
+  HuntTraceBegin(HuntPhaseNames[phase], "phase");
+#endif
+#ifdef HUNT_USE_PROFILER
+  if (phase == HUNT_PHASE_SETUP) {
+    HuntProfileCount = 0;
+    HuntProfileDropped = 0;
+  } else if ((phase == HUNT_PHASE_TEST) && (HuntProfileFile != NULL)) {
+    HuntProfileTimer(HUNT_PROFILER_INTERVAL_US);
+  }
+#endif
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+  HuntPhaseStartTime = (HUNT_UINT) HUNT_CLOCK_NS();
+#endif
+}
+
+/*-----------------------------------------------*/
+void HuntPhaseStop(void) {
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+  HUNT_UINT elapsed;
+#endif
+
+  if (HuntPhaseCurrent < HUNT_PHASE_COUNT) {
+#ifdef HUNT_USE_PROFILER
+    if ((HuntPhaseCurrent == HUNT_PHASE_TEST) && (HuntProfileFile != NULL)) {
+      HuntProfileTimer(0);
+    }
+#endif
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+    elapsed = HuntExecTimeWithoutOverhead((HUNT_UINT) HUNT_CLOCK_NS() - HuntPhaseStartTime);
+    HuntPhaseTimes[HuntPhaseCurrent] += elapsed;
+    HuntPhaseTotals[HuntPhaseCurrent] += elapsed;
+#endif
+#ifdef HUNT_USE_TRACE
+    HuntTraceEndTo(HuntTracePhaseDepth);
+#endif
+    HuntPhaseCurrent = HUNT_PHASE_COUNT;
+  }
+}
+#endif
+
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+/*-----------------------------------------------*/
+/* Prints "setUp 1.20 ms, test 41 us, tearDown 310 ns", and the verify phase once mocks were verified */
+static void HuntPrintPhases(const HUNT_UINT *times) {
+  int i;
+
+  for (i = 0; i < (int) HUNT_PHASE_COUNT; i++) {
+    if ((i == (int) HUNT_PHASE_VERIFY) && !HuntPhaseVerified) {
+      break;
+    }
+    if (i > 0) {
+      HuntPrint(", ");
+    }
+    HuntPrint(HuntPhaseNames[i]);
+    HUNT_OUTPUT_CHAR(' ');
+    HuntPrintDuration(times[i]);
+  }
+}
+
+/*-----------------------------------------------*/
+void HuntPrintPhaseTimes(void) {
+  HuntPrint(" (");
+  HuntPrintPhases(HuntPhaseTimes);
+  HUNT_OUTPUT_CHAR(')');
+}
+#endif
+
+/*-----------------------------------------------
+ * Performance Counters
+ *-----------------------------------------------*/
+
+#ifdef HUNT_USE_PERF_EVENTS
+/* The events of HUNT_PERF_EVENT_T, as perf_event_open() knows them */
+static const struct {
+  __u32 Type;
+  __u64 Config;
+  const char *Name;
+} HuntPerfEvents[HUNT_PERF_EVENT_COUNT] = {
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS,      "instructions" },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES,        "cycles" },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES,     "branch misses" },
+  { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES,      "cache misses" },
+  { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_PAGE_FAULTS,       "page faults" },
+  { PERF_TYPE_SOFTWARE, PERF_COUNT_SW_CONTEXT_SWITCHES,  "context switches" }
+};
+
+/*-----------------------------------------------*/
+static int HuntPerfOpen(const int event, const int excludeKernel) {
+  struct perf_event_attr attr;
+  unsigned char *bytes = (unsigned char *) &attr;
+  HUNT_UINT i;
+
+  for (i = 0; i < (HUNT_UINT) sizeof(attr); i++) {
+    bytes[i] = 0;
+  }
+  attr.type = HuntPerfEvents[event].Type;
+  attr.size = (__u32) sizeof(attr);
+  attr.config = HuntPerfEvents[event].Config;
+  attr.disabled = 1;
+  attr.exclude_hv = 1;
+  if (excludeKernel) {
+    attr.exclude_kernel = 1;
+  }
+  return (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+/*-----------------------------------------------*/
+/* Opens what the system permits. Hardware events only count user space, which keeps
+ * instruction counts repeatable; software events fall back to it if they must. */
+static void HuntPerfOpenAll(void) {
+  int i;
+
+  for (i = 0; i < (int) HUNT_PERF_EVENT_COUNT; i++) {
+    int userOnly = (HuntPerfEvents[i].Type == PERF_TYPE_HARDWARE);
+    HuntPerfFds[i] = HuntPerfOpen(i, userOnly);
+    if ((HuntPerfFds[i] < 0) && !userOnly) {
+      HuntPerfFds[i] = HuntPerfOpen(i, 1);
+    }
+  }
+  HuntPerfOpened = 1;
+}
+
+/*-----------------------------------------------*/
+static __u64 HuntPerfRead(const int fd) {
+  __u64 value = 0;
+
+  if (read(fd, &value, sizeof(value)) != (ssize_t) sizeof(value)) {
+    return 0;
+  }
+  return value;
+}
+
+/*-----------------------------------------------*/
+/* Counts don't fit a HUNT_UINT without HUNT_SUPPORT_64, those beyond it become its largest value */
+static HUNT_UINT HuntPerfSaturate(const __u64 value) {
+  return (value > (__u64) ((HUNT_UINT) -1)) ? ((HUNT_UINT) -1) : (HUNT_UINT) value;
+}
+
+/*-----------------------------------------------*/
+static void HuntPerfPrintCount(__u64 value) {
+#ifdef HUNT_SUPPORT_64
+  HuntPrintNumberUnsigned((HUNT_UINT) value);
+#else
+  char digits[24];
+  int i = (int) sizeof(digits) - 1;
+
+  digits[i] = 0;
+  do {
+    digits[--i] = (char) ('0' + (int) (value % 10));
+    value /= 10;
+  } while (value > 0);
+  HuntPrint(&digits[i]);
+#endif
+}
+
+/*-----------------------------------------------*/
+static void HuntPerfClose(void) {
+  int i;
+
+  for (i = 0; HuntPerfOpened && (i < (int) HUNT_PERF_EVENT_COUNT); i++) {
+    if (HuntPerfFds[i] >= 0) {
+      (void) close(HuntPerfFds[i]);
+    }
+  }
+  HuntPerfOpened = 0;
+}
+
+/*-----------------------------------------------*/
+void HuntPerfStart(void) {
+  int i;
+
+  if (!HuntPerfOpened) {
+    HuntPerfOpenAll();
+  }
+  for (i = 0; i < (int) HUNT_PERF_EVENT_COUNT; i++) {
+    HuntPerfCounts[i] = 0;
+    if (HuntPerfFds[i] >= 0) {
+      (void) ioctl(HuntPerfFds[i], PERF_EVENT_IOC_RESET, 0);
+      (void) ioctl(HuntPerfFds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+/*-----------------------------------------------*/
+void HuntPerfStop(void) {
+  int i;
+
+  for (i = 0; HuntPerfOpened && (i < (int) HUNT_PERF_EVENT_COUNT); i++) {
+    if (HuntPerfFds[i] >= 0) {
+      (void) ioctl(HuntPerfFds[i], PERF_EVENT_IOC_DISABLE, 0);
+      HuntPerfCounts[i] = HuntPerfRead(HuntPerfFds[i]);
+    }
+  }
+}
+
+/*-----------------------------------------------*/
+/* Prints the counted events after the result of a test, like " (1234 instructions, 2 page faults)". */
+void HuntPerfPrint(void) {
+  int i;
+  int printed = 0;
+
+  for (i = 0; HuntPerfOpened && (i < (int) HUNT_PERF_EVENT_COUNT); i++) {
+    if (HuntPerfFds[i] >= 0) {
+      HuntPrint(printed ? ", " : " (");
+      HuntPerfPrintCount(HuntPerfCounts[i]);
+      HUNT_OUTPUT_CHAR(' ');
+      HuntPrint(HuntPerfEvents[i].Name);
+      printed = 1;
+    }
+  }
+  if (printed) {
+    HUNT_OUTPUT_CHAR(')');
+  }
+}
+#endif
+
+/*-----------------------------------------------*/
+HUNT_UINT HuntPerfCount(const HUNT_PERF_EVENT_T event) {
+#ifdef HUNT_USE_PERF_EVENTS
+  if (HuntPerfOpened && (event < HUNT_PERF_EVENT_COUNT) && (HuntPerfFds[event] >= 0)) {
+    return HuntPerfSaturate(HuntPerfRead(HuntPerfFds[event]));
+  }
+#else
+  (void) event;
+#endif
+  return 0;
+}
+
+/*-----------------------------------------------
+ * Resource Usage
+ *-----------------------------------------------*/
+
+#ifdef HUNT_USE_RUSAGE
+/*-----------------------------------------------*/
+/* Resident set in kB, which only Linux hosts know without asking the kernel for more */
+static long HuntRss(void) {
+  long pages = 0;
+#ifdef HUNT_USE_STATM
+  FILE *statm = fopen("/proc/self/statm", "r");
+
+  if (statm != NULL) {
+    if (fscanf(statm, "%*s %ld", &pages) != 1) {
+      pages = 0;
+    }
+    (void) fclose(statm);
+  }
+  return pages * (sysconf(_SC_PAGESIZE) / 1024);
+#else
+  return pages;
+#endif
+}
+
+/*-----------------------------------------------*/
+void HuntRusageStart(void) {
+  HuntRssBefore = HuntRss();
+  (void) getrusage(HUNT_RUSAGE_WHO, &HuntRusageBefore);
+}
+
+/*-----------------------------------------------*/
+void HuntRusageStop(void) {
+  (void) getrusage(HUNT_RUSAGE_WHO, &HuntRusageAfter);
+  HuntRssAfter = HuntRss();
+}
+
+/*-----------------------------------------------*/
+static HUNT_UINT HuntRusageUs(const struct timeval *before, const struct timeval *after) {
+  return ((HUNT_UINT) (after->tv_sec - before->tv_sec) * 1000000u) +
+         (HUNT_UINT) (after->tv_usec - before->tv_usec);
+}
+
+/*-----------------------------------------------*/
+/* Nanoseconds in 32 bits would wrap around after 4.29 s of cpu, so those print microseconds */
+static void HuntRusagePrintTime(const HUNT_UINT usec) {
+#ifdef HUNT_SUPPORT_64
+  HuntPrintDuration(usec * 1000u);
+#else
+  HuntPrintNumberUnsigned(usec);
+  HuntPrint(" us");
+#endif
+}
+
+/*-----------------------------------------------*/
+static void HuntRusagePrintCount(const char *name, const long before, const long after) {
+  HuntPrint(", ");
+  HuntPrintNumber((HUNT_INT) (after - before));
+  HuntPrint(name);
+}
+
+/*-----------------------------------------------*/
+/* Prints " (user 1.20 ms, sys 310.00 us, 93% cpu, maxrss +120 kB, rss +64 kB, 0 major faults, ...)",
+ * where the share of cpu is that of the exec time and shows a test that blocks when it is low */
+void HuntRusagePrint(void) {
+  HUNT_UINT user = HuntRusageUs(&HuntRusageBefore.ru_utime, &HuntRusageAfter.ru_utime);
+  HUNT_UINT sys = HuntRusageUs(&HuntRusageBefore.ru_stime, &HuntRusageAfter.ru_stime);
+  long maxrss = HuntRusageAfter.ru_maxrss - HuntRusageBefore.ru_maxrss;
+#ifdef HUNT_USE_EXEC_TIME_NS
+  HUNT_UINT wall = HuntExecTimeWithoutOverhead(Hunt.CurrentTestStopTime - Hunt.CurrentTestStartTime);
+#endif
+
+#ifdef __APPLE__
+  maxrss /= 1024; /* in bytes rather than kB */
+#endif
+  HuntPrint(" (user ");
+  HuntRusagePrintTime(user);
+  HuntPrint(", sys ");
+  HuntRusagePrintTime(sys);
+#ifdef HUNT_USE_EXEC_TIME_NS
+  if (wall > 0) {
+    HuntPrint(", ");
+    HuntPrintNumberUnsigned((user + sys) * 100u / ((wall / 1000u) + 1u));
+    HuntPrint("% cpu");
+  }
+#endif
+  HuntPrint(", maxrss +");
+  HuntPrintNumber((HUNT_INT) maxrss);
+  HuntPrint(" kB");
+#ifdef HUNT_USE_STATM
+  HuntPrint(", rss ");
+  if (HuntRssAfter >= HuntRssBefore) {
+    HUNT_OUTPUT_CHAR('+');
+  }
+  HuntPrintNumber((HUNT_INT) (HuntRssAfter - HuntRssBefore));
+  HuntPrint(" kB");
+#endif
+  HuntRusagePrintCount(" major faults", HuntRusageBefore.ru_majflt, HuntRusageAfter.ru_majflt);
+  HuntRusagePrintCount(" minor faults", HuntRusageBefore.ru_minflt, HuntRusageAfter.ru_minflt);
+  HuntRusagePrintCount(" voluntary switches", HuntRusageBefore.ru_nvcsw, HuntRusageAfter.ru_nvcsw);
+  HuntRusagePrintCount(" involuntary switches", HuntRusageBefore.ru_nivcsw, HuntRusageAfter.ru_nivcsw);
+  HUNT_OUTPUT_CHAR(')');
+}
+#endif
+
+/*-----------------------------------------------
+ * Latency Histograms
+ *-----------------------------------------------*/
+
+#define HUNT_HISTOGRAM_SUB_COUNT ((HUNT_UINT) 1 << HUNT_HISTOGRAM_SUB_BITS)
+#define HUNT_HISTOGRAM_HALF_COUNT ((HUNT_UINT) 1 << (HUNT_HISTOGRAM_SUB_BITS - 1))
+
+/*-----------------------------------------------*/
+void HuntHistogramReset(HuntHistogram *histogram) {
+  HUNT_UINT i;
+
+  for (i = 0; i < HUNT_HISTOGRAM_BUCKETS; i++) {
+    histogram->Counts[i] = 0;
+  }
+  histogram->Total = 0;
+  histogram->Min = 0;
+  histogram->Max = 0;
+}
+
+/*-----------------------------------------------*/
+/* Bucket of a value: the value itself below HUNT_HISTOGRAM_SUB_COUNT, above that its top
+ * HUNT_HISTOGRAM_SUB_BITS bits after the buckets of the lower powers of two. */
+static HUNT_UINT HuntHistogramBucket(const HUNT_UINT value) {
+  HUNT_UINT exponent = 0;
+  HUNT_UINT shift;
+
+  if (value < HUNT_HISTOGRAM_SUB_COUNT) {
+    return value;
+  }
+  /* the highest shift leaving at least HUNT_HISTOGRAM_SUB_BITS bits, found by halving */
+  for (shift = HUNT_HISTOGRAM_BITS / 2; shift > 0; shift /= 2) {
+    if ((value >> (exponent + shift)) >= HUNT_HISTOGRAM_SUB_COUNT) {
+      exponent += shift;
+    }
+  }
+  exponent++;
+  return (exponent * HUNT_HISTOGRAM_HALF_COUNT) + (value >> exponent);
+}
+
+/*-----------------------------------------------*/
+/* Highest value that falls into a bucket. */
+static HUNT_UINT HuntHistogramBucketTop(const HUNT_UINT bucket) {
+  HUNT_UINT exponent;
+
+  if (bucket < HUNT_HISTOGRAM_SUB_COUNT) {
+    return bucket;
+  }
+  exponent = (bucket / HUNT_HISTOGRAM_HALF_COUNT) - 1;
+  return ((bucket - (exponent * HUNT_HISTOGRAM_HALF_COUNT) + 1) << exponent) - 1;
+}
+
+/*-----------------------------------------------*/
+void HuntHistogramRecord(HuntHistogram *histogram, const HUNT_UINT value) {
+  histogram->Counts[HuntHistogramBucket(value)]++;
+  if ((histogram->Total == 0) || (value < histogram->Min)) {
+    histogram->Min = value;
+  }
+  if (value > histogram->Max) {
+    histogram->Max = value;
+  }
+  histogram->Total++;
+}
+
+/*-----------------------------------------------*/
+/* The value that percentile hundredths of a percent of the samples are at or below, to within
+ * the precision of the buckets, but never above the largest sample. */
+HUNT_UINT HuntHistogramPercentile(const HuntHistogram *histogram, const HUNT_UINT percentile) {
+  HUNT_UINT rank, bucket, top;
+  HUNT_UINT count = 0;
+
+  if (histogram->Total == 0) {
+    return 0;
+  }
+  /* rounded up, and split so that no product overflows */
+  rank = ((histogram->Total / 10000) * percentile) + ((((histogram->Total % 10000) * percentile) + 9999) / 10000);
+  rank = (rank < 1) ? 1 : rank;
+  for (bucket = 0; bucket < HUNT_HISTOGRAM_BUCKETS; bucket++) {
+    count += histogram->Counts[bucket];
+    if (count >= rank) {
+      break;
+    }
+  }
+  top = HuntHistogramBucketTop(bucket);
+  return (top < histogram->Max) ? top : histogram->Max;
+}
+
+/*-----------------------------------------------*/
+/* Prints "p50", "p99.9" or "p99.99" for a percentile in hundredths of a percent. */
+static void HuntPrintPercentile(const HUNT_UINT percentile) {
+  HUNT_OUTPUT_CHAR('p');
+  HuntPrintNumberUnsigned(percentile / 100);
+  if ((percentile % 100) != 0) {
+    HUNT_OUTPUT_CHAR('.');
+    HUNT_OUTPUT_CHAR((char) ('0' + ((percentile % 100) / 10)));
+    if ((percentile % 10) != 0) {
+      HUNT_OUTPUT_CHAR((char) ('0' + (percentile % 10)));
+    }
+  }
+}
+
+/*-----------------------------------------------*/
+/* Prints "HIST: count 1000, p50 120 ns, p90 130 ns, p99 250 ns, p99.9 900 ns, max 1210 ns". */
+void HuntPrintHistogram(const HuntHistogram *histogram, const HUNT_LINE_TYPE line) {
+  static const HUNT_UINT percentiles[] = { 5000, 9000, 9900, 9990 };
+  unsigned i;
+
+  HuntTestResultsBegin(Hunt.TestFile, line);
+  HuntPrint(HuntStrHistogram);
+  HuntPrintNumberUnsigned(histogram->Total);
+  for (i = 0; i < (sizeof(percentiles) / sizeof(percentiles[0])); i++) {
+    HUNT_OUTPUT_CHAR(',');
+    HUNT_OUTPUT_CHAR(' ');
+    HuntPrintPercentile(percentiles[i]);
+    HUNT_OUTPUT_CHAR(' ');
+    HuntPrintNumberUnsigned(HuntHistogramPercentile(histogram, percentiles[i]));
+    HuntPrint(HuntStrHistogramUnit);
+  }
+  HuntPrint(HuntStrHistogramMax);
+  HuntPrintNumberUnsigned(histogram->Max);
+  HuntPrint(HuntStrHistogramUnit);
+  HUNT_PRINT_EOL();
+}
+
+/*-----------------------------------------------*/
+void HuntAssertPercentileBelow(const HuntHistogram *histogram,
+                               const HUNT_UINT percentile,
+                               const HUNT_UINT threshold,
+                               const char *msg,
+                               const HUNT_LINE_TYPE lineNumber) {
+  HUNT_UINT actual;
+
+  RETURN_IF_FAIL_OR_IGNORE;
+
+  if (histogram->Total == 0) {
+    HuntTestResultsFailBegin(lineNumber);
+    HuntPrint(HuntStrErrHistogramEmpty);
+    HuntAddMsgIfSpecified(msg);
+    HUNT_FAIL_AND_BAIL;
+  }
+  actual = HuntHistogramPercentile(histogram, percentile);
+  if (actual >= threshold) {
+    HuntTestResultsFailBegin(lineNumber);
+    HuntPrint(HuntStrExpected);
+    HuntPrintPercentile(percentile);
+    HuntPrint(HuntStrHistogramBelow);
+    HuntPrintNumberUnsigned(threshold);
+    HuntPrint(HuntStrHistogramUnit);
+    HuntPrint(HuntStrWas);
+    HuntPrintNumberUnsigned(actual);
+    HuntPrint(HuntStrHistogramUnit);
+    HuntAddMsgIfSpecified(msg);
+    HUNT_FAIL_AND_BAIL;
+  }
+}
+
+/*-----------------------------------------------
+ * Benchmarks
+ *-----------------------------------------------*/
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+#ifdef HUNT_USE_SYSFS_CACHE_SIZE
+/*-----------------------------------------------*/
+/* Size of the largest cache of the first CPU, which sysfs gives like "32768K", or 0 if unknown. */
+static HUNT_UINT HuntBenchSysfsCacheBytes(void) {
+  char path[64];
+  FILE *file;
+  unsigned long size;
+  char unit;
+  HUNT_UINT largest = 0;
+  int index;
+
+  for (index = 0; index < 8; index++) {
+    (void) sprintf(path, "/sys/devices/system/cpu/cpu0/cache/index%d/size", index);
+    file = fopen(path, "r");
+    if (file == NULL) {
+      break;
+    }
+    if (fscanf(file, "%lu%c", &size, &unit) == 2) {
+      size *= (unit == 'M') ? 1048576ul : ((unit == 'K') ? 1024ul : 1ul);
+      if (size > 0x40000000ul) {
+        size = 0x40000000ul;
+      }
+      if ((HUNT_UINT) size > largest) {
+        largest = (HUNT_UINT) size;
+      }
+    }
+    (void) fclose(file);
+  }
+  return largest;
+}
+#endif
+
+#ifdef HUNT_USE_BENCH_EVICT_BUFFER
+/*-----------------------------------------------*/
+/* Allocates twice the size of the last level cache to stream over, returns 0 if it can't. */
+static int HuntBenchEvictPrepare(void) {
+  HUNT_UINT bytes = (HUNT_UINT) HUNT_BENCH_CACHE_BYTES;
+
+  if (HuntBenchEvictBuffer != NULL) {
+    return 1;
+  }
+#ifdef HUNT_USE_SYSFS_CACHE_SIZE
+  if (bytes == 0) {
+    bytes = HuntBenchSysfsCacheBytes();
+  }
+#endif
+  if (bytes == 0) {
+    bytes = 0x2000000; /* 32 MB, more than most last level caches */
+  }
+  HuntBenchEvictBytes = 2 * bytes;
+  HuntBenchEvictBuffer = (unsigned char *) calloc(HuntBenchEvictBytes, 1);
+  return (HuntBenchEvictBuffer != NULL);
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Pushes whatever the benchmark left in the caches out to memory. */
+static void HuntBenchEvict(void) {
+#ifdef HUNT_BENCH_EVICT
+  HUNT_BENCH_EVICT();
+#else
+  HUNT_UINT i;
+
+  /* writing every line of the buffer leaves no line of the benchmark behind, shared or not */
+  for (i = 0; i < HuntBenchEvictBytes; i += 64) {
+    HuntBenchEvictBuffer[i]++;
+  }
+#endif
+}
+#endif
+
+/*-----------------------------------------------*/
+void HuntBenchStart(HuntBenchState *state) {
+  state->Remaining = state->Iterations;
+  state->Looped = 1;
+#ifdef HUNT_INCLUDE_BENCHMARK
+  if (state->Cold) {
+    /* one iteration at a time, HuntBenchStop() evicts the caches in between */
+    state->ColdRemaining = state->Iterations;
+    state->Remaining = 1;
+    state->Elapsed = 0;
+    HuntBenchEvict();
+  }
+#endif
+#ifdef HUNT_CLOCK_NS
+  state->Start = (HUNT_UINT) HUNT_CLOCK_NS();
+#endif
+}
+
+/*-----------------------------------------------*/
+int HuntBenchStop(HuntBenchState *state) {
+#ifdef HUNT_CLOCK_NS
+  HUNT_UINT elapsed = (HUNT_UINT) HUNT_CLOCK_NS() - state->Start;
+#else
+  HUNT_UINT elapsed = 0;
+#endif
+
+  state->Remaining = 0;
+#ifdef HUNT_INCLUDE_BENCHMARK
+  if (state->Cold) {
+    /* adds up the iterations without the evictions, or the clock readings around them */
+    state->Elapsed += (elapsed > HuntBenchClockOverhead) ? (elapsed - HuntBenchClockOverhead) : 0;
+    if (--state->ColdRemaining == 0) {
+      return 0;
+    }
+    HuntBenchEvict();
+    state->Start = (HUNT_UINT) HUNT_CLOCK_NS();
+    return 1;
+  }
+#endif
+  state->Elapsed = elapsed;
+  return 0;
+}
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+#ifndef HUNT_EXCLUDE_FLOAT
+/*-----------------------------------------------*/
+/* Binary logarithm of x >= 1, one bit of the fraction at a time, so that Hunt needs no libm. */
+static HUNT_FLOAT HuntLog2(HUNT_FLOAT x) {
+  HUNT_FLOAT result = 0.0f;
+  HUNT_FLOAT bit = 1.0f;
+  int i;
+
+  if (x < 1.0f) {
+    return 0.0f;
+  }
+  while (x >= 2.0f) {
+    x /= 2.0f;
+    result += 1.0f;
+  }
+  for (i = 0; i < 20; i++) {
+    x *= x;
+    bit /= 2.0f;
+    if (x >= 2.0f) {
+      x /= 2.0f;
+      result += bit;
+    }
+  }
+  return result;
+}
+
+/*-----------------------------------------------*/
+static HUNT_FLOAT HuntSquareRoot(const HUNT_FLOAT x) {
+  HUNT_FLOAT root = (x > 1.0f) ? x : 1.0f;
+  int i;
+
+  if (x <= 0.0f) {
+    return 0.0f;
+  }
+  for (i = 0; i < 64; i++) {
+    root = (root + (x / root)) / 2.0f;
+  }
+  return root;
+}
+
+/*-----------------------------------------------*/
+static HUNT_FLOAT HuntBigOValue(const HUNT_BIG_O_T bigO, const HUNT_FLOAT n) {
+  switch (bigO) {
+    case HUNT_BIG_O_LOG_N:     return HuntLog2(n);
+    case HUNT_BIG_O_N:         return n;
+    case HUNT_BIG_O_N_LOG_N:   return n * HuntLog2(n);
+    case HUNT_BIG_O_N_SQUARED: return n * n;
+    default:                   return 1.0f;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Fits times[i] = c * f(sizes[i]) by least squares for each complexity f, and returns the one
+ * with the least RMS error relative to the mean time. The simpler complexity wins a tie. */
+HUNT_BIG_O_T HuntBigOFit(const HUNT_UINT *sizes, const HUNT_FLOAT *times, const HUNT_UINT count, HUNT_FLOAT *rms) {
+  HUNT_BIG_O_T best = HUNT_BIG_O_1;
+  HUNT_FLOAT mean = 0.0f;
+  HUNT_FLOAT scale, f, sumTF, sumFF, c, error, fit;
+  HUNT_UINT i;
+  int bigO;
+
+  *rms = 0.0f;
+  for (i = 0; i < count; i++) {
+    mean += times[i];
+  }
+  if ((count == 0) || (mean <= 0.0f)) {
+    return best;
+  }
+  mean /= (HUNT_FLOAT) count;
+
+  for (bigO = HUNT_BIG_O_1; bigO <= HUNT_BIG_O_N_SQUARED; bigO++) {
+    /* scaled to 1 at the largest size, so that n^2 fits in a float */
+    scale = HuntBigOValue((HUNT_BIG_O_T) bigO, (HUNT_FLOAT) sizes[count - 1]);
+    scale = (scale > 0.0f) ? scale : 1.0f;
+    sumTF = 0.0f;
+    sumFF = 0.0f;
+    for (i = 0; i < count; i++) {
+      f = HuntBigOValue((HUNT_BIG_O_T) bigO, (HUNT_FLOAT) sizes[i]) / scale;
+      sumTF += times[i] * f;
+      sumFF += f * f;
+    }
+    if (sumFF <= 0.0f) {
+      continue;
+    }
+    c = sumTF / sumFF;
+    error = 0.0f;
+    for (i = 0; i < count; i++) {
+      f = times[i] - (c * HuntBigOValue((HUNT_BIG_O_T) bigO, (HUNT_FLOAT) sizes[i]) / scale);
+      error += f * f;
+    }
+    fit = HuntSquareRoot(error / (HUNT_FLOAT) count) / mean;
+    if ((bigO == HUNT_BIG_O_1) || (fit < *rms)) {
+      best = (HUNT_BIG_O_T) bigO;
+      *rms = fit;
+    }
+  }
+  return best;
+}
+#endif
+
+/*-----------------------------------------------*/
+/* b relative to a, in ten thousandths, halving both while B * 10000 could overflow. */
+static HUNT_UINT HuntBenchRatio(HUNT_UINT b, HUNT_UINT a) {
+  while (b > ((HUNT_UINT) -1) / 10000u) {
+    b /= 2;
+    a /= 2;
+  }
+  return (a > 0) ? ((b * 10000u) + (a / 2)) / a : ((HUNT_UINT) -1);
+}
+
+/*-----------------------------------------------*/
+/* Coefficient of variation of the samples, their standard deviation relative to their mean, in
+ * ten thousandths. Without floats it is estimated from the mean absolute deviation instead. */
+static HUNT_UINT HuntBenchNoise(const HUNT_UINT *samples, const HUNT_UINT count) {
+  HUNT_UINT i;
+#ifndef HUNT_EXCLUDE_FLOAT
+  HUNT_FLOAT mean = 0.0f;
+  HUNT_FLOAT variance = 0.0f;
+  HUNT_FLOAT deviation;
+
+  if (count < 2) {
+    return 0;
+  }
+  for (i = 0; i < count; i++) {
+    mean += (HUNT_FLOAT) samples[i];
+  }
+  mean /= (HUNT_FLOAT) count;
+  if (mean <= 0.0f) {
+    return 0;
+  }
+  for (i = 0; i < count; i++) {
+    deviation = (HUNT_FLOAT) samples[i] - mean;
+    variance += deviation * deviation;
+  }
+  return (HUNT_UINT) (((HuntSquareRoot(variance / (HUNT_FLOAT) (count - 1)) / mean) * 10000.0f) + 0.5f);
+#else
+  HUNT_UINT mean = 0;
+  HUNT_UINT deviation = 0;
+
+  if (count < 2) {
+    return 0;
+  }
+  for (i = 0; i < count; i++) {
+    mean += samples[i];
+  }
+  mean /= count;
+  for (i = 0; i < count; i++) {
+    deviation += (samples[i] > mean) ? (samples[i] - mean) : (mean - samples[i]);
+  }
+  deviation /= count;
+  /* the standard deviation of normal noise is about 5/4 of its mean absolute deviation */
+  return HuntBenchRatio(deviation * 5, mean * 4);
+#endif
+}
+
+/*-----------------------------------------------*/
+static void HuntSortSamples(HUNT_UINT *samples, const HUNT_UINT count) {
+  HUNT_UINT i, j, sample;
+
+  for (i = 1; i < count; i++) {
+    sample = samples[i];
+    for (j = i; (j > 0) && (samples[j - 1] > sample); j--) {
+      samples[j] = samples[j - 1];
+    }
+    samples[j] = sample;
+  }
+}
+
+/*-----------------------------------------------*/
+static HUNT_UINT HuntMedianOfSorted(const HUNT_UINT *samples, const HUNT_UINT count) {
+  if (count == 0) {
+    return 0;
+  }
+  return (samples[(count - 1) / 2] / 2) + (samples[count / 2] / 2)
+         + ((samples[(count - 1) / 2] % 2) + (samples[count / 2] % 2)) / 2;
+}
+
+/*-----------------------------------------------*/
+/* Sorts the samples, then finds their median, minimum, median absolute deviation and coefficient
+ * of variation. */
+void HuntBenchSummarize(HUNT_UINT *samples, const HUNT_UINT count, HuntBenchResult *result) {
+  HUNT_UINT i;
+
+  result->Cv = HuntBenchNoise(samples, count);
+  HuntSortSamples(samples, count);
+  result->Repetitions = count;
+  result->Min = (count > 0) ? samples[0] : 0;
+  result->Median = HuntMedianOfSorted(samples, count);
+
+  /* the deviations from the median replace the samples, and get the same treatment */
+  for (i = 0; i < count; i++) {
+    samples[i] = (samples[i] > result->Median) ? (samples[i] - result->Median) : (result->Median - samples[i]);
+  }
+  HuntSortSamples(samples, count);
+  result->Mad = HuntMedianOfSorted(samples, count);
+}
+
+#ifndef HUNT_EXCLUDE_FLOAT
+/*-----------------------------------------------*/
+/* Prints how many items or bytes one run handles per second, like ", 1.25 GB/s". */
+static void HuntPrintBenchRate(const HUNT_UINT count, const char *unit, const HuntBenchResult *result) {
+  static const char prefixes[] = " kMGTPE";
+  HUNT_FLOAT rate;
+  int prefix = 0;
+
+  if ((count == 0) || (result->Median == 0)) {
+    return;
+  }
+  rate = ((HUNT_FLOAT) count * (HUNT_FLOAT) result->Iterations * 1e9f) / (HUNT_FLOAT) result->Median;
+  while ((rate >= 1000.0f) && (prefix < 6)) {
+    rate /= 1000.0f;
+    prefix++;
+  }
+  HuntPrint(", ");
+  HuntPrintQuotient((HUNT_UINT) ((rate * 100.0f) + 0.5f), 100);
+  HUNT_OUTPUT_CHAR(' ');
+  if (prefix > 0) {
+    HUNT_OUTPUT_CHAR(prefixes[prefix]);
+  }
+  HuntPrint(unit);
+  HuntPrint("/s");
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Prints the line of a benchmark up to, but not including, its end. */
+static void HuntPrintBenchResult(const char *label, const HuntBenchResult *result, const HuntBenchState *state) {
+  HuntTestResultsBegin(Hunt.TestFile, Hunt.CurrentTestLineNumber);
+  HuntPrint(label);
+  HUNT_OUTPUT_CHAR(':');
+  HuntPrint(HuntStrBenchMedian);
+  HuntPrintQuotient(result->Median, result->Iterations);
+  HuntPrint(HuntStrBenchMin);
+  HuntPrintQuotient(result->Min, result->Iterations);
+  HuntPrint(HuntStrBenchMad);
+  HuntPrintQuotient(result->Mad, result->Iterations);
+  HuntPrint(HuntStrBenchRuns);
+  HuntPrintNumberUnsigned(result->Repetitions);
+  HUNT_OUTPUT_CHAR('x');
+  HuntPrintNumberUnsigned(result->Iterations);
+  HuntPrint(HuntStrBenchIterations);
+  HuntPrint(HuntStrBenchCv);
+  HuntPrintQuotient(result->Cv, 100);
+  if (result->Cv > (HuntBenchThreshold * 100)) {
+    /* too noisy to tell a change of the threshold from chance */
+    HuntPrint(HuntStrBenchNoisy);
+    HuntPrintNumberUnsigned(HuntBenchThreshold);
+    HuntPrint(HuntStrBenchNoisyThreshold);
+  } else {
+    HUNT_OUTPUT_CHAR('%');
+  }
+#ifndef HUNT_EXCLUDE_FLOAT
+  HuntPrintBenchRate(state->Items, HuntStrBenchItems, result);
+  HuntPrintBenchRate(state->Bytes, HuntStrBenchBytes, result);
+#else
+  (void) state;
+#endif
+#ifdef HUNT_USE_PERF_EVENTS
+  {
+    /* the counters ran for the timed repetitions of warm runs only */
+    int i;
+    for (i = 0; (i < (int) HUNT_PERF_EVENT_COUNT) && !state->Cold; i++) {
+      if (HuntPerfFds[i] >= 0) {
+        __u64 count = HuntPerfCounts[i];
+        HUNT_UINT ops = result->Iterations * result->Repetitions;
+        /* halving both keeps the count per op while the count doesn't fit a HUNT_UINT */
+        while ((count > (__u64) ((HUNT_UINT) -1)) && (ops > 1)) {
+          count /= 2;
+          ops /= 2;
+        }
+        HuntPrint(", ");
+        HuntPrintQuotient(HuntPerfSaturate(count), ops);
+        HUNT_OUTPUT_CHAR(' ');
+        HuntPrint(HuntPerfEvents[i].Name);
+        HuntPrint("/op");
+      }
+    }
+  }
+#endif
+}
+
+/*-----------------------------------------------*/
+/* Runs the body of a benchmark once, returns 0 if it failed or has nothing to time. */
+static int HuntBenchRun(HuntBenchFunction Func, HuntBenchState *state) {
+  state->Looped = 0;
+  state->Elapsed = 0;
+  Func(state);
+  if (Hunt.CurrentTestFailed || Hunt.CurrentTestIgnored) {
+    return 0;
+  }
+  if (!state->Looped) {
+    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, HuntStrErrBenchLoop);
+  }
+  return 1;
+}
+
+/*-----------------------------------------------*/
+/* Doubles the iterations until one run takes long enough to measure, returns 0 if it failed. */
+static int HuntBenchCalibrate(HuntBenchFunction Func, HuntBenchState *state) {
+  state->Cold = 0;
+  state->Items = 0;
+  state->Bytes = 0;
+  state->Iterations = 1;
+  while (HuntBenchRun(Func, state)) {
+    if ((state->Elapsed >= HUNT_BENCH_MIN_NS) || (state->Iterations >= HUNT_BENCH_MAX_ITERATIONS)) {
+      return 1;
+    }
+    state->Iterations *= 2;
+  }
+  return 0;
+}
+
+/*-----------------------------------------------*/
+/* Time of one iteration, in hundredths of a nanosecond. */
+static HUNT_UINT HuntBenchHundredths(const HUNT_UINT elapsed, const HUNT_UINT iterations) {
+  return ((elapsed / iterations) * 100) + ((((elapsed % iterations) * 100) + (iterations / 2)) / iterations);
+}
+#endif
+
+#ifdef HUNT_USE_BENCH_BASELINE
+/*-----------------------------------------------*/
+/* Baseline lines are "file:test" followed by the time per iteration of each repetition. */
+static void HuntBenchSave(const HUNT_UINT *perOp, const HUNT_UINT count) {
+  HUNT_UINT i;
+
+  if (HuntBenchSavePath == NULL) {
+    return;
+  }
+  if (HuntBenchSaveFile == NULL) {
+    HuntBenchSaveFile = fopen(HuntBenchSavePath, "w");
+    if (HuntBenchSaveFile == NULL) {
+      HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, HuntStrErrBenchSave);
+      return; /* without setjmp.h the test goes on after failing */
+    }
+  }
+  (void) fprintf(HuntBenchSaveFile, "%s:%s", Hunt.TestFile, Hunt.CurrentTestName);
+  for (i = 0; i < count; i++) {
+    (void) fprintf(HuntBenchSaveFile, " %lu.%02lu", (unsigned long) (perOp[i] / 100), (unsigned long) (perOp[i] % 100));
+  }
+  (void) fprintf(HuntBenchSaveFile, "\n");
+  (void) fflush(HuntBenchSaveFile);
+}
+
+/*-----------------------------------------------*/
+static void HuntBenchClose(void) {
+  if (HuntBenchSaveFile != NULL) {
+    (void) fclose(HuntBenchSaveFile);
+    HuntBenchSaveFile = NULL;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Skips "file:test " at the start of a baseline line, or returns NULL for another test's line. */
+static const char* HuntBenchBaselineFor(const char *line) {
+  const char *part = Hunt.TestFile;
+
+  while ((*part != 0) && (*line == *part)) {
+    line++;
+    part++;
+  }
+  if ((*part != 0) || (*line++ != ':')) {
+    return NULL;
+  }
+  part = Hunt.CurrentTestName;
+  while ((*part != 0) && (*line == *part)) {
+    line++;
+    part++;
+  }
+  return ((*part == 0) && (*line == ' ')) ? line : NULL;
+}
+
+/*-----------------------------------------------*/
+/* Reads the baseline samples of the current test, returns how many were found. */
+static HUNT_UINT HuntBenchLoadBaseline(HUNT_UINT *baseline) {
+  char line[HUNT_BENCH_LINE_LENGTH];
+  const char *p = NULL;
+  HUNT_UINT count = 0;
+  FILE *file = fopen(HuntBenchComparePath, "r");
+
+  if (file == NULL) {
+    return 0;
+  }
+  while ((p == NULL) && (fgets(line, (int) sizeof(line), file) != NULL)) {
+    p = HuntBenchBaselineFor(line);
+  }
+  (void) fclose(file);
+
+  while ((p != NULL) && (*p == ' ') && (count < HUNT_BENCH_MAX_SAMPLES)) {
+    HUNT_UINT value = 0;
+    HUNT_UINT decimals = 0;
+    while (*p == ' ') {
+      p++;
+    }
+    if ((*p < '0') || (*p > '9')) {
+      break;
+    }
+    while ((*p >= '0') && (*p <= '9')) {
+      value = (value * 10) + (HUNT_UINT) (*p++ - '0');
+    }
+    if (*p == '.') {
+      p++;
+      while ((*p >= '0') && (*p <= '9')) {
+        if (decimals < 2) {
+          value = (value * 10) + (HUNT_UINT) (*p - '0');
+          decimals++;
+        }
+        p++;
+      }
+    }
+    while (decimals++ < 2) {
+      value *= 10;
+    }
+    baseline[count++] = value;
+  }
+  return count;
+}
+
+/*-----------------------------------------------*/
+/* One-sided Mann-Whitney U test: are the n current samples larger than the m baseline samples?
+ * u2 is twice the U statistic of the current samples, counting ties as one half. The exact
+ * distribution of U without ties is given by the coefficients of the Gaussian binomial (n+m over n). */
+static int HuntBenchIsSlower(const HUNT_UINT u2, const HUNT_UINT n, const HUNT_UINT m) {
+  HUNT_INT counts[(HUNT_BENCH_MAX_SAMPLES * HUNT_BENCH_MAX_SAMPLES) + HUNT_BENCH_MAX_SAMPLES + 1];
+  HUNT_UINT limit = (n * m) + n;
+  HUNT_UINT most = (n * m) - ((u2 + 1) / 2);
+  HUNT_INT total = 0;
+  HUNT_INT tail = 0;
+  HUNT_UINT i, j;
+
+  for (j = 0; j <= limit; j++) {
+    counts[j] = (j == 0) ? 1 : 0;
+  }
+  for (i = 1; i <= n; i++) {
+    /* multiply by (1 - q^(m+i)), then divide by (1 - q^i) */
+    for (j = limit; j >= (m + i); j--) {
+      counts[j] -= counts[j - (m + i)];
+    }
+    for (j = i; j <= limit; j++) {
+      counts[j] += counts[j - i];
+    }
+  }
+
+  /* P(U >= observed) is P(U <= n*m - observed), by symmetry */
+  for (j = 0; j <= (n * m); j++) {
+    total += counts[j];
+    if (j <= most) {
+      tail += counts[j];
+    }
+  }
+  return (tail * 100) < (total * HUNT_BENCH_ALPHA_PERCENT);
+}
+
+/*-----------------------------------------------*/
+/* Fails the benchmark if it is significantly slower than its baseline, by more than the threshold. */
+static void HuntBenchCompare(const HUNT_UINT *perOp, const HUNT_UINT count, const HUNT_UINT median) {
+  HUNT_UINT baseline[HUNT_BENCH_MAX_SAMPLES];
+  HuntBenchResult result;
+  HUNT_UINT n = (count < HUNT_BENCH_MAX_SAMPLES) ? count : HUNT_BENCH_MAX_SAMPLES;
+  HUNT_UINT m, i, j;
+  HUNT_UINT u2 = 0;
+
+  if (HuntBenchComparePath == NULL) {
+    return;
+  }
+  m = HuntBenchLoadBaseline(baseline);
+  if ((m == 0) || (n == 0)) {
+    return; /* a new benchmark, nothing to compare with */
+  }
+
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < m; j++) {
+      u2 += (perOp[i] > baseline[j]) ? 2 : ((perOp[i] == baseline[j]) ? 1 : 0);
+    }
+  }
+  HuntBenchSummarize(baseline, m, &result);
+
+  if (HuntBenchIsSlower(u2, n, m) && ((median * 100) > (result.Median * (100 + HuntBenchThreshold)))) {
+    HuntTestResultsFailBegin(Hunt.CurrentTestLineNumber);
+    HUNT_OUTPUT_CHAR(' ');
+    HuntPrintNumberUnsigned(((median - result.Median) * 100) / ((result.Median > 0) ? result.Median : 1));
+    HuntPrint(HuntStrBenchSlower);
+    HuntPrintQuotient(median, 100);
+    HuntPrint(HuntStrBenchBaseline);
+    HuntPrintQuotient(result.Median, 100);
+    HuntPrint(HuntStrBenchUnit);
+    HUNT_FAIL_AND_BAIL;
+  }
+}
+#endif
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+/*-----------------------------------------------*/
+/* Calibrates, times and reports a benchmark, returns 0 if it failed or was ignored. */
+static int HuntBenchMeasure(HuntBenchFunction Func, HuntBenchState *state, HuntBenchResult *result) {
+  HUNT_UINT samples[HUNT_BENCH_REPETITIONS];
+#ifdef HUNT_USE_BENCH_BASELINE
+  HUNT_UINT perOp[HUNT_BENCH_REPETITIONS];
+#endif
+  HUNT_UINT i;
+
+  if (!HuntBenchCalibrate(Func, state)) {
+    return 0;
+  }
+
+#ifdef HUNT_USE_PERF_EVENTS
+  HuntPerfStart();
+#endif
+  for (i = 0; i < HUNT_BENCH_REPETITIONS; i++) {
+    HUNT_TRACE_BEGIN("repetition", "benchmark");
+    if (!HuntBenchRun(Func, state)) {
+      return 0;
+    }
+    HUNT_TRACE_END();
+    samples[i] = state->Elapsed;
+  }
+#ifdef HUNT_USE_PERF_EVENTS
+  HuntPerfStop();
+#endif
+
+#ifdef HUNT_USE_BENCH_BASELINE
+  for (i = 0; i < HUNT_BENCH_REPETITIONS; i++) {
+    perOp[i] = HuntBenchHundredths(samples[i], state->Iterations);
+  }
+#endif
+  HuntBenchSummarize(samples, HUNT_BENCH_REPETITIONS, result);
+  result->Iterations = state->Iterations;
+  HuntPrintBenchResult(HuntStrBench, result, state);
+  HUNT_PRINT_EOL();
+#ifdef HUNT_USE_BENCH_BASELINE
+  HuntBenchSave(perOp, HUNT_BENCH_REPETITIONS);
+  HuntBenchCompare(perOp, HUNT_BENCH_REPETITIONS, HuntBenchHundredths(result->Median, result->Iterations));
+#endif
+  return 1;
+}
+
+/*-----------------------------------------------*/
+/* Measures one size of a sweep, param points to its index in HuntBenchRangeSizes. */
+static void HuntBenchRangeCase(const void *param) {
+  HUNT_UINT point = *(const HUNT_UINT *) param;
+  HuntBenchState state;
+  HuntBenchResult result;
+
+  state.Size = HuntBenchRangeSizes[point];
+  if (HuntBenchMeasure(HuntBenchRangeFunc, &state, &result)) {
+#ifndef HUNT_EXCLUDE_FLOAT
+    HuntBenchRangeTimes[point] = (HUNT_FLOAT) result.Median / (HUNT_FLOAT) result.Iterations;
+#endif
+  }
+}
+#endif
+
+/*-----------------------------------------------*/
+void HuntRunBenchmark(HuntBenchFunction Func) {
+#ifndef HUNT_INCLUDE_BENCHMARK
+  (void) Func;
+  HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrBenchmark);
+#else
+  HuntBenchState state;
+  HuntBenchResult result;
+
+  state.Size = 0;
+  (void) HuntBenchMeasure(Func, &state, &result);
+#endif
+}
+
+/*-----------------------------------------------*/
+void HuntRunBenchmarkRange(HuntBenchFunction Func, const HUNT_UINT first, const HUNT_UINT last,
+                           const HUNT_UINT factor, const HUNT_BIG_O_T expected) {
+#ifndef HUNT_INCLUDE_BENCHMARK
+  (void) Func;
+  (void) first;
+  (void) last;
+  (void) factor;
+  (void) expected;
+  HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrBenchmark);
+#else
+  HUNT_UINT step = (factor < 2) ? 2 : factor;
+  HUNT_UINT size = (first < 1) ? 1 : first;
+  HUNT_UINT count = 0;
+  HUNT_UINT i, length;
+#ifndef HUNT_EXCLUDE_FLOAT
+  HUNT_BIG_O_T best;
+  HUNT_FLOAT rms;
+#endif
+
+  /* first, first * factor, ... and last itself */
+  while ((size <= last) && (count < HUNT_BENCH_MAX_POINTS)) {
+    HuntBenchRangeSizes[count++] = size;
+    if (size > (last / step)) {
+      break;
+    }
+    size *= step;
+  }
+  if ((count > 0) && (count < HUNT_BENCH_MAX_POINTS) && (HuntBenchRangeSizes[count - 1] < last)) {
+    HuntBenchRangeSizes[count++] = last;
+  }
+
+  HuntBenchRangeFunc = Func;
+  HuntParamsBegin();
+  for (i = 0; i < count; i++) {
+    length = HuntParamsAppendNumber(HuntParamsNameBegin(HuntParamsTestName), (HUNT_INT) HuntBenchRangeSizes[i]);
+    HuntParamsCase(HuntBenchRangeCase, &i, HuntParamsNameEnd(length));
+  }
+  HuntParamsEnd(count);
+  if (Hunt.CurrentTestFailed || Hunt.CurrentTestIgnored || (count < 2)) {
+    return;
+  }
+
+#ifdef HUNT_EXCLUDE_FLOAT
+  if (expected != HUNT_BIG_O_ANY) {
+    HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrFloat);
+  }
+#else
+  best = HuntBigOFit(HuntBenchRangeSizes, HuntBenchRangeTimes, count, &rms);
+  HuntTestResultsBegin(Hunt.TestFile, Hunt.CurrentTestLineNumber);
+  HuntPrint(HuntStrBigO);
+  HuntPrint(HuntBigONames[best]);
+  HuntPrint(HuntStrBigORms);
+  HuntPrintQuotient((HUNT_UINT) ((rms * 10000.0f) + 0.5f), 100);
+  HUNT_OUTPUT_CHAR('%');
+  HUNT_PRINT_EOL();
+  if ((expected != HUNT_BIG_O_ANY) && (best != expected)) {
+    HuntTestResultsFailBegin(Hunt.CurrentTestLineNumber);
+    HuntPrint(HuntStrExpected);
+    HuntPrint(HuntBigONames[expected]);
+    HuntPrint(HuntStrWas);
+    HuntPrint(HuntBigONames[best]);
+    HUNT_FAIL_AND_BAIL;
+  }
+#endif
+#endif
+}
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+/*-----------------------------------------------*/
+/* Index of the lower end of the confidence interval of the median of count sorted values: the
+ * largest i for which i or fewer of them fall below the median with probability of at most
+ * HUNT_BENCH_ALPHA_PERCENT / 2, as in a sign test. Too few values for that leave index 0. */
+HUNT_UINT HuntBenchMedianInterval(const HUNT_UINT count) {
+  HUNT_UINT total = 1;
+  HUNT_UINT ways = 1;
+  HUNT_UINT below = 0;
+  HUNT_UINT k;
+
+  for (k = 0; k < count; k++) {
+    total *= 2;
+  }
+  for (k = 0; (k < count / 2) && (((below + ways) * 200u) <= (total * HUNT_BENCH_ALPHA_PERCENT)); k++) {
+    below += ways;
+    ways = (ways * (count - k)) / (k + 1);
+  }
+  return (k > 0) ? (k - 1) : 0; /* k values below have too high a probability, k - 1 don't */
+}
+
+/*-----------------------------------------------*/
+/* Pseudo random coin to pick which of A and B runs first */
+static int HuntBenchCoin(HUNT_UINT *seed) {
+  *seed = (*seed * 1103515245u) + 12345u;
+  return (int) ((*seed >> 16) & 1u);
+}
+
+/*-----------------------------------------------*/
+static void HuntPrintBenchAB(const HUNT_UINT *ratios, const HUNT_UINT low, const HUNT_UINT high,
+                             const HuntBenchResult *a, const HuntBenchResult *b) {
+  HUNT_UINT ratio = HuntMedianOfSorted(ratios, HUNT_BENCH_AB_PAIRS);
+  HUNT_UINT difference = (ratio > 10000) ? (ratio - 10000) : (10000 - ratio);
+
+  HuntTestResultsBegin(Hunt.TestFile, Hunt.CurrentTestLineNumber);
+  HuntPrint(HuntStrBenchAB);
+  HuntPrintQuotient(ratio, 10000);
+  HuntPrint(HuntStrBenchABInterval);
+  HuntPrintNumberUnsigned(100 - HUNT_BENCH_ALPHA_PERCENT);
+  HuntPrint(HuntStrBenchABConfidence);
+  HuntPrintQuotient(low, 10000);
+  HuntPrint(HuntStrBenchABTo);
+  HuntPrintQuotient(high, 10000);
+  HuntPrint(HuntStrBenchABMedianA);
+  HuntPrintQuotient(a->Median, 100);
+  HuntPrint(HuntStrBenchABMedianB);
+  HuntPrintQuotient(b->Median, 100);
+  HuntPrint(HuntStrBenchRuns);
+  HuntPrintNumberUnsigned(HUNT_BENCH_AB_PAIRS);
+  HuntPrint(HuntStrBenchABPairs);
+  if ((a->Cv > difference) || (b->Cv > difference)) {
+    HuntPrint(HuntStrBenchNoisyAB);
+  }
+  HUNT_PRINT_EOL();
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Times A and B in HUNT_BENCH_AB_PAIRS pairs of runs, each pair in random order, and reports
+ * the median of B's time relative to A's. With faster > 0, the test fails unless B is at least
+ * that many percent faster than A by the whole confidence interval of that median. */
+void HuntRunBenchmarkAB(HuntBenchFunction FuncA, HuntBenchFunction FuncB, const HUNT_UINT faster) {
+#ifndef HUNT_INCLUDE_BENCHMARK
+  (void) FuncA;
+  (void) FuncB;
+  (void) faster;
+  HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrBenchmark);
+#else
+  HuntBenchState a;
+  HuntBenchState b;
+  HuntBenchResult resultA;
+  HuntBenchResult resultB;
+  HUNT_UINT timesA[HUNT_BENCH_AB_PAIRS];
+  HUNT_UINT timesB[HUNT_BENCH_AB_PAIRS];
+  HUNT_UINT ratios[HUNT_BENCH_AB_PAIRS];
+  HUNT_UINT seed = (HUNT_UINT) HUNT_CLOCK_NS();
+  HUNT_UINT i, low, high;
+
+  if (faster >= 100) {
+    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, HuntStrErrBenchABFaster);
+    return; /* without setjmp.h the test goes on after failing */
+  }
+  a.Size = 0;
+  b.Size = 0;
+  if (!HuntBenchCalibrate(FuncA, &a) || !HuntBenchCalibrate(FuncB, &b)) {
+    return;
+  }
+  for (i = 0; i < HUNT_BENCH_AB_PAIRS; i++) {
+    if (HuntBenchCoin(&seed)) {
+      if (!HuntBenchRun(FuncB, &b) || !HuntBenchRun(FuncA, &a)) {
+        return;
+      }
+    } else if (!HuntBenchRun(FuncA, &a) || !HuntBenchRun(FuncB, &b)) {
+      return;
+    }
+    timesA[i] = HuntBenchHundredths(a.Elapsed, a.Iterations);
+    timesB[i] = HuntBenchHundredths(b.Elapsed, b.Iterations);
+    ratios[i] = HuntBenchRatio(timesB[i], timesA[i]);
+  }
+
+  HuntSortSamples(ratios, HUNT_BENCH_AB_PAIRS);
+  i = HuntBenchMedianInterval(HUNT_BENCH_AB_PAIRS);
+  low = ratios[i];
+  high = ratios[HUNT_BENCH_AB_PAIRS - 1 - i];
+  HuntBenchSummarize(timesA, HUNT_BENCH_AB_PAIRS, &resultA);
+  HuntBenchSummarize(timesB, HUNT_BENCH_AB_PAIRS, &resultB);
+  HuntPrintBenchAB(ratios, low, high, &resultA, &resultB);
+
+  if ((faster > 0) && (high > ((100 - faster) * 100))) {
+    HuntTestResultsFailBegin(Hunt.CurrentTestLineNumber);
+    HuntPrint(HuntStrExpected);
+    HuntPrint(HuntStrBenchABBelow);
+    HuntPrintQuotient((100 - faster) * 100, 10000);
+    HuntPrint(HuntStrWas);
+    HuntPrint(HuntStrBenchABUpTo);
+    HuntPrintQuotient(high, 10000);
+    HUNT_FAIL_AND_BAIL;
+  }
+#endif
+}
+
+#ifdef HUNT_USE_BENCH_ENVIRONMENT
+/*-----------------------------------------------*/
+/* Starts a line of warning about the environment, the caller finishes it */
+static void HuntPrintWarning(const char *message) {
+  HuntPrint(HuntStrWarning);
+  HuntPrint(message);
+}
+
+/*-----------------------------------------------*/
+/* Warns unless the CPU runs the "performance" governor, which keeps it at its highest frequency. */
+static void HuntCheckGovernor(const int cpu) {
+  static const char performance[] = "performance";
+  char path[80];
+  char governor[32];
+  FILE *file;
+  int i = 0;
+
+  (void) sprintf(path, "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_governor", cpu);
+  file = fopen(path, "r");
+  if (file == NULL) {
+    return; /* no frequency scaling, or none that Linux controls */
+  }
+  if (fscanf(file, "%31s", governor) != 1) {
+    (void) fclose(file);
+    return; /* nothing readable to warn about */
+  }
+  while ((performance[i] != '\0') && (governor[i] == performance[i])) {
+    i++;
+  }
+  if (governor[i] != performance[i]) {
+    HuntPrintWarning(HuntStrGovernorCpu);
+    HuntPrintNumber((HUNT_INT) cpu);
+    HuntPrint(HuntStrGovernor);
+    HuntPrint(governor);
+    HuntPrint(HuntStrGovernorEnd);
+    HUNT_PRINT_EOL();
+  }
+  (void) fclose(file);
+}
+
+/*-----------------------------------------------*/
+/* Spins until the CPU has left its idle frequency: until three rounds of a loop in a row are no
+ * more than 1% faster than the one before, or HUNT_WARMUP_MAX_NS have passed. */
+static void HuntWarmup(void) {
+  static volatile HUNT_UINT sink;
+  HUNT_UINT start = (HUNT_UINT) HUNT_CLOCK_NS();
+  HUNT_UINT last = 0;
+  HUNT_UINT steady = 0;
+  HUNT_UINT round, begin, i;
+
+  while ((steady < 3) && (((HUNT_UINT) HUNT_CLOCK_NS() - start) < HUNT_WARMUP_MAX_NS)) {
+    begin = (HUNT_UINT) HUNT_CLOCK_NS();
+    for (i = 0; i < 100000; i++) {
+      sink += i;
+    }
+    round = (HUNT_UINT) HUNT_CLOCK_NS() - begin;
+    steady = ((last > 0) && ((round * 100) >= (last * 99))) ? (steady + 1) : 0;
+    last = round;
+  }
+}
+
+/*-----------------------------------------------*/
+/* Gets the CPU ready for timed tests, once per process. */
+static void HuntPrepareEnvironment(void) {
+  static int prepared;
+  int cpu = 0;
+
+  if (prepared) {
+    return;
+  }
+  prepared = 1;
+#ifdef HUNT_PIN_CPU
+  {
+    unsigned long mask[(HUNT_PIN_CPU / (8 * sizeof(unsigned long))) + 1];
+    unsigned i;
+
+    for (i = 0; i < (sizeof(mask) / sizeof(mask[0])); i++) {
+      mask[i] = 0;
+    }
+    mask[HUNT_PIN_CPU / (8 * sizeof(unsigned long))] = 1ul << (HUNT_PIN_CPU % (8 * sizeof(unsigned long)));
+    cpu = HUNT_PIN_CPU;
+    if (syscall(SYS_sched_setaffinity, 0, sizeof(mask), mask) != 0) {
+      HuntPrintWarning(HuntStrErrPinCpu);
+      HuntPrintNumber((HUNT_INT) HUNT_PIN_CPU);
+      HUNT_PRINT_EOL();
+    }
+  }
+#endif
+#ifdef HUNT_PRIORITY
+  if (setpriority(PRIO_PROCESS, 0, HUNT_PRIORITY) != 0) {
+    HuntPrintWarning(HuntStrErrPriority);
+    HuntPrintNumber((HUNT_INT) HUNT_PRIORITY);
+    HUNT_PRINT_EOL();
+  }
+#endif
+  HuntCheckGovernor(cpu);
+  HuntWarmup();
+}
+#endif
+
+/*-----------------------------------------------*/
+/* Measures a benchmark warm, then in runs of HUNT_BENCH_COLD_ITERATIONS iterations that each
+ * start with the caches evicted, and reports how much slower those are. */
+void HuntRunBenchmarkCold(HuntBenchFunction Func) {
+#ifndef HUNT_INCLUDE_BENCHMARK
+  (void) Func;
+  HUNT_TEST_IGNORE(Hunt.CurrentTestLineNumber, HuntStrErrBenchmark);
+#else
+  HuntBenchState state;
+  HuntBenchResult warm;
+  HuntBenchResult cold;
+  HUNT_UINT samples[HUNT_BENCH_REPETITIONS];
+  HUNT_UINT i;
+
+  state.Size = 0;
+  if (!HuntBenchMeasure(Func, &state, &warm)) {
+    return;
+  }
+#ifdef HUNT_USE_BENCH_EVICT_BUFFER
+  if (!HuntBenchEvictPrepare()) {
+    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, HuntStrErrBenchEvict);
+    return; /* without setjmp.h the test goes on after failing */
+  }
+#endif
+
+  state.Cold = 1;
+  state.Iterations = HUNT_BENCH_COLD_ITERATIONS;
+  for (i = 0; i < HUNT_BENCH_REPETITIONS; i++) {
+    if (!HuntBenchRun(Func, &state)) {
+      return;
+    }
+    samples[i] = state.Elapsed;
+  }
+  HuntBenchSummarize(samples, HUNT_BENCH_REPETITIONS, &cold);
+  cold.Iterations = state.Iterations;
+
+  HuntPrintBenchResult(HuntStrBenchCold, &cold, &state);
+  HUNT_OUTPUT_CHAR(',');
+  HUNT_OUTPUT_CHAR(' ');
+  HuntPrintQuotient(HuntBenchRatio(HuntBenchHundredths(cold.Median, cold.Iterations),
+                                   HuntBenchHundredths(warm.Median, warm.Iterations)) / 100, 100);
+  HuntPrint(HuntStrBenchWarm);
+  HUNT_PRINT_EOL();
+#endif
+}
+
+/*-----------------------------------------------*/
+void HuntBegin(const char *filename) {
+#ifdef HUNT_USE_SLOWEST_TESTS
+  int i;
+#endif
+
+  Hunt.TestFile = filename;
+  Hunt.CurrentTestName = NULL;
+  Hunt.CurrentTestLineNumber = 0;
+  Hunt.CurrentTestFailed = 0;
+  Hunt.CurrentTestIgnored = 0;
+  HUNT_CLR_DETAILS();
+  HUNT_SET_TIME_BUDGET(0);
+#ifdef HUNT_USE_TRACE
+  if (filename != NULL) {
+    if (!HuntAggregating) {
+      HuntTraceProcessName(filename);
+    }
+    HuntTraceBegin(filename, "file");
+  }
+#endif
+
+  if (HuntAggregating) {
+    /* Another test file of an aggregated run, so the counts keep adding up */
+    HuntAggregateFileFailures = Hunt.TestFailures;
+    return;
+  }
+
+  Hunt.NumberOfTests = 0;
+  Hunt.TestFailures = 0;
+  Hunt.TestIgnores = 0;
+  HUNT_OUTPUT_START();
+#ifdef HUNT_USE_BENCH_ENVIRONMENT
+  HuntPrepareEnvironment();
+#endif
+  /* the clock is read at full speed now */
+#if defined(HUNT_USE_EXEC_TIME_NS) || defined(HUNT_INCLUDE_PHASE_TIMES)
+  HuntExecTimeOverhead = HuntClockOverhead();
+#endif
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+  HuntPhaseReset(HuntPhaseTotals);
+  HuntPhaseVerified = 0;
+#endif
+#ifdef HUNT_USE_SLOWEST_TESTS
+  HuntSlowestCount = 0;
+  HuntTestTimeTotal = 0;
+  HuntTestTimeCount = 0;
+  for (i = 0; i < 8; i++) {
+    HuntTestDurations[i] = 0;
+  }
+#endif
+#ifdef HUNT_INCLUDE_BENCHMARK
+  HuntBenchClockOverhead = HuntClockOverhead();
+#endif
+}
+
+/*-----------------------------------------------*/
+int HuntEnd(void) {
+#ifdef HUNT_USE_TRACE
+  HuntTraceFinish();
+#endif
+#ifdef HUNT_USE_PROFILER
+  if (HuntProfileFile != NULL) {
+    (void) fflush(HuntProfileFile);
+  }
+#endif
+  if (HuntAggregating) {
+    /* The summary is printed by HuntAggregateEnd(), this file only reports its own failures */
+    return (int) (Hunt.TestFailures - HuntAggregateFileFailures);
+  }
+
+  HUNT_PRINT_EOL();
+#ifdef HUNT_USE_SLOWEST_TESTS
+  HuntPrintTestTimes();
+#endif
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+  HuntPrint(HuntStrPhases);
+  HuntPrintPhases(HuntPhaseTotals);
+  HUNT_PRINT_EOL();
+#endif
+  HuntPrint(HuntStrBreaker);
+  HUNT_PRINT_EOL();
+  HuntPrintNumber((HUNT_INT) (Hunt.NumberOfTests));
+  HuntPrint(HuntStrResultsTests);
+  HuntPrintNumber((HUNT_INT) (Hunt.TestFailures));
+  HuntPrint(HuntStrResultsFailures);
+  HuntPrintNumber((HUNT_INT) (Hunt.TestIgnores));
+  HuntPrint(HuntStrResultsIgnored);
+  HUNT_PRINT_EOL();
+  if (Hunt.TestFailures == 0U) {
+    HuntPrint(HuntStrOk);
+  } else {
+    HuntPrint(HuntStrFail);
+#ifdef HUNT_DIFFERENTIATE_FINAL_FAIL
+    HUNT_OUTPUT_CHAR('E'); HUNT_OUTPUT_CHAR('D');
+#endif
+  }
+  HUNT_PRINT_EOL();
+  HUNT_FLUSH_CALL();
+  HUNT_OUTPUT_COMPLETE();
+#ifdef HUNT_USE_BENCH_BASELINE
+  HuntBenchClose();
+#endif
+#ifdef HUNT_USE_BENCH_EVICT_BUFFER
+  free(HuntBenchEvictBuffer);
+  HuntBenchEvictBuffer = NULL;
+#endif
+#ifdef HUNT_USE_PERF_EVENTS
+  HuntPerfClose();
+#endif
+  return (int) (Hunt.TestFailures);
+}
+
+/*-----------------------------------------------*/
+void HuntAggregateBegin(void) {
+  HuntAggregating = 0;
+  HuntBegin(NULL);
+  HuntAggregating = 1;
+  HuntAggregateFileFailures = 0;
+}
+
+/*-----------------------------------------------*/
+int HuntAggregateEnd(void) {
+  HuntAggregating = 0;
+  return HuntEnd();
+}
+
+/*-----------------------------------------------
+ * Command Line Argument Support
+ *-----------------------------------------------*/
+#ifdef HUNT_USE_COMMAND_LINE_ARGS
+
+char* HuntOptionIncludeNamed = NULL;
+char* HuntOptionIncludeExact = NULL;
+char* HuntOptionExcludeNamed = NULL;
+int HuntVerbosity            = 1;
+
+/*-----------------------------------------------*/
+/* Returns what follows "name=" at the start of an option, or NULL if it is another option */
+static const char* HuntOptionValue(const char* option, const char* name)
+{
+    while (*name && (*option == *name))
+    {
+        option++;
+        name++;
+    }
+    return (*name == 0) ? option : NULL;
+}
+
+/*-----------------------------------------------*/
+/* Handles an option given as --name=value, returns 1 if it is not known, or -1 if it failed and
+ * said why. The benchmark, time budget, trace and profile options are accepted even when those
+ * are left out, as they do nothing then. */
+static int HuntParseLongOption(const char* option)
+{
+    const char* value;
+    HUNT_UINT threshold = 0;
+    HUNT_UINT scale = 0;
+
+    if ((value = HuntOptionValue(option, "bench-save=")) != NULL)
+    {
+#ifdef HUNT_USE_BENCH_BASELINE
+        HuntBenchSavePath = value;
+#endif
+        return 0;
+    }
+    if ((value = HuntOptionValue(option, "bench-compare=")) != NULL)
+    {
+#ifdef HUNT_USE_BENCH_BASELINE
+        HuntBenchComparePath = value;
+#endif
+        return 0;
+    }
+    if ((value = HuntOptionValue(option, "bench-threshold=")) != NULL)
+    {
+        while ((*value >= '0') && (*value <= '9'))
+        {
+            threshold = (threshold * 10) + (HUNT_UINT)(*value++ - '0');
+        }
+        if ((*value == '%') && (value[1] == 0))
+        {
+            value++;
+        }
+#ifdef HUNT_USE_BENCH_BASELINE
+        HuntBenchThreshold = threshold;
+#endif
+        return (*value == 0) ? 0 : 1;
+    }
+    if ((value = HuntOptionValue(option, "time-budget-scale=")) != NULL)
+    {
+        while ((*value >= '0') && (*value <= '9'))
+        {
+            scale = (scale * 10) + (HUNT_UINT)(*value++ - '0');
+        }
+        if ((*value == '%') && (value[1] == 0))
+        {
+            value++;
+        }
+#ifdef HUNT_USE_TIME_BUDGETS
+        HuntTimeBudgetScale = scale;
+#endif
+        return ((*value == 0) && (scale > 0)) ? 0 : 1;
+    }
+    if ((value = HuntOptionValue(option, "trace=")) != NULL)
+    {
+#ifdef HUNT_USE_TRACE
+        return (HuntTraceOpen(value) == 0) ? 0 : -1;
+#else
+        return 0;
+#endif
+    }
+    if ((value = HuntOptionValue(option, "profile=")) != NULL)
+    {
+#ifdef HUNT_USE_PROFILER
+        return (HuntProfileOpen(value) == 0) ? 0 : -1;
+#else
+        return 0;
+#endif
+    }
+    return 1;
+}
+
+/*-----------------------------------------------*/
+int HuntParseOptions(int argc, char** argv)
+{
+    HuntOptionIncludeNamed = NULL;
+    HuntOptionIncludeExact = NULL;
+    HuntOptionExcludeNamed = NULL;
+    int i;
+    int status;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (argv[i][0] == '-')
+        {
+            switch (argv[i][1])
+            {
+                case 'l': /* list tests */
+                    return -1;
+                case 'n': /* include tests with name including this string */
+                case 'f': /* an alias for -n */
+                    if (argv[i][2] == '=')
+                    {
+                        HuntOptionIncludeNamed = &argv[i][3];
+                    }
+                    else if (++i < argc)
+                    {
+                        HuntOptionIncludeNamed = argv[i];
+                    }
+                    else
+                    {
+                        HuntPrint("ERROR: No Test String to Include Matches For");
+                        HUNT_PRINT_EOL();
+                        return 1;
+                    }
+                    break;
+                case 'e': /* include only the test with exactly this name */
+                    if (argv[i][2] == '=')
+                    {
+                        HuntOptionIncludeExact = &argv[i][3];
+                    }
+                    else if (++i < argc)
+                    {
+                        HuntOptionIncludeExact = argv[i];
+                    }
+                    else
+                    {
+                        HuntPrint("ERROR: No Test Name to Include Exactly");
+                        HUNT_PRINT_EOL();
+                        return 1;
+                    }
+                    break;
+                case 'q': /* quiet */
+                    HuntVerbosity = 0;
+                    break;
+                case 'v': /* verbose */
+                    HuntVerbosity = 2;
+                    break;
+                case 'x': /* exclude tests with name including this string */
+                    if (argv[i][2] == '=')
+                    {
+                        HuntOptionExcludeNamed = &argv[i][3];
+                    }
+                    else if (++i < argc)
+                    {
+                        HuntOptionExcludeNamed = argv[i];
+                    }
+                    else
+                    {
+                        HuntPrint("ERROR: No Test String to Exclude Matches For");
+                        HUNT_PRINT_EOL();
+                        return 1;
+                    }
+                    break;
+                case '-': /* long options */
+                    status = HuntParseLongOption(&argv[i][2]);
+                    if (status == 0)
+                    {
+                        break;
+                    }
+                    if (status > 0)
+                    {
+                        HuntPrint("ERROR: Unknown Option ");
+                        HuntPrint(argv[i]);
+                        HUNT_PRINT_EOL();
+                    }
+                    return 1;
+                default:
+                    HuntPrint("ERROR: Unknown Option ");
+                    HUNT_OUTPUT_CHAR(argv[i][1]);
+                    HUNT_PRINT_EOL();
+                    return 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/*-----------------------------------------------*/
+int IsStringInBiggerString(const char* longstring, const char* shortstring)
+{
+    const char* lptr = longstring;
+    const char* sptr = shortstring;
+    const char* lnext = lptr;
+
+    if (*sptr == '*')
+    {
+        return 1;
+    }
+
+    while (*lptr)
+    {
+        lnext = lptr + 1;
+
+        /* If they current bytes match, go on to the next bytes */
+        while (*lptr && *sptr && (*lptr == *sptr))
+        {
+            lptr++;
+            sptr++;
+
+            /* We're done if we match the entire string or up to a wildcard */
+            if (*sptr == '*')
+                return 1;
+            if (*sptr == ',')
+                return 1;
+            if (*sptr == '"')
+                return 1;
+            if (*sptr == '\'')
+                return 1;
+            if (*sptr == ':')
+                return 2;
+            if (*sptr == 0)
+                return 1;
+        }
+
+        /* Otherwise we start in the long pointer 1 character further and try again */
+        lptr = lnext;
+        sptr = shortstring;
+    }
+
+    return 0;
+}
+
+/*-----------------------------------------------*/
+int HuntStringArgumentMatches(const char* str)
+{
     int retval;
     const char* ptr1;
     const char* ptr2;
@@ -1792,6 +4890,17 @@ int HuntStringArgumentMatches(const char* str)
     return 0;
 }
 
+/*-----------------------------------------------*/
+static int HuntStringsAreEqual(const char* str1, const char* str2)
+{
+    while (*str1 && (*str1 == *str2))
+    {
+        str1++;
+        str2++;
+    }
+    return (*str1 == *str2);
+}
+
 /*-----------------------------------------------*/
 int HuntTestMatches(void)
 {
@@ -1806,6 +4915,15 @@ int HuntTestMatches(void)
         retval = 1;
     }
 
+    /* Check if this test name is the one test asked for by name */
+    if (HuntOptionIncludeExact)
+    {
+        if (!HuntStringsAreEqual(Hunt.CurrentTestName, HuntOptionIncludeExact))
+        {
+            retval = 0;
+        }
+    }
+
     /* Check if this test name matches the excluded test pattern */
     if (HuntOptionExcludeNamed)
     {
@@ -1815,6 +4933,12 @@ int HuntTestMatches(void)
         }
     }
 
+    /* A test that does not run leaves its time budget to none */
+    if (!retval)
+    {
+        HUNT_SET_TIME_BUDGET(0);
+    }
+
     return retval;
 }
 
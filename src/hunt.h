@@ -87,6 +87,12 @@ int suiteTearDown(int num_failures) { return num_failures; }
  * Output
  *     - by default, Hunt prints to standard out with putchar.  define HUNT_OUTPUT_CHAR(a) with a different function if desired
  *     - define HUNT_DIFFERENTIATE_FINAL_FAIL to print FAILED (vs. FAIL) at test end summary - for automated search for failure
+ *     - define HUNT_INCLUDE_EXEC_TIME to print the time each test takes, from ns to s
+ *     - define HUNT_TIME_BUDGET_SCALE (default 100) to scale TEST_TIME_BUDGET budgets by a percentage
+ *     - define HUNT_INCLUDE_PHASE_TIMES to time setUp, the test, tearDown and mock verification apart
+ *     - define HUNT_SLOWEST_TESTS to a count of slowest tests to list, with a summary of all test times
+ *     - define HUNT_INCLUDE_TRACE to write a Chrome trace of the tests and their phases with --trace=file.json
+ *     - define HUNT_INCLUDE_PROFILER to sample the stacks of each test for flame graphs with --profile=file.folded
 
  * Optimization
  *     - by default, line numbers are stored in unsigned shorts.  Define HUNT_LINE_TYPE with a different type if your files are huge
@@ -97,6 +103,23 @@ int suiteTearDown(int num_failures) { return num_failures; }
 
  * Parameterized Tests
  *     - you'll want to create a define of TEST_CASE(...) which basically evaluates to nothing
+ *     - or define HUNT_INCLUDE_PARAMS to run TEST_PARAMS and TEST_COMBINATIONS tests, they are ignored otherwise
+ *     - use TEST_PARAMS to run a test over a const table, which needs no help from the runner generator
+ *     - define HUNT_PARAMS_NAME_LENGTH to change the space for names of failing cases (default 64)
+ *     - or use TEST_COMBINATIONS to sweep over ranges and tables of values, all combinations or pairwise
+ *     - define HUNT_COMBINATIONS_MAX_AXES (default 8) or HUNT_PAIRWISE_MAX_PAIRS (default 4096) for bigger sweeps
+
+ * Benchmarks
+ *     - define HUNT_INCLUDE_BENCHMARK to run TEST_BENCHMARK tests, they are ignored otherwise
+ *     - define HUNT_CLOCK_NS() to return a nanosecond count on targets without clock_gettime or QueryPerformanceCounter
+ *     - define HUNT_CLOCK_SOURCE to read another clock_gettime clock, e.g. CLOCK_THREAD_CPUTIME_ID
+ *     - define HUNT_BENCH_MIN_NS (default 10ms) or HUNT_BENCH_REPETITIONS (default 5) to measure longer
+ *     - define HUNT_BENCH_MAX_POINTS (default 32) for TEST_BENCHMARK_RANGE sweeps over more sizes
+ *     - define HUNT_BENCH_AB_PAIRS (default 15) to compare TEST_BENCHMARK_AB implementations more often
+ *     - define HUNT_BENCH_CACHE_BYTES (sysfs on Linux, else 32MB) or HUNT_BENCH_EVICT() for TEST_BENCHMARK_COLD
+ *     - define HUNT_PIN_CPU to a CPU number and HUNT_PRIORITY to a nice value for steadier times on Linux
+ *     - define HUNT_INCLUDE_PERF_COUNTERS on Linux to count instructions, cycles, cache misses etc. of each test
+ *     - define HUNT_INCLUDE_RUSAGE on unix-like hosts to print the cpu time, memory and faults of each test
 
  * Tests with Arguments
  *     - you'll want to define HUNT_USE_COMMAND_LINE_ARGS if you have the test runner passing arguments to Hunt
@@ -110,6 +133,7 @@ int suiteTearDown(int num_failures) { return num_failures; }
 #define TEST_IGNORE_MESSAGE(message)                                                               HUNT_TEST_IGNORE(__LINE__, (message))
 #define TEST_IGNORE()                                                                              HUNT_TEST_IGNORE(__LINE__, NULL)
 #define TEST_MESSAGE(message)                                                                      HuntMessage((message), __LINE__)
+#define TEST_PRINT_HISTOGRAM(histogram)                                                            HuntPrintHistogram((histogram), __LINE__)
 #define TEST_ONLY()
 
 /* It is not necessary for you to call PASS. A PASS condition is assumed if nothing fails.
@@ -121,6 +145,132 @@ int suiteTearDown(int num_failures) { return num_failures; }
  * which files should be linked to in order to perform a test. Use it like TEST_FILE("sandwiches.c") */
 #define TEST_FILE(a)
 
+/* Gives the test that follows a time budget, which the runner generator picks up. The test fails when
+ * it takes longer, setUp and tearDown included. Use it like TEST_TIME_BUDGET(5000000) void test_Sort(void).
+ * TEST_ASSERT_EXEC_TIME_BELOW checks the time taken so far instead. Both need HUNT_INCLUDE_EXEC_TIME. */
+#define TEST_TIME_BUDGET(budget)
+
+/* Parameterized tests driven by a const table, without help from the runner generator. The test is
+ * registered (and listed) once, its body runs for each entry of the table with `param` pointing to it:
+ *
+ *   static const SquareCase cases[] = { {1, 1}, {2, 4}, {3, 9} };
+ *   TEST_PARAMS(test_Square, SquareCase, cases)
+ *   {
+ *       TEST_ASSERT_EQUAL_INT(param->out, Square(param->in));
+ *   }
+ *
+ * A failing entry is reported as test_Square[1]. With TEST_PARAMS_NAMED, a function returning a label
+ * for an entry, like `const char* CaseName(const SquareCase* c)`, names it test_Square[label] instead.
+ * setUp and tearDown run once around all of the entries. */
+#define TEST_PARAMS(name, type, table) \
+    HUNT_PARAMS_PROTOTYPES(name, type) \
+    void name(void) { HUNT_PARAMS_RUN(name, table, NULL); } \
+    static void name##_params(const type *param)
+
+#define TEST_PARAMS_NAMED(name, type, table, formatter) \
+    HUNT_PARAMS_PROTOTYPES(name, type) \
+    static const char* name##_label(const void *param) { return formatter((const type *)param); } \
+    void name(void) { HUNT_PARAMS_RUN(name, table, name##_label); } \
+    static void name##_params(const type *param)
+
+/* Sweeps over combinations of several axes of integer values, each given as a table or as an inclusive range:
+ *
+ *   static const HUNT_INT widths[] = { 8, 16, 32 };
+ *   static const HuntAxis axes[] = { HUNT_AXIS_RANGE(0, 1024, 64), HUNT_AXIS_VALUES(widths) };
+ *   TEST_COMBINATIONS(test_Copy, axes, HUNT_CARTESIAN)
+ *   {
+ *       TEST_ASSERT_EQUAL_INT(0, Copy(param[0], param[1]));
+ *   }
+ *
+ * `param` holds one value per axis. HUNT_CARTESIAN runs every combination, HUNT_PAIRWISE only enough of them
+ * to cover each pair of values of any two axes. A failing combination is reported as test_Copy[64,16]. */
+#define HUNT_AXIS_VALUES(values)           { (values), 0, 0, (HUNT_UINT)(sizeof(values) / sizeof((values)[0])) }
+#define HUNT_AXIS_RANGE(first, last, step) { 0, (first), (step), (HUNT_UINT)((((last) - (first)) / (step)) + 1) }
+
+#define TEST_COMBINATIONS(name, axes, mode) \
+    void name(void); \
+    static void name##_combination(const HUNT_INT *param); \
+    static void name##_thunk(const void *param) { name##_combination((const HUNT_INT *)param); } \
+    void name(void) { HuntRunCombinations(name##_thunk, (axes), (HUNT_UINT)(sizeof(axes) / sizeof((axes)[0])), (mode)); } \
+    static void name##_combination(const HUNT_INT *param)
+
+/* Micro-benchmarks. The body sets up whatever it needs, then times its HUNT_BENCH_LOOP:
+ *
+ *   TEST_BENCHMARK(test_Checksum)
+ *   {
+ *       HUNT_BENCH_LOOP(state)
+ *       {
+ *           unsigned sum = Checksum(buffer, sizeof(buffer));
+ *           HUNT_DO_NOT_OPTIMIZE(sum);
+ *       }
+ *   }
+ *
+ * The loop runs often enough to take HUNT_BENCH_MIN_NS, then HUNT_BENCH_REPETITIONS more times, and the
+ * median, minimum and median absolute deviation per iteration are reported on a BENCH line. Needs
+ * HUNT_INCLUDE_BENCHMARK, benchmarks are ignored otherwise. HUNT_DO_NOT_OPTIMIZE(value) and
+ * HUNT_CLOBBER_MEMORY() keep the optimizer from deleting results and writes that go unused. */
+#define TEST_BENCHMARK(name) \
+    void name(void); \
+    static void name##_bench(HuntBenchState *state); \
+    void name(void) { HuntRunBenchmark(name##_bench); } \
+    static void name##_bench(HuntBenchState *state)
+
+#define HUNT_BENCH_LOOP(state) for (HuntBenchStart(state); ((state)->Remaining-- > 0) || HuntBenchStop(state); )
+
+/* Items or bytes one iteration of the loop handles, to report its throughput as well */
+#define HUNT_BENCH_ITEMS(state, items) ((state)->Items = (HUNT_UINT)(items))
+#define HUNT_BENCH_BYTES(state, bytes) ((state)->Bytes = (HUNT_UINT)(bytes))
+
+/* Sweeps a benchmark over the sizes first, first * factor, ... up to last, which it reads from
+ * state->Size:
+ *
+ *   TEST_BENCHMARK_RANGE(test_Parse_Scales, 1024, 1 << 24, 4)
+ *   {
+ *       HUNT_BENCH_BYTES(state, state->Size);
+ *       HUNT_BENCH_LOOP(state)
+ *       {
+ *           Parse(input, state->Size);
+ *       }
+ *   }
+ *
+ * Each size is reported on its own BENCH line, as "test_Parse_Scales[4096]". Then the times are
+ * fitted against O(1), O(log n), O(n), O(n log n) and O(n^2), and the best fit is reported on a
+ * BIG-O line. TEST_BENCHMARK_COMPLEXITY also fails unless that is the expected HUNT_BIG_O_T. */
+#define TEST_BENCHMARK_RANGE(name, first, last, factor) \
+    TEST_BENCHMARK_COMPLEXITY(name, first, last, factor, HUNT_BIG_O_ANY)
+
+#define TEST_BENCHMARK_COMPLEXITY(name, first, last, factor, bigO) \
+    void name(void); \
+    static void name##_bench(HuntBenchState *state); \
+    void name(void) { HuntRunBenchmarkRange(name##_bench, (HUNT_UINT)(first), (HUNT_UINT)(last), (HUNT_UINT)(factor), (bigO)); } \
+    static void name##_bench(HuntBenchState *state)
+
+/* Like TEST_BENCHMARK, but measures each iteration with cold caches as well. After the warm BENCH
+ * line, a COLD line reports HUNT_BENCH_COLD_ITERATIONS iterations per run, with the caches evicted
+ * before each of them, outside of the time, and how much slower they are than warm ones. */
+#define TEST_BENCHMARK_COLD(name) \
+    void name(void); \
+    static void name##_bench(HuntBenchState *state); \
+    void name(void) { HuntRunBenchmarkCold(name##_bench); } \
+    static void name##_bench(HuntBenchState *state)
+
+/* Compares two benchmark functions, A the old and B the new implementation of something, in the
+ * same process. They run in pairs, in random order within each pair, and B's time relative to A's
+ * is reported with a confidence interval. TEST_BENCHMARK_AB_FASTER fails unless B is at least that
+ * many percent, less than 100, faster over the whole interval:
+ *
+ *   static void ChecksumBytewise(HuntBenchState *state) { HUNT_BENCH_LOOP(state) { ... } }
+ *   static void ChecksumWordwise(HuntBenchState *state) { HUNT_BENCH_LOOP(state) { ... } }
+ *
+ *   TEST_BENCHMARK_AB_FASTER(test_Checksum_WordwiseIsFaster, ChecksumBytewise, ChecksumWordwise, 20);
+ */
+#define TEST_BENCHMARK_AB(name, a, b) TEST_BENCHMARK_AB_FASTER(name, a, b, 0)
+
+#define TEST_BENCHMARK_AB_FASTER(name, a, b, percent) \
+    void name(void); \
+    void name(void) { HuntRunBenchmarkAB((a), (b), (HUNT_UINT)(percent)); } \
+    void name(void)
+
 /*-------------------------------------------------------
  * Test Asserts (simple)
  *-------------------------------------------------------*/
@@ -338,6 +488,12 @@ int suiteTearDown(int num_failures) { return num_failures; }
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN(actual)                                                      HUNT_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, NULL)
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE(actual)                                              HUNT_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, NULL)
 
+/* Latency Histograms */
+#define TEST_ASSERT_PERCENTILE_BELOW(histogram, percentile, threshold)                             HUNT_TEST_ASSERT_PERCENTILE_BELOW((histogram), (percentile), (threshold), __LINE__, NULL)
+
+/* Time Budgets */
+#define TEST_ASSERT_EXEC_TIME_BELOW(budget)                                                        HUNT_TEST_ASSERT_EXEC_TIME_BELOW((budget), __LINE__, NULL)
+
 /* Shorthand */
 #ifdef HUNT_SHORTHAND_AS_OLD
 #define TEST_ASSERT_EQUAL(expected, actual)                                                        HUNT_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, NULL)
@@ -577,6 +733,12 @@ int suiteTearDown(int num_failures) { return num_failures; }
 #define TEST_ASSERT_DOUBLE_IS_NOT_NAN_MESSAGE(actual, message)                                     HUNT_TEST_ASSERT_DOUBLE_IS_NOT_NAN((actual), __LINE__, (message))
 #define TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE_MESSAGE(actual, message)                             HUNT_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE((actual), __LINE__, (message))
 
+/* Latency Histograms */
+#define TEST_ASSERT_PERCENTILE_BELOW_MESSAGE(histogram, percentile, threshold, message)            HUNT_TEST_ASSERT_PERCENTILE_BELOW((histogram), (percentile), (threshold), __LINE__, (message))
+
+/* Time Budgets */
+#define TEST_ASSERT_EXEC_TIME_BELOW_MESSAGE(budget, message)                                       HUNT_TEST_ASSERT_EXEC_TIME_BELOW((budget), __LINE__, (message))
+
 /* Shorthand */
 #ifdef HUNT_SHORTHAND_AS_OLD
 #define TEST_ASSERT_EQUAL_MESSAGE(expected, actual, message)                                       HUNT_TEST_ASSERT_EQUAL_INT((expected), (actual), __LINE__, (message))
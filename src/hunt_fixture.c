@@ -87,16 +87,27 @@ void HuntTestRunner(huntfunction *setup,
     HuntMalloc_StartTest();
     HuntPointer_Init();
 
+    HUNT_TRACE_TEST_START();
+    HUNT_RUSAGE_START();
     HUNT_EXEC_TIME_START();
+    HUNT_PERF_COUNTERS_START();
 
     if (TEST_PROTECT()) {
+      HUNT_PHASE_START(HUNT_PHASE_SETUP);
       setup();
+      HUNT_PHASE_START(HUNT_PHASE_TEST);
       testBody();
     }
     if (TEST_PROTECT()) {
+      HUNT_PHASE_START(HUNT_PHASE_TEARDOWN);
       teardown();
     }
+    HUNT_PHASE_STOP();
+    HUNT_PERF_COUNTERS_STOP();
+    HUNT_EXEC_TIME_STOP();
+    HUNT_RUSAGE_STOP();
     if (TEST_PROTECT()) {
+      HUNT_PHASE_START(HUNT_PHASE_VERIFY);
       HuntPointer_UndoAllSets();
       if (!Hunt.CurrentTestFailed) {
         if (HuntFixture.Verbose) {
@@ -105,7 +116,10 @@ void HuntTestRunner(huntfunction *setup,
         HuntMalloc_EndTest();
       }
     }
+    HUNT_PHASE_STOP();
     HuntConcludeFixtureTest();
+  } else {
+    HUNT_SET_TIME_BUDGET(0);
   }
 }
 
@@ -130,16 +144,29 @@ void HuntIgnoreTest(const char *printableName, const char *group, const char *na
 #define MALLOC_DONT_FAIL -1
 static int malloc_count;
 static int malloc_fail_countdown = MALLOC_DONT_FAIL;
+static HuntMallocStats malloc_stats;
+
+static void malloc_registry_clear(void);
+static const char *malloc_leak_report(void);
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+static void pool_start_test(void);
+static void pool_heap_stats(HuntMallocStats *stats);
+#endif
 
 void HuntMalloc_StartTest(void) {
   malloc_count = 0;
   malloc_fail_countdown = MALLOC_DONT_FAIL;
+  memset(&malloc_stats, 0, sizeof(malloc_stats));
+  malloc_registry_clear();
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+  pool_start_test();
+#endif
 }
 
 void HuntMalloc_EndTest(void) {
   malloc_fail_countdown = MALLOC_DONT_FAIL;
   if (malloc_count != 0) {
-    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, "This test leaks!");
+    HUNT_TEST_FAIL(Hunt.CurrentTestLineNumber, malloc_leak_report());
   }
 }
 
@@ -147,32 +174,495 @@ void HuntMalloc_MakeMallocFailAfterCount(int countdown) {
   malloc_fail_countdown = countdown;
 }
 
+void HuntMalloc_GetStats(HuntMallocStats *stats) {
+  *stats = malloc_stats;
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+  pool_heap_stats(stats);
+#endif
+}
+
+size_t HuntMalloc_Allocations(void) {
+  return malloc_stats.Allocations;
+}
+
+/* A handful of adds per call, cheap enough to always keep */
+static void malloc_stats_allocated(size_t size) {
+  size_t size_class = 0;
+
+  malloc_stats.Allocations++;
+  malloc_stats.BytesAllocated += size;
+  malloc_stats.LiveBytes += size;
+  if (malloc_stats.LiveBytes > malloc_stats.PeakLiveBytes) {
+    malloc_stats.PeakLiveBytes = malloc_stats.LiveBytes;
+  }
+  while ((size >>= 1) != 0 && (size_class < (HUNT_MALLOC_SIZE_CLASSES - 1))) {
+    size_class++;
+  }
+  malloc_stats.SizeClasses[size_class]++;
+}
+
+static void malloc_stats_freed(size_t size) {
+  malloc_stats.Frees++;
+  /* blocks allocated before the test were not counted as live */
+  malloc_stats.LiveBytes -= (size < malloc_stats.LiveBytes) ? size : malloc_stats.LiveBytes;
+}
+
 /* These definitions are always included from hunt_fixture_malloc_overrides.h */
 /* We undef to use them or avoid conflict with <stdlib.h> per the C standard */
 #undef malloc
 #undef free
 #undef calloc
 #undef realloc
+#undef aligned_alloc
+#undef posix_memalign
+#undef memalign
 
-#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
-static unsigned char hunt_heap[HUNT_INTERNAL_HEAP_SIZE_BYTES];
-static size_t heap_index;
-#else
+#ifndef HUNT_EXCLUDE_STDLIB_MALLOC
 
 #include <stdlib.h>
 
 #endif
+#include <errno.h>
 
+/* Sits right before the memory handed out, offset bytes into the block to align it */
 typedef struct GuardBytes {
+  size_t offset;
   size_t size;
   size_t guard_space;
 } Guard;
 
 
-#define HUNT_MALLOC_ALIGNMENT (HUNT_POINTER_WIDTH / 8)
 static const char end[] = "END";
 
 
+/*-------------------------------------------------------- */
+/* Registry of the blocks the test holds and where each was allocated, a hash
+ * table keyed by pointer with linear probing. Removing a block shifts the
+ * entries after it back, so there are no tombstones and both are O(1). */
+typedef struct MallocEntryType {
+  void *mem;
+  size_t size;
+  const char *file;
+  int line;
+} MallocEntry;
+
+static MallocEntry malloc_registry_fixed[HUNT_MALLOC_REGISTRY_SIZE];
+static MallocEntry *malloc_registry = malloc_registry_fixed;
+static size_t malloc_registry_capacity = HUNT_MALLOC_REGISTRY_SIZE;
+static size_t malloc_registry_used;
+
+static size_t malloc_registry_home(const void *mem) {
+  size_t hash = (size_t) (HUNT_PTR_TO_INT) mem;
+
+  hash ^= hash >> 16;
+  hash *= 0x45d9f3bu;
+  hash ^= hash >> 16;
+  return hash & (malloc_registry_capacity - 1);
+}
+
+static void malloc_registry_clear(void) {
+  memset(malloc_registry, 0, malloc_registry_capacity * sizeof(MallocEntry));
+  malloc_registry_used = 0;
+}
+
+static void malloc_registry_insert(const MallocEntry *entry) {
+  size_t i = malloc_registry_home(entry->mem);
+
+  while (malloc_registry[i].mem != NULL) {
+    i = (i + 1) & (malloc_registry_capacity - 1);
+  }
+  malloc_registry[i] = *entry;
+  malloc_registry_used++;
+}
+
+/* Doubles the table on the heap, the internal heap is too small to spare for it */
+static int malloc_registry_grow(void) {
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+  return 0;
+#else
+  MallocEntry *old = malloc_registry;
+  size_t old_capacity = malloc_registry_capacity;
+  MallocEntry *bigger = (MallocEntry *) HUNT_FIXTURE_MALLOC(old_capacity * 2 * sizeof(MallocEntry));
+  size_t i;
+
+  if (bigger == NULL) return 0;
+  malloc_registry = bigger;
+  malloc_registry_capacity = old_capacity * 2;
+  malloc_registry_clear();
+  for (i = 0; i < old_capacity; i++) {
+    if (old[i].mem != NULL) {
+      malloc_registry_insert(&old[i]);
+    }
+  }
+  if (old != malloc_registry_fixed) {
+    HUNT_FIXTURE_FREE(old);
+  }
+  return 1;
+#endif
+}
+
+static void malloc_registry_add(void *mem, size_t size, const char *file, int line) {
+  MallocEntry entry;
+
+  if ((malloc_registry_used + 1) * 4 > malloc_registry_capacity * 3) {
+    if (!malloc_registry_grow()) return; /* left out of the report */
+  }
+  entry.mem = mem;
+  entry.size = size;
+  entry.file = file;
+  entry.line = line;
+  malloc_registry_insert(&entry);
+}
+
+static void malloc_registry_remove(const void *mem) {
+  size_t mask = malloc_registry_capacity - 1;
+  size_t i = malloc_registry_home(mem);
+  size_t j;
+  size_t home;
+
+  while (malloc_registry[i].mem != mem) {
+    if (malloc_registry[i].mem == NULL) return; /* allocated before the test, or left out */
+    i = (i + 1) & mask;
+  }
+  for (j = (i + 1) & mask; malloc_registry[j].mem != NULL; j = (j + 1) & mask) {
+    home = malloc_registry_home(malloc_registry[j].mem);
+    /* an entry may move back to the gap unless its home lies between the gap and itself */
+    if ((i <= j) ? ((home <= i) || (home > j)) : ((home <= i) && (home > j))) {
+      malloc_registry[i] = malloc_registry[j];
+      i = j;
+    }
+  }
+  malloc_registry[i].mem = NULL;
+  malloc_registry_used--;
+}
+
+
+/*-------------------------------------------------------- */
+/* The leaks are summed up for each call site, the largest first, like
+ * "This test leaks! 3 blocks, 48 bytes: 32 bytes in 2 blocks from list.c:12, ..." */
+#ifndef HUNT_MALLOC_LEAK_SITES
+#define HUNT_MALLOC_LEAK_SITES 8
+#endif
+
+#ifndef HUNT_MALLOC_LEAK_MESSAGE_LENGTH
+#define HUNT_MALLOC_LEAK_MESSAGE_LENGTH 256
+#endif
+
+typedef struct LeakSiteType {
+  const char *file;
+  int line;
+  size_t blocks;
+  size_t bytes;
+} LeakSite;
+
+static char leak_message[HUNT_MALLOC_LEAK_MESSAGE_LENGTH];
+static size_t leak_message_length;
+
+static void leak_append(const char *text) {
+  while ((*text != 0) && (leak_message_length < (HUNT_MALLOC_LEAK_MESSAGE_LENGTH - 1))) {
+    leak_message[leak_message_length++] = *text++;
+  }
+  leak_message[leak_message_length] = 0;
+}
+
+static void leak_append_number(size_t number) {
+  char digits[24];
+  int i = (int) sizeof(digits) - 1;
+
+  digits[i] = 0;
+  do {
+    digits[--i] = (char) ('0' + (number % 10));
+    number /= 10;
+  } while (number > 0);
+  leak_append(&digits[i]);
+}
+
+static void leak_append_blocks(size_t blocks) {
+  leak_append_number(blocks);
+  leak_append((blocks == 1) ? " block" : " blocks");
+}
+
+static int same_site(const LeakSite *site, const MallocEntry *entry) {
+  if (site->line != entry->line) return 0;
+  if ((site->file == NULL) || (entry->file == NULL)) return site->file == entry->file;
+  return strcmp(site->file, entry->file) == 0;
+}
+
+static const char *malloc_leak_report(void) {
+  LeakSite sites[HUNT_MALLOC_LEAK_SITES];
+  LeakSite site;
+  size_t count = 0;
+  size_t blocks = 0;
+  size_t bytes = 0;
+  size_t others = 0;
+  size_t i;
+  size_t j;
+
+  for (i = 0; i < malloc_registry_capacity; i++) {
+    if (malloc_registry[i].mem == NULL) continue;
+    blocks++;
+    bytes += malloc_registry[i].size;
+    for (j = 0; (j < count) && !same_site(&sites[j], &malloc_registry[i]); j++) {
+    }
+    if (j == count) {
+      if (count == HUNT_MALLOC_LEAK_SITES) {
+        others++;
+        continue;
+      }
+      sites[count].file = malloc_registry[i].file;
+      sites[count].line = malloc_registry[i].line;
+      sites[count].blocks = 0;
+      sites[count].bytes = 0;
+      count++;
+    }
+    sites[j].blocks++;
+    sites[j].bytes += malloc_registry[i].size;
+  }
+  for (i = 1; i < count; i++) {
+    site = sites[i];
+    for (j = i; (j > 0) && (sites[j - 1].bytes < site.bytes); j--) {
+      sites[j] = sites[j - 1];
+    }
+    sites[j] = site;
+  }
+
+  leak_message_length = 0;
+  leak_append("This test leaks!");
+  if (blocks == 0) return leak_message;
+  leak_append(" ");
+  leak_append_blocks(blocks);
+  leak_append(", ");
+  leak_append_number(bytes);
+  leak_append(" bytes:");
+  for (i = 0; i < count; i++) {
+    leak_append((i == 0) ? " " : ", ");
+    leak_append_number(sites[i].bytes);
+    leak_append(" bytes in ");
+    leak_append_blocks(sites[i].blocks);
+    if (sites[i].file != NULL) {
+      leak_append(" from ");
+      leak_append(sites[i].file);
+      leak_append(":");
+      leak_append_number((size_t) sites[i].line);
+    }
+  }
+  if (others > 0) {
+    leak_append(", ");
+    leak_append_blocks(others);
+    leak_append(" from other sites");
+  }
+  if ((malloc_count > 0) && ((size_t) malloc_count > blocks)) {
+    leak_append(", ");
+    leak_append_blocks((size_t) malloc_count - blocks);
+    leak_append(" not registered");
+  }
+  return leak_message;
+}
+
+
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+/*-------------------------------------------------------- */
+/* The internal heap. Each block starts with a tag of its size, a multiple of
+ * the grain, whose low bits flag a block in use and a free block before it.
+ * A free block also keeps its size in its last word, for the block after it
+ * to find its start, and in between its links in the free list of its size
+ * class. Freeing coalesces with the free neighbours, so nothing is stranded,
+ * and takes a bounded number of steps. Malloc only walks the list of the class
+ * of the size asked for, which holds smaller blocks as well, before it takes a
+ * block of any class above, which is big enough. */
+#ifndef HUNT_POOL_CLASSES
+#define HUNT_POOL_CLASSES 16
+#endif
+
+#define POOL_USED      ((size_t) 1)
+#define POOL_PREV_FREE ((size_t) 2)
+#define POOL_FLAGS     (POOL_USED | POOL_PREV_FREE)
+#define POOL_GRAIN     ((sizeof(size_t) < 4) ? 4 : sizeof(size_t))
+#define POOL_MIN       (2 * sizeof(size_t) + 2 * sizeof(void *))
+#define POOL_SIZE      ((sizeof(hunt_heap) / POOL_GRAIN) * POOL_GRAIN)
+
+typedef struct PoolBlockType {
+  size_t tag;
+  struct PoolBlockType *next; /* the links are only there while free */
+  struct PoolBlockType *prev;
+} PoolBlock;
+
+static size_t hunt_heap[(HUNT_INTERNAL_HEAP_SIZE_BYTES + sizeof(size_t) - 1) / sizeof(size_t)];
+static PoolBlock *pool_lists[HUNT_POOL_CLASSES];
+static unsigned int pool_nonempty; /* a bit for each class with free blocks */
+static int pool_ready;
+static size_t pool_in_use;
+static size_t pool_high_water;
+
+static size_t pool_size(const PoolBlock *block) {
+  return block->tag & ~POOL_FLAGS;
+}
+
+static unsigned int pool_class(size_t size) {
+  unsigned int size_class = 0;
+
+  size /= POOL_MIN;
+  while (((size >>= 1) != 0) && (size_class < (HUNT_POOL_CLASSES - 1))) {
+    size_class++;
+  }
+  return size_class;
+}
+
+static PoolBlock *pool_next(PoolBlock *block) {
+  unsigned char *next = (unsigned char *) block + pool_size(block);
+
+  if (next >= (unsigned char *) hunt_heap + POOL_SIZE) return NULL;
+  return (PoolBlock *) (void *) next;
+}
+
+static void pool_link(PoolBlock *block) {
+  unsigned int size_class = pool_class(pool_size(block));
+
+  block->prev = NULL;
+  block->next = pool_lists[size_class];
+  if (block->next != NULL) block->next->prev = block;
+  pool_lists[size_class] = block;
+  pool_nonempty |= 1u << size_class;
+}
+
+static void pool_unlink(PoolBlock *block) {
+  unsigned int size_class = pool_class(pool_size(block));
+
+  if (block->prev != NULL) {
+    block->prev->next = block->next;
+  } else {
+    pool_lists[size_class] = block->next;
+  }
+  if (block->next != NULL) block->next->prev = block->prev;
+  if (pool_lists[size_class] == NULL) pool_nonempty &= ~(1u << size_class);
+}
+
+/* Makes size bytes at block a free block, the block before it is in use */
+static void pool_release(PoolBlock *block, size_t size) {
+  PoolBlock *next;
+
+  block->tag = size;
+  ((size_t *) (void *) ((unsigned char *) block + size))[-1] = size;
+  pool_link(block);
+  next = pool_next(block);
+  if (next != NULL) next->tag |= POOL_PREV_FREE;
+}
+
+/* Keeps size bytes of a block in use and frees the rest, if a block fits */
+static void pool_trim(PoolBlock *block, size_t size) {
+  size_t whole = pool_size(block);
+  PoolBlock *next;
+
+  if (whole - size >= POOL_MIN) {
+    block->tag = size | (block->tag & POOL_FLAGS);
+    pool_release((PoolBlock *) (void *) ((unsigned char *) block + size), whole - size);
+  } else {
+    next = pool_next(block);
+    if (next != NULL) next->tag &= ~POOL_PREV_FREE;
+  }
+}
+
+static size_t pool_block_size(size_t bytes) {
+  size_t size = ((sizeof(size_t) + bytes + POOL_GRAIN - 1) / POOL_GRAIN) * POOL_GRAIN;
+
+  return (size < POOL_MIN) ? POOL_MIN : size;
+}
+
+static void pool_grew(size_t bytes) {
+  pool_in_use += bytes;
+  if (pool_in_use > pool_high_water) pool_high_water = pool_in_use;
+}
+
+static void *pool_alloc(size_t bytes) {
+  size_t size = pool_block_size(bytes);
+  unsigned int size_class = pool_class(size);
+  unsigned int larger;
+  PoolBlock *block;
+
+  if (!pool_ready) {
+    pool_release((PoolBlock *) (void *) hunt_heap, POOL_SIZE);
+    pool_ready = 1;
+  }
+  block = pool_lists[size_class];
+  while ((block != NULL) && (pool_size(block) < size)) {
+    block = block->next;
+  }
+  if (block == NULL) {
+    larger = pool_nonempty & ~((2u << size_class) - 1u);
+    if (larger == 0) return NULL;
+    while ((larger & (1u << size_class)) == 0) {
+      size_class++;
+    }
+    block = pool_lists[size_class];
+  }
+  pool_unlink(block);
+  block->tag |= POOL_USED;
+  pool_trim(block, size);
+  pool_grew(pool_size(block));
+  return &block->next;
+}
+
+/* Grows a block in use into the free block after it, when that is enough */
+static int pool_expand(void *mem, size_t bytes) {
+  PoolBlock *block = (PoolBlock *) (void *) ((unsigned char *) mem - sizeof(size_t));
+  size_t size = pool_block_size(bytes);
+  size_t old_size = pool_size(block);
+  PoolBlock *next = pool_next(block);
+
+  if (old_size >= size) return 1;
+  if ((next == NULL) || ((next->tag & POOL_USED) != 0) || (old_size + pool_size(next) < size)) return 0;
+  pool_unlink(next);
+  block->tag += pool_size(next);
+  pool_trim(block, size);
+  pool_grew(pool_size(block) - old_size);
+  return 1;
+}
+
+static void pool_free(void *mem) {
+  PoolBlock *block = (PoolBlock *) (void *) ((unsigned char *) mem - sizeof(size_t));
+  size_t size = pool_size(block);
+  PoolBlock *next = pool_next(block);
+  size_t prev_size;
+
+  pool_in_use -= size;
+  if ((next != NULL) && ((next->tag & POOL_USED) == 0)) {
+    pool_unlink(next);
+    size += pool_size(next);
+  }
+  if ((block->tag & POOL_PREV_FREE) != 0) {
+    prev_size = ((size_t *) (void *) block)[-1];
+    block = (PoolBlock *) (void *) ((unsigned char *) block - prev_size);
+    pool_unlink(block);
+    size += prev_size;
+  }
+  pool_release(block, size);
+}
+
+static void pool_start_test(void) {
+  pool_high_water = pool_in_use;
+}
+
+/* Walks the heap, only when asked for the stats */
+static void pool_heap_stats(HuntMallocStats *stats) {
+  PoolBlock *block = (PoolBlock *) (void *) hunt_heap;
+
+  stats->HeapHighWater = pool_high_water;
+  stats->HeapFreeBytes = POOL_SIZE;
+  stats->HeapLargestFree = POOL_SIZE;
+  if (!pool_ready) return;
+  stats->HeapFreeBytes = 0;
+  stats->HeapLargestFree = 0;
+  for (; block != NULL; block = pool_next(block)) {
+    if ((block->tag & POOL_USED) != 0) continue;
+    stats->HeapFreeBytes += pool_size(block);
+    if (pool_size(block) > stats->HeapLargestFree) {
+      stats->HeapLargestFree = pool_size(block);
+    }
+  }
+}
+#endif
+
+
 static size_t hunt_size_round_up(size_t size) {
   size_t rounded_size;
 
@@ -182,42 +672,62 @@ static size_t hunt_size_round_up(size_t size) {
 }
 
 void *hunt_malloc(size_t size) {
-  char *mem;
-  Guard *guard;
-  size_t total_size;
-
-  total_size = sizeof(Guard) + hunt_size_round_up(size + sizeof(end));
+  return hunt_malloc_at(size, NULL, 0);
+}
 
+static int malloc_should_fail(void) {
   if (malloc_fail_countdown != MALLOC_DONT_FAIL) {
     if (malloc_fail_countdown == 0)
-      return NULL;
+      return 1;
     malloc_fail_countdown--;
   }
+  return 0;
+}
+
+static void *guard_memory(Guard *guard, size_t size, const char *file, int line) {
+  char *mem;
 
-  if (size == 0) return NULL;
-#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
-  if (heap_index + total_size > HUNT_INTERNAL_HEAP_SIZE_BYTES)
-  {
-      guard = NULL;
-  }
-  else
-  {
-      guard = (Guard*)&hunt_heap[heap_index];
-      heap_index += total_size;
-  }
-#else
-  guard = (Guard *) HUNT_FIXTURE_MALLOC(total_size);
-#endif
-  if (guard == NULL) return NULL;
   malloc_count++;
   guard->size = size;
   guard->guard_space = 0;
   mem = (char *) &(guard[1]);
   memcpy(&mem[size], end, sizeof(end));
+  malloc_registry_add(mem, size, file, line);
+  malloc_stats_allocated(size);
 
   return (void *) mem;
 }
 
+/* The heap underneath hands out blocks aligned to a word at least, any more
+ * alignment is made up for by room to move the guard up */
+static void *allocate_memory(size_t size, size_t alignment, const char *file, int line) {
+  char *block;
+  Guard *guard;
+  size_t total_size;
+  size_t offset;
+
+  if (alignment < HUNT_MALLOC_ALIGNMENT) alignment = HUNT_MALLOC_ALIGNMENT;
+  total_size = sizeof(Guard) + hunt_size_round_up(size + sizeof(end));
+  if (alignment > sizeof(size_t)) total_size += alignment - sizeof(size_t);
+
+  if (size == 0) return NULL;
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+  block = (char *) pool_alloc(total_size);
+#else
+  block = (char *) HUNT_FIXTURE_MALLOC(total_size);
+#endif
+  if (block == NULL) return NULL;
+  offset = (alignment - ((size_t) (HUNT_PTR_TO_INT) (block + sizeof(Guard)) & (alignment - 1))) & (alignment - 1);
+  guard = (Guard *) (void *) (block + offset);
+  guard->offset = offset;
+  return guard_memory(guard, size, file, line);
+}
+
+void *hunt_malloc_at(size_t size, const char *file, int line) {
+  if (malloc_should_fail()) return NULL;
+  return allocate_memory(size, HUNT_MALLOC_ALIGNMENT, file, line);
+}
+
 static int isOverrun(void *mem) {
   Guard *guard = (Guard *) mem;
   char *memAsChar = (char *) mem;
@@ -226,24 +736,24 @@ static int isOverrun(void *mem) {
   return guard->guard_space != 0 || strcmp(&memAsChar[guard->size], end) != 0;
 }
 
-static void release_memory(void *mem) {
+static void forget_memory(void *mem) {
   Guard *guard = (Guard *) mem;
   guard--;
 
   malloc_count--;
-#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
-  {
-      size_t block_size;
+  malloc_registry_remove(mem);
+  malloc_stats_freed(guard->size);
+}
 
-      block_size = hunt_size_round_up(guard->size + sizeof(end));
+static void release_memory(void *mem) {
+  Guard *guard = (Guard *) mem;
+  guard--;
 
-      if (mem == hunt_heap + heap_index - block_size)
-      {
-          heap_index -= (sizeof(Guard) + block_size);
-      }
-  }
+  forget_memory(mem);
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+  pool_free((char *) guard - guard->offset);
 #else
-  HUNT_FIXTURE_FREE(guard);
+  HUNT_FIXTURE_FREE((char *) guard - guard->offset);
 #endif
 }
 
@@ -262,17 +772,25 @@ void hunt_free(void *mem) {
 }
 
 void *hunt_calloc(size_t num, size_t size) {
-  void *mem = hunt_malloc(num * size);
+  return hunt_calloc_at(num, size, NULL, 0);
+}
+
+void *hunt_calloc_at(size_t num, size_t size, const char *file, int line) {
+  void *mem = hunt_malloc_at(num * size, file, line);
   if (mem == NULL) return NULL;
   memset(mem, 0, num * size);
   return mem;
 }
 
 void *hunt_realloc(void *oldMem, size_t size) {
+  return hunt_realloc_at(oldMem, size, NULL, 0);
+}
+
+void *hunt_realloc_at(void *oldMem, size_t size, const char *file, int line) {
   Guard *guard = (Guard *) oldMem;
   void *newMem;
 
-  if (oldMem == NULL) return hunt_malloc(size);
+  if (oldMem == NULL) return hunt_malloc_at(size, file, line);
 
   guard--;
   if (isOverrun(oldMem)) {
@@ -287,25 +805,59 @@ void *hunt_realloc(void *oldMem, size_t size) {
 
   if (guard->size >= size) return oldMem;
 
+  if (malloc_should_fail()) return NULL; /* Do not release old memory */
 #ifdef HUNT_EXCLUDE_STDLIB_MALLOC /* Optimization if memory is expandable */
+  if (pool_expand((char *) guard - guard->offset,
+                  guard->offset + sizeof(Guard) + hunt_size_round_up(size + sizeof(end))))
   {
-      size_t old_total_size = hunt_size_round_up(guard->size + sizeof(end));
-
-      if ((oldMem == hunt_heap + heap_index - old_total_size) &&
-          ((heap_index - old_total_size + hunt_size_round_up(size + sizeof(end))) <= HUNT_INTERNAL_HEAP_SIZE_BYTES))
-      {
-          release_memory(oldMem);    /* Not thread-safe, like hunt_heap generally */
-          return hunt_malloc(size); /* No memcpy since data is in place */
-      }
+      forget_memory(oldMem);    /* Not thread-safe, like hunt_heap generally */
+      return guard_memory(guard, size, file, line); /* No memcpy since data is in place */
   }
 #endif
-  newMem = hunt_malloc(size);
+  newMem = allocate_memory(size, HUNT_MALLOC_ALIGNMENT, file, line);
   if (newMem == NULL) return NULL; /* Do not release old memory */
   memcpy(newMem, oldMem, guard->size);
+  malloc_stats.ReallocCopyBytes += guard->size;
   release_memory(oldMem);
   return newMem;
 }
 
+static int is_power_of_two(size_t number) {
+  return (number != 0) && ((number & (number - 1)) == 0);
+}
+
+void *hunt_aligned_alloc(size_t alignment, size_t size) {
+  return hunt_aligned_alloc_at(alignment, size, NULL, 0);
+}
+
+void *hunt_aligned_alloc_at(size_t alignment, size_t size, const char *file, int line) {
+  if (!is_power_of_two(alignment)) return NULL;
+  if (malloc_should_fail()) return NULL;
+  return allocate_memory(size, alignment, file, line);
+}
+
+void *hunt_memalign(size_t alignment, size_t size) {
+  return hunt_aligned_alloc_at(alignment, size, NULL, 0);
+}
+
+void *hunt_memalign_at(size_t alignment, size_t size, const char *file, int line) {
+  return hunt_aligned_alloc_at(alignment, size, file, line);
+}
+
+int hunt_posix_memalign(void **memptr, size_t alignment, size_t size) {
+  return hunt_posix_memalign_at(memptr, alignment, size, NULL, 0);
+}
+
+int hunt_posix_memalign_at(void **memptr, size_t alignment, size_t size, const char *file, int line) {
+  void *mem;
+
+  if (!is_power_of_two(alignment) || ((alignment % sizeof(void *)) != 0)) return EINVAL;
+  mem = hunt_aligned_alloc_at(alignment, size, file, line);
+  if ((mem == NULL) && (size != 0)) return ENOMEM;
+  *memptr = mem;
+  return 0;
+}
+
 
 /*-------------------------------------------------------- */
 /*Automatic pointer restoration functions */
@@ -384,6 +936,33 @@ int HuntGetCommandLineOptions(int argc, const char *argv[]) {
           i++;
         }
       }
+    } else if (strcmp(argv[i], "-t") == 0) {
+      i++;
+      if (i >= argc)
+        return 1;
+#ifdef HUNT_USE_TIME_BUDGETS
+      {
+        unsigned int digit = 0;
+        HuntTimeBudgetScale = 0;
+        while (argv[i][digit] >= '0' && argv[i][digit] <= '9') {
+          HuntTimeBudgetScale *= 10;
+          HuntTimeBudgetScale += (HUNT_UINT) argv[i][digit++] - '0';
+        }
+      }
+#endif
+      i++;
+    } else if (strncmp(argv[i], "--trace=", 8) == 0) {
+#ifdef HUNT_USE_TRACE
+      if (HuntTraceOpen(&argv[i][8]) != 0)
+        return 1;
+#endif
+      i++;
+    } else if (strncmp(argv[i], "--profile=", 10) == 0) {
+#ifdef HUNT_USE_PROFILER
+      if (HuntProfileOpen(&argv[i][10]) != 0)
+        return 1;
+#endif
+      i++;
     } else {
       /* ignore unknown parameter */
       i++;
@@ -393,6 +972,18 @@ int HuntGetCommandLineOptions(int argc, const char *argv[]) {
 }
 
 void HuntConcludeFixtureTest(void) {
+#ifdef HUNT_USE_TIME_BUDGETS
+  HuntCheckTimeBudget();
+#endif
+#ifdef HUNT_USE_SLOWEST_TESTS
+  HuntRecordTestTime();
+#endif
+#ifdef HUNT_USE_TRACE
+  HuntTraceTestStop();
+#endif
+#ifdef HUNT_USE_PROFILER
+  HuntProfileWrite();
+#endif
   if (Hunt.CurrentTestIgnored) {
     Hunt.TestIgnores++;
     HUNT_PRINT_EOL();
@@ -400,8 +991,10 @@ void HuntConcludeFixtureTest(void) {
     if (HuntFixture.Verbose) {
       HuntPrint(" ");
       HuntPrint(HuntStrPass);
-      HUNT_EXEC_TIME_STOP();
       HUNT_PRINT_EXEC_TIME();
+      HUNT_PRINT_PERF_COUNTERS();
+      HUNT_PRINT_RUSAGE();
+      HUNT_PRINT_PHASE_TIMES();
       HUNT_PRINT_EOL();
     }
   } else /* Hunt.CurrentTestFailed */
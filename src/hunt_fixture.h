@@ -40,6 +40,22 @@ int HuntMain(int argc, const char *argv[], void (*runAllTests)(void));
     }\
     void  TEST_##group##_##name##_(void)
 
+/* A TEST that fails when it takes longer than budget, in the units of the exec time (see TEST_TIME_BUDGET) */
+#define TEST_WITH_TIME_BUDGET(group, name, budget) \
+    void TEST_##group##_##name##_(void);\
+    void TEST_##group##_##name##_run(void);\
+    void TEST_##group##_##name##_run(void)\
+    {\
+        HUNT_SET_TIME_BUDGET(budget);\
+        HuntTestRunner(TEST_##group##_SETUP,\
+            TEST_##group##_##name##_,\
+            TEST_##group##_TEAR_DOWN,\
+            "TEST(" #group ", " #name ")",\
+            TEST_GROUP_##group, #name,\
+            __FILE__, __LINE__);\
+    }\
+    void  TEST_##group##_##name##_(void)
+
 #define IGNORE_TEST(group, name) \
     void TEST_##group##_##name##_(void);\
     void TEST_##group##_##name##_run(void);\
@@ -80,4 +96,50 @@ int HuntMain(int argc, const char *argv[], void (*runAllTests)(void));
 /* You must compile with malloc replacement, as defined in hunt_fixture_malloc_overrides.h */
 void HuntMalloc_MakeMallocFailAfterCount(int countdown);
 
+/* What the current test allocated so far. Size class i of the histogram counts
+ * the blocks of 2^i up to 2^(i+1)-1 bytes, and the last one all larger blocks. */
+#ifndef HUNT_MALLOC_SIZE_CLASSES
+#define HUNT_MALLOC_SIZE_CLASSES 16
+#endif
+
+typedef struct HuntMallocStatsType {
+  size_t Allocations;
+  size_t Frees;
+  size_t BytesAllocated;
+  size_t LiveBytes;
+  size_t PeakLiveBytes;
+  size_t ReallocCopyBytes;
+  size_t SizeClasses[HUNT_MALLOC_SIZE_CLASSES];
+  /* The internal heap of HUNT_EXCLUDE_STDLIB_MALLOC, with its block overhead,
+   * or zero without it. It is fragmented when the largest free block is much
+   * smaller than all free bytes. */
+  size_t HeapHighWater;
+  size_t HeapFreeBytes;
+  size_t HeapLargestFree;
+} HuntMallocStats;
+
+void HuntMalloc_GetStats(HuntMallocStats *stats);
+size_t HuntMalloc_Allocations(void);
+
+/* Fails when the test allocated more than n blocks so far */
+#define TEST_ASSERT_MAX_ALLOCATIONS(n) \
+    HUNT_TEST_ASSERT_SMALLER_OR_EQUAL_UINT((n), HuntMalloc_Allocations(), __LINE__, " Too many allocations")
+
+/* Fails when the code between them allocated anything. The code may hold commas
+ * outside of parentheses, which the block of TEST_ASSERT_NO_ALLOCATIONS_IN()
+ * may not, and is a block of its own. */
+#define TEST_ASSERT_NO_ALLOCATIONS_BEGIN \
+    { \
+      size_t hunt_allocations_before_ = HuntMalloc_Allocations(); \
+      {
+
+#define TEST_ASSERT_NO_ALLOCATIONS_END \
+      } \
+      HUNT_TEST_ASSERT_EQUAL_UINT(0, HuntMalloc_Allocations() - hunt_allocations_before_, __LINE__, " Allocated where no allocation was expected"); \
+    }
+
+/* Runs the statement or block and fails when it allocated anything */
+#define TEST_ASSERT_NO_ALLOCATIONS_IN(block) \
+    do TEST_ASSERT_NO_ALLOCATIONS_BEGIN block; TEST_ASSERT_NO_ALLOCATIONS_END while (0)
+
 #endif /* HUNT_FIXTURE_H_ */
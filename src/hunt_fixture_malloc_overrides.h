@@ -14,13 +14,34 @@
 /* Define this macro to remove the use of stdlib.h, malloc, and free.
  * Many embedded systems do not have a heap or malloc/free by default.
  * This internal hunt_malloc() provides allocated memory deterministically from
- * the end of an array only, hunt_free() only releases from end-of-array,
- * blocks are not coalesced, and memory not freed in LIFO order is stranded. */
+ * an array, keeping free blocks in lists by power-of-two size class. Blocks
+ * are freed in any order and coalesced with their free neighbours, at a cost
+ * of a word for each block. */
 #ifndef HUNT_INTERNAL_HEAP_SIZE_BYTES
 #define HUNT_INTERNAL_HEAP_SIZE_BYTES 256
 #endif
 #endif
 
+/* Each block is aligned to this many bytes, a power of two, and so are those of
+ * aligned_alloc() and the like to at least as many. Raise it up to the cache
+ * line size when the code under test counts on its buffers being aligned like
+ * they are in production. */
+#ifndef HUNT_MALLOC_ALIGNMENT
+#define HUNT_MALLOC_ALIGNMENT (HUNT_POINTER_WIDTH / 8)
+#endif
+
+/* Each block a test holds is registered with where it was allocated, in a hash
+ * table of this many entries, a power of two. The table grows on the heap as
+ * needed, but stays this size with HUNT_EXCLUDE_STDLIB_MALLOC, and blocks past
+ * three quarters of it are left out of the leak report. */
+#ifndef HUNT_MALLOC_REGISTRY_SIZE
+#ifdef HUNT_EXCLUDE_STDLIB_MALLOC
+#define HUNT_MALLOC_REGISTRY_SIZE 16
+#else
+#define HUNT_MALLOC_REGISTRY_SIZE 64
+#endif
+#endif
+
 /* These functions are used by the Hunt Fixture to allocate and release memory
  * on the heap and can be overridden with platform-specific implementations.
  * For example, when using FreeRTOS HUNT_FIXTURE_MALLOC becomes pvPortMalloc()
@@ -36,9 +57,27 @@ extern void* HUNT_FIXTURE_MALLOC(size_t size);
 extern void HUNT_FIXTURE_FREE(void* ptr);
 #endif
 
-#define malloc  hunt_malloc
-#define calloc  hunt_calloc
-#define realloc hunt_realloc
+/* The overrides replace the names alone, so that the code under test may still
+ * take their address or have members named after them. Define
+ * HUNT_MALLOC_CALL_SITES to pass the file and line of each call instead, which
+ * leaks are then reported with. Since those take arguments, <stdlib.h> must be
+ * included before them, as it is here unless HUNT_FIXTURE_MALLOC is defined,
+ * and so must <malloc.h> where the code under test uses memalign(). */
+#ifdef HUNT_MALLOC_CALL_SITES
+#define malloc(size)        hunt_malloc_at((size), __FILE__, __LINE__)
+#define calloc(num, size)   hunt_calloc_at((num), (size), __FILE__, __LINE__)
+#define realloc(mem, size)  hunt_realloc_at((mem), (size), __FILE__, __LINE__)
+#define aligned_alloc(alignment, size)          hunt_aligned_alloc_at((alignment), (size), __FILE__, __LINE__)
+#define posix_memalign(memptr, alignment, size) hunt_posix_memalign_at((memptr), (alignment), (size), __FILE__, __LINE__)
+#define memalign(alignment, size)               hunt_memalign_at((alignment), (size), __FILE__, __LINE__)
+#else
+#define malloc          hunt_malloc
+#define calloc          hunt_calloc
+#define realloc         hunt_realloc
+#define aligned_alloc   hunt_aligned_alloc
+#define posix_memalign  hunt_posix_memalign
+#define memalign        hunt_memalign
+#endif
 #define free    hunt_free
 
 void *hunt_malloc(size_t size);
@@ -49,4 +88,22 @@ void *hunt_realloc(void *oldMem, size_t size);
 
 void hunt_free(void *mem);
 
+void *hunt_aligned_alloc(size_t alignment, size_t size);
+
+int hunt_posix_memalign(void **memptr, size_t alignment, size_t size);
+
+void *hunt_memalign(size_t alignment, size_t size);
+
+void *hunt_malloc_at(size_t size, const char *file, int line);
+
+void *hunt_calloc_at(size_t num, size_t size, const char *file, int line);
+
+void *hunt_realloc_at(void *oldMem, size_t size, const char *file, int line);
+
+void *hunt_aligned_alloc_at(size_t alignment, size_t size, const char *file, int line);
+
+int hunt_posix_memalign_at(void **memptr, size_t alignment, size_t size, const char *file, int line);
+
+void *hunt_memalign_at(size_t alignment, size_t size, const char *file, int line);
+
 #endif /* HUNT_FIXTURE_MALLOC_OVERRIDES_H_ */
@@ -316,44 +316,56 @@ extern void HUNT_OUTPUT_FLUSH_HEADER_DECLARATION;
       !defined(HUNT_TIME_TYPE)
 /* If none any of these macros are defined then try to provide a default implementation */
 
+/* Nanoseconds in 32 bits wrap around after 4.29 s, so hosts without 64-bit
+ * integers keep exec times in milliseconds of their clock instead */
+#if !defined(HUNT_CLOCK_MS) && !defined(HUNT_CLOCK_NS) && !defined(HUNT_SUPPORT_64) && \
+    (defined(__unix__) || defined(__APPLE__) || defined(_WIN32))
+#define HUNT_CLOCK_MS() HuntClockMs()
+#define HUNT_USE_HOST_CLOCK_MS
+#endif
+
 #if defined(HUNT_CLOCK_MS)
 /* This is a simple way to get a default implementation on platforms that support getting a millisecond counter */
 #define HUNT_TIME_TYPE HUNT_UINT
 #define HUNT_EXEC_TIME_START() Hunt.CurrentTestStartTime = HUNT_CLOCK_MS()
 #define HUNT_EXEC_TIME_STOP() Hunt.CurrentTestStopTime = HUNT_CLOCK_MS()
+#define HUNT_EXEC_TIME_NOW() HUNT_CLOCK_MS()
 #define HUNT_PRINT_EXEC_TIME() { \
         HUNT_UINT execTimeMs = (Hunt.CurrentTestStopTime - Hunt.CurrentTestStartTime); \
         HuntPrint(" ("); \
         HuntPrintNumberUnsigned(execTimeMs); \
         HuntPrint(" ms)"); \
         }
-#elif defined(_WIN32)
-#include <time.h>
-#define HUNT_TIME_TYPE clock_t
-#define HUNT_GET_TIME(t) t = (clock_t)((clock() * 1000) / CLOCKS_PER_SEC)
-#define HUNT_EXEC_TIME_START() HUNT_GET_TIME(Hunt.CurrentTestStartTime)
-#define HUNT_EXEC_TIME_STOP() HUNT_GET_TIME(Hunt.CurrentTestStopTime)
-#define HUNT_PRINT_EXEC_TIME() { \
-        HUNT_UINT execTimeMs = (Hunt.CurrentTestStopTime - Hunt.CurrentTestStartTime); \
-        HuntPrint(" ("); \
-        HuntPrintNumberUnsigned(execTimeMs); \
-        HuntPrint(" ms)"); \
-        }
-#elif defined(__unix__)
-#include <time.h>
-#define HUNT_TIME_TYPE struct timespec
-#define HUNT_GET_TIME(t) clock_gettime(CLOCK_MONOTONIC, &t)
-#define HUNT_EXEC_TIME_START() HUNT_GET_TIME(Hunt.CurrentTestStartTime)
-#define HUNT_EXEC_TIME_STOP() HUNT_GET_TIME(Hunt.CurrentTestStopTime)
-#define HUNT_PRINT_EXEC_TIME() { \
-        HUNT_UINT execTimeMs = ((Hunt.CurrentTestStopTime.tv_sec - Hunt.CurrentTestStartTime.tv_sec) * 1000L); \
-        execTimeMs += ((Hunt.CurrentTestStopTime.tv_nsec - Hunt.CurrentTestStartTime.tv_nsec) / 1000000L); \
-        HuntPrint(" ("); \
-        HuntPrintNumberUnsigned(execTimeMs); \
-        HuntPrint(" ms)"); \
-        }
+#elif defined(HUNT_CLOCK_NS) || defined(__unix__) || defined(__APPLE__) || defined(_WIN32)
+/* Otherwise times are kept in nanoseconds of HUNT_CLOCK_NS(), see the Clock below */
+#define HUNT_TIME_TYPE HUNT_UINT
+#define HUNT_EXEC_TIME_START() Hunt.CurrentTestStartTime = (HUNT_UINT) HUNT_CLOCK_NS()
+#define HUNT_EXEC_TIME_STOP() Hunt.CurrentTestStopTime = (HUNT_UINT) HUNT_CLOCK_NS()
+#define HUNT_EXEC_TIME_NOW() ((HUNT_UINT) HUNT_CLOCK_NS())
+#define HUNT_PRINT_EXEC_TIME() HuntPrintExecTime(Hunt.CurrentTestStopTime - Hunt.CurrentTestStartTime)
+#define HUNT_USE_EXEC_TIME_NS
+#endif
 #endif
 #endif
+
+/* Tests can be given a time budget when the default exec times are kept, in
+ * nanoseconds (milliseconds with HUNT_CLOCK_MS). Every budget is scaled by
+ * HUNT_TIME_BUDGET_SCALE percent, to make room for slower machines */
+#ifdef HUNT_EXEC_TIME_NOW
+#define HUNT_USE_TIME_BUDGETS
+#define HUNT_SET_TIME_BUDGET(budget) Hunt.CurrentTestBudget = (HUNT_UINT) (budget)
+#else
+#define HUNT_SET_TIME_BUDGET(budget) do{}while(0)
+#endif
+
+#ifndef HUNT_TIME_BUDGET_SCALE
+#define HUNT_TIME_BUDGET_SCALE 100
+#endif
+
+/* Define HUNT_SLOWEST_TESTS to a count of tests to list as the slowest, along
+ * with the durations of all tests, when the tests end */
+#if defined(HUNT_SLOWEST_TESTS) && defined(HUNT_EXEC_TIME_NOW)
+#define HUNT_USE_SLOWEST_TESTS
 #endif
 
 #ifndef HUNT_EXEC_TIME_START
@@ -372,6 +384,283 @@ extern void HUNT_OUTPUT_FLUSH_HEADER_DECLARATION;
 #define HUNT_PRINT_EXEC_TIME() do{}while(0)
 #endif
 
+/*-------------------------------------------------------
+ * Performance Counters
+ *-------------------------------------------------------*/
+
+#ifdef HUNT_INCLUDE_PERF_COUNTERS
+#if !defined(HUNT_PERF_COUNTERS_START) && \
+      !defined(HUNT_PERF_COUNTERS_STOP) && \
+      !defined(HUNT_PRINT_PERF_COUNTERS)
+#ifdef __linux__
+/* Linux counts the events of each test with perf_event_open(), see hunt.c */
+#define HUNT_PERF_COUNTERS_START() HuntPerfStart()
+#define HUNT_PERF_COUNTERS_STOP() HuntPerfStop()
+#define HUNT_PRINT_PERF_COUNTERS() HuntPerfPrint()
+#define HUNT_USE_PERF_EVENTS
+#else
+#error "Performance counters need Linux, or define HUNT_PERF_COUNTERS_START(), HUNT_PERF_COUNTERS_STOP() and HUNT_PRINT_PERF_COUNTERS()"
+#endif
+#endif
+#endif
+
+#ifndef HUNT_PERF_COUNTERS_START
+#define HUNT_PERF_COUNTERS_START() do{}while(0)
+#endif
+
+#ifndef HUNT_PERF_COUNTERS_STOP
+#define HUNT_PERF_COUNTERS_STOP() do{}while(0)
+#endif
+
+#ifndef HUNT_PRINT_PERF_COUNTERS
+#define HUNT_PRINT_PERF_COUNTERS() do{}while(0)
+#endif
+
+/*-------------------------------------------------------
+ * Resource Usage
+ *-------------------------------------------------------*/
+
+#ifdef HUNT_INCLUDE_RUSAGE
+#if !defined(HUNT_RUSAGE_START) && \
+      !defined(HUNT_RUSAGE_STOP) && \
+      !defined(HUNT_PRINT_RUSAGE)
+#if defined(__unix__) || defined(__APPLE__)
+/* Unix-like hosts compare getrusage() before and after each test, and Linux its
+ * resident set in /proc/self/statm, see hunt.c */
+#define HUNT_RUSAGE_START() HuntRusageStart()
+#define HUNT_RUSAGE_STOP() HuntRusageStop()
+#define HUNT_PRINT_RUSAGE() HuntRusagePrint()
+#define HUNT_USE_RUSAGE
+#ifdef __linux__
+#define HUNT_USE_STATM
+#endif
+#else
+#error "Resource usage needs getrusage(), or define HUNT_RUSAGE_START(), HUNT_RUSAGE_STOP() and HUNT_PRINT_RUSAGE()"
+#endif
+#endif
+#endif
+
+/* Whose resources getrusage() reports, RUSAGE_THREAD on Linux leaves out other threads */
+#ifndef HUNT_RUSAGE_WHO
+#define HUNT_RUSAGE_WHO RUSAGE_SELF
+#endif
+
+#ifndef HUNT_RUSAGE_START
+#define HUNT_RUSAGE_START() do{}while(0)
+#endif
+
+#ifndef HUNT_RUSAGE_STOP
+#define HUNT_RUSAGE_STOP() do{}while(0)
+#endif
+
+#ifndef HUNT_PRINT_RUSAGE
+#define HUNT_PRINT_RUSAGE() do{}while(0)
+#endif
+
+/*-------------------------------------------------------
+ * Trace
+ *-------------------------------------------------------*/
+
+/* With HUNT_INCLUDE_TRACE, the runner option --trace=file.json appends the
+ * suite setup, each test and its phases to the file as Chrome Trace Event
+ * JSON, for chrome://tracing or Perfetto, see hunt.c */
+#ifdef HUNT_INCLUDE_TRACE
+#if defined(__unix__) || defined(__APPLE__)
+#define HUNT_TRACE_BEGIN(name, category) HuntTraceBegin(name, category)
+#define HUNT_TRACE_END() HuntTraceEnd()
+#define HUNT_TRACE_TEST_START() HuntTraceTestStart()
+#define HUNT_USE_TRACE
+#else
+#error "Traces need a unix-like host"
+#endif
+#else
+#define HUNT_TRACE_BEGIN(name, category) do{}while(0)
+#define HUNT_TRACE_END() do{}while(0)
+#define HUNT_TRACE_TEST_START() do{}while(0)
+#endif
+
+/* Events are kept in a buffer of this many bytes, and written in one go once it fills up */
+#ifndef HUNT_TRACE_BUFFER_SIZE
+#define HUNT_TRACE_BUFFER_SIZE 65536
+#endif
+
+/*-------------------------------------------------------
+ * Profiler
+ *-------------------------------------------------------*/
+
+/* With HUNT_INCLUDE_PROFILER, the runner option --profile=file.folded samples
+ * the stack of each test body with SIGPROF, and writes the samples as folded
+ * stacks for flamegraph.pl, see hunt.c */
+#ifdef HUNT_INCLUDE_PROFILER
+#if defined(__linux__) || defined(__APPLE__)
+#define HUNT_USE_PROFILER
+#else
+#error "The profiler needs setitimer(), backtrace() and dladdr() of Linux or macOS"
+#endif
+#endif
+
+/* At most this many samples of this many frames are kept for a test, and the samples
+ * past them are counted as dropped. A sample is taken every this many microseconds
+ * of cpu time */
+#ifndef HUNT_PROFILER_SAMPLES
+#define HUNT_PROFILER_SAMPLES 1024
+#endif
+
+#ifndef HUNT_PROFILER_DEPTH
+#define HUNT_PROFILER_DEPTH 32
+#endif
+
+#ifndef HUNT_PROFILER_INTERVAL_US
+#define HUNT_PROFILER_INTERVAL_US 1000
+#endif
+
+/*-------------------------------------------------------
+ * Phase Times
+ *-------------------------------------------------------*/
+
+/* With HUNT_INCLUDE_PHASE_TIMES, setUp, the test itself, tearDown and the
+ * verification of mocks are timed apart, after each test and for the suite */
+typedef enum {
+  HUNT_PHASE_SETUP,
+  HUNT_PHASE_TEST,
+  HUNT_PHASE_TEARDOWN,
+  HUNT_PHASE_VERIFY,
+  HUNT_PHASE_COUNT
+} HUNT_PHASE_T;
+
+/* Tracing and profiling follow the phases of each test as well */
+#if defined(HUNT_INCLUDE_PHASE_TIMES) || defined(HUNT_USE_TRACE) || defined(HUNT_USE_PROFILER)
+#define HUNT_USE_PHASE_HOOKS
+#endif
+
+#ifdef HUNT_USE_PHASE_HOOKS
+#define HUNT_PHASE_START(phase) HuntPhaseStart(phase)
+#define HUNT_PHASE_STOP() HuntPhaseStop()
+#else
+#define HUNT_PHASE_START(phase) do{}while(0)
+#define HUNT_PHASE_STOP() do{}while(0)
+#endif
+
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+#define HUNT_PRINT_PHASE_TIMES() HuntPrintPhaseTimes()
+#else
+#define HUNT_PRINT_PHASE_TIMES() do{}while(0)
+#endif
+
+/*-------------------------------------------------------
+ * Clock
+ *-------------------------------------------------------*/
+
+#if defined(HUNT_INCLUDE_BENCHMARK) || defined(HUNT_USE_EXEC_TIME_NS) || defined(HUNT_INCLUDE_PHASE_TIMES)
+#ifndef HUNT_CLOCK_NS
+#if defined(__unix__) || defined(__APPLE__) || defined(_WIN32)
+/* Hosts get a nanosecond clock from hunt.c. Targets define HUNT_CLOCK_NS() to
+ * return a free running count of nanoseconds (or any other unit) instead */
+#define HUNT_CLOCK_NS() HuntClockNs()
+#define HUNT_USE_HOST_CLOCK_NS
+#else
+#error "Benchmarks need a clock on this platform, define HUNT_CLOCK_NS()"
+#endif
+#endif
+#endif
+
+/* Times in nanoseconds are printed as "412 ns", "1.25 us", "12.50 ms" or "2.00 s" */
+#if defined(HUNT_CLOCK_NS) || defined(HUNT_USE_RUSAGE)
+#define HUNT_USE_DURATIONS
+#endif
+
+/* The clock_gettime() clock of hosts, such as CLOCK_MONOTONIC_RAW, or
+ * CLOCK_THREAD_CPUTIME_ID and CLOCK_PROCESS_CPUTIME_ID to leave out the time
+ * other threads and processes take */
+#ifndef HUNT_CLOCK_SOURCE
+#define HUNT_CLOCK_SOURCE CLOCK_MONOTONIC
+#endif
+
+/* Pairs of clock readings taken by HuntBegin() to find the cost of one */
+#ifndef HUNT_EXEC_TIME_CALIBRATIONS
+#define HUNT_EXEC_TIME_CALIBRATIONS 16
+#endif
+
+/* Timed runs on Linux that ask for it get their CPU ready before the first
+ * test: HuntBegin() warns unless its frequency governor is "performance" and
+ * warms it up. It also pins the process to CPU number HUNT_PIN_CPU and sets its
+ * nice value to HUNT_PRIORITY (negative ones need privileges) when those are
+ * defined, which asks for the rest as well */
+#if (defined(HUNT_INCLUDE_BENCHMARK) || defined(HUNT_USE_EXEC_TIME_NS)) && defined(__linux__) && \
+    (defined(HUNT_INCLUDE_BENCH_ENVIRONMENT) || defined(HUNT_PIN_CPU) || defined(HUNT_PRIORITY))
+#define HUNT_USE_BENCH_ENVIRONMENT
+#endif
+
+/* Warming up stops once the CPU runs a loop at the same speed a few times
+ * over, or after this long */
+#ifndef HUNT_WARMUP_MAX_NS
+#define HUNT_WARMUP_MAX_NS 200000000
+#endif
+
+#ifndef HUNT_BENCH_MIN_NS
+#define HUNT_BENCH_MIN_NS 10000000
+#endif
+
+#ifndef HUNT_BENCH_REPETITIONS
+#define HUNT_BENCH_REPETITIONS 5
+#endif
+
+/* Iterations of each cold run of a TEST_BENCHMARK_COLD test */
+#ifndef HUNT_BENCH_COLD_ITERATIONS
+#define HUNT_BENCH_COLD_ITERATIONS 16
+#endif
+
+/* Cold runs evict the caches with HUNT_BENCH_EVICT() if defined, like a loop
+ * of clflush over the data of the benchmark. Otherwise they stream over twice
+ * HUNT_BENCH_CACHE_BYTES of memory, the size of the last level cache, which
+ * Linux hosts find in sysfs when it is 0 */
+#if defined(HUNT_INCLUDE_BENCHMARK) && !defined(HUNT_BENCH_EVICT)
+#define HUNT_USE_BENCH_EVICT_BUFFER
+#ifndef HUNT_BENCH_CACHE_BYTES
+#define HUNT_BENCH_CACHE_BYTES 0
+#ifdef __linux__
+#define HUNT_USE_SYSFS_CACHE_SIZE
+#endif
+#endif
+#endif
+
+/* Runners with command line arguments can save benchmarks to a baseline file,
+ * and compare them against one */
+#if defined(HUNT_INCLUDE_BENCHMARK) && defined(HUNT_USE_COMMAND_LINE_ARGS) && !defined(HUNT_EXCLUDE_BENCH_BASELINE)
+#define HUNT_USE_BENCH_BASELINE
+#endif
+
+#ifndef HUNT_BENCH_THRESHOLD
+#define HUNT_BENCH_THRESHOLD 5
+#endif
+
+#ifndef HUNT_BENCH_ALPHA_PERCENT
+#define HUNT_BENCH_ALPHA_PERCENT 5
+#endif
+
+#ifndef HUNT_BENCH_LINE_LENGTH
+#define HUNT_BENCH_LINE_LENGTH 1024
+#endif
+
+/* Samples compared with a baseline, few enough to count their exact distribution */
+#ifndef HUNT_BENCH_MAX_SAMPLES
+#ifdef HUNT_SUPPORT_64
+#define HUNT_BENCH_MAX_SAMPLES 24
+#else
+#define HUNT_BENCH_MAX_SAMPLES 12
+#endif
+#endif
+
+/* Calibration stops here even if the clock did not move, and this many
+ * iterations leave room to print times per iteration with decimals */
+#ifndef HUNT_BENCH_MAX_ITERATIONS
+#ifdef HUNT_SUPPORT_64
+#define HUNT_BENCH_MAX_ITERATIONS 0x40000000
+#else
+#define HUNT_BENCH_MAX_ITERATIONS 0x01000000
+#endif
+#endif
+
 /*-------------------------------------------------------
  * Footprint
  *-------------------------------------------------------*/
@@ -484,6 +773,9 @@ struct HUNT_STORAGE_T {
   HUNT_TIME_TYPE CurrentTestStartTime;
   HUNT_TIME_TYPE CurrentTestStopTime;
 #endif
+#ifdef HUNT_USE_TIME_BUDGETS
+  HUNT_UINT CurrentTestBudget;
+#endif
 #ifndef HUNT_EXCLUDE_SETJMP_H
   jmp_buf AbortFrame;
 #endif
@@ -503,6 +795,254 @@ void HuntConcludeTest(void);
 
 void HuntDefaultTestRun(HuntTestFunction Func, const char *FuncName, const int FuncLineNum);
 
+/* Runs the body of a TEST_PARAMS test once for each of the count entries of a
+ * table, as cases named "test[index]" or "test[label]". Failing and ignored
+ * cases are reported on their own lines; the test fails if any case failed.
+ * Without HUNT_INCLUDE_PARAMS the test is ignored instead. Benchmark sweeps run
+ * their sizes as cases too. */
+#if defined(HUNT_INCLUDE_PARAMS) || defined(HUNT_INCLUDE_BENCHMARK)
+#define HUNT_USE_PARAMS_CASES
+#endif
+
+typedef void (*HuntParamsFunction)(const void *param);
+typedef const char* (*HuntParamsFormatter)(const void *param);
+
+#ifndef HUNT_PARAMS_NAME_LENGTH
+#define HUNT_PARAMS_NAME_LENGTH 64
+#endif
+
+void HuntRunParams(HuntParamsFunction Func, HuntParamsFormatter Formatter,
+                   const void *table, const HUNT_UINT size, const HUNT_UINT count);
+
+#define HUNT_PARAMS_PROTOTYPES(name, type) \
+    void name(void); \
+    static void name##_params(const type *param); \
+    static void name##_thunk(const void *param) { name##_params((const type *)param); }
+
+#define HUNT_PARAMS_RUN(name, table, label) \
+    HuntRunParams(name##_thunk, (label), (const void *)(table), \
+                  (HUNT_UINT)sizeof((table)[0]), (HUNT_UINT)(sizeof(table) / sizeof((table)[0])))
+
+/* One axis of a TEST_COMBINATIONS test: either a table of values, or the
+ * values First, First + Step, ... Count values in all. */
+typedef struct {
+  const HUNT_INT *Values;
+  HUNT_INT First;
+  HUNT_INT Step;
+  HUNT_UINT Count;
+} HuntAxis;
+
+typedef enum {
+  HUNT_CARTESIAN = 0,
+  HUNT_PAIRWISE
+} HUNT_COMBINATION_T;
+
+#ifndef HUNT_COMBINATIONS_MAX_AXES
+#define HUNT_COMBINATIONS_MAX_AXES 8
+#endif
+
+#ifndef HUNT_PAIRWISE_MAX_PAIRS
+#define HUNT_PAIRWISE_MAX_PAIRS 4096
+#endif
+
+/* Runs the body of a TEST_COMBINATIONS test for each combination of values of
+ * the axes: all of them, or with HUNT_PAIRWISE only enough of them to have
+ * every pair of values of any two axes show up at least once. The test is
+ * ignored if an axis has no values, or without HUNT_INCLUDE_PARAMS. */
+void HuntRunCombinations(HuntParamsFunction Func, const HuntAxis *axes, const HUNT_UINT count,
+                         const HUNT_COMBINATION_T mode);
+
+/* State of a TEST_BENCHMARK test, driven by HUNT_BENCH_LOOP. Each run of the
+ * loop counts Remaining down from Iterations and times it into Elapsed. Size
+ * is the size being measured by a sweep, and the benchmark may set the Items
+ * or Bytes handled by one iteration to have its throughput reported. Cold
+ * runs evict the caches before every iteration, and count the iterations
+ * still to go in ColdRemaining instead. */
+typedef struct {
+  HUNT_UINT Iterations;
+  HUNT_UINT Remaining;
+  HUNT_UINT Start;
+  HUNT_UINT Elapsed;
+  HUNT_UINT Size;
+  HUNT_UINT Items;
+  HUNT_UINT Bytes;
+  HUNT_UINT ColdRemaining;
+  int Cold;
+  int Looped;
+} HuntBenchState;
+
+typedef void (*HuntBenchFunction)(HuntBenchState *state);
+
+/* Statistics of the repetitions of a benchmark, all times per repetition, and
+ * their coefficient of variation in ten thousandths */
+typedef struct {
+  HUNT_UINT Iterations;
+  HUNT_UINT Repetitions;
+  HUNT_UINT Median;
+  HUNT_UINT Min;
+  HUNT_UINT Mad;
+  HUNT_UINT Cv;
+} HuntBenchResult;
+
+/* Complexities a sweep is fitted against, HUNT_BIG_O_ANY expects none in particular */
+typedef enum {
+  HUNT_BIG_O_ANY = 0,
+  HUNT_BIG_O_1,
+  HUNT_BIG_O_LOG_N,
+  HUNT_BIG_O_N,
+  HUNT_BIG_O_N_LOG_N,
+  HUNT_BIG_O_N_SQUARED
+} HUNT_BIG_O_T;
+
+#ifndef HUNT_BENCH_MAX_POINTS
+#define HUNT_BENCH_MAX_POINTS 32
+#endif
+
+/* Pairs of runs of A and B compared by TEST_BENCHMARK_AB, few enough to count 2^pairs */
+#ifndef HUNT_BENCH_AB_PAIRS
+#define HUNT_BENCH_AB_PAIRS 15
+#endif
+
+void HuntRunBenchmark(HuntBenchFunction Func);
+void HuntRunBenchmarkRange(HuntBenchFunction Func, const HUNT_UINT first, const HUNT_UINT last,
+                           const HUNT_UINT factor, const HUNT_BIG_O_T expected);
+void HuntRunBenchmarkAB(HuntBenchFunction FuncA, HuntBenchFunction FuncB, const HUNT_UINT faster);
+void HuntRunBenchmarkCold(HuntBenchFunction Func);
+void HuntBenchStart(HuntBenchState *state);
+int HuntBenchStop(HuntBenchState *state);
+#ifdef HUNT_INCLUDE_BENCHMARK
+void HuntBenchSummarize(HUNT_UINT *samples, const HUNT_UINT count, HuntBenchResult *result);
+HUNT_UINT HuntBenchMedianInterval(const HUNT_UINT count);
+#ifndef HUNT_EXCLUDE_FLOAT
+HUNT_BIG_O_T HuntBigOFit(const HUNT_UINT *sizes, const HUNT_FLOAT *times, const HUNT_UINT count, HUNT_FLOAT *rms);
+#endif
+#endif
+#ifdef HUNT_USE_HOST_CLOCK_NS
+HUNT_UINT HuntClockNs(void);
+#endif
+#ifdef HUNT_USE_HOST_CLOCK_MS
+HUNT_UINT HuntClockMs(void);
+#endif
+
+/* Latency histogram with HdrHistogram's log-linear buckets: values below
+ * 2^HUNT_HISTOGRAM_SUB_BITS are counted exactly, and each power of two above
+ * them is split into 2^(HUNT_HISTOGRAM_SUB_BITS - 1) buckets, so that every
+ * value is known to within 1 / 2^(HUNT_HISTOGRAM_SUB_BITS - 1) of itself.
+ * Recording takes the same few steps for any value and allocates nothing. */
+#ifndef HUNT_HISTOGRAM_SUB_BITS
+#define HUNT_HISTOGRAM_SUB_BITS 6
+#endif
+
+#ifdef HUNT_SUPPORT_64
+#define HUNT_HISTOGRAM_BITS 64
+#else
+#define HUNT_HISTOGRAM_BITS 32
+#endif
+
+#define HUNT_HISTOGRAM_BUCKETS ((HUNT_HISTOGRAM_BITS - HUNT_HISTOGRAM_SUB_BITS + 2) << (HUNT_HISTOGRAM_SUB_BITS - 1))
+
+typedef struct {
+  HUNT_UINT Counts[HUNT_HISTOGRAM_BUCKETS];
+  HUNT_UINT Total;
+  HUNT_UINT Min;
+  HUNT_UINT Max;
+} HuntHistogram;
+
+/* Percentiles are given in hundredths of a percent, 9990 for p99.9 */
+#define HUNT_PERCENTILE(percentile) ((HUNT_UINT) (((percentile) * 100) + 0.5))
+
+void HuntHistogramReset(HuntHistogram *histogram);
+void HuntHistogramRecord(HuntHistogram *histogram, const HUNT_UINT value);
+HUNT_UINT HuntHistogramPercentile(const HuntHistogram *histogram, const HUNT_UINT percentile);
+void HuntPrintHistogram(const HuntHistogram *histogram, const HUNT_LINE_TYPE line);
+
+/* Prints an exec time in nanoseconds, less the time it takes to read the clock */
+#ifdef HUNT_USE_DURATIONS
+void HuntPrintExecTime(const HUNT_UINT elapsed);
+#endif
+
+/* Optimizer barriers for benchmarks. HUNT_DO_NOT_OPTIMIZE(value) makes the
+ * compiler compute value, and keep whatever it points to written so far.
+ * HUNT_CLOBBER_MEMORY() makes it finish every write to memory before, and
+ * read memory again after. GCC and clang get empty inline assembly. Other
+ * compilers call into hunt.c built with HUNT_INCLUDE_BENCHMARK instead, which
+ * holds without link time optimization, and need value to be a variable there. */
+#ifndef HUNT_DO_NOT_OPTIMIZE
+#if defined(__GNUC__) /* __GNUC__ includes clang */
+#define HUNT_DO_NOT_OPTIMIZE(value) __asm__ __volatile__("" : : "r,m"(value) : "memory")
+#else
+#define HUNT_DO_NOT_OPTIMIZE(value) HuntDoNotOptimize((const volatile void *) &(value))
+#endif
+#endif
+
+#ifndef HUNT_CLOBBER_MEMORY
+#if defined(__GNUC__)
+#define HUNT_CLOBBER_MEMORY() __asm__ __volatile__("" : : : "memory")
+#else
+#define HUNT_CLOBBER_MEMORY() HuntClobberMemory()
+#endif
+#endif
+
+#ifdef HUNT_INCLUDE_BENCHMARK
+void HuntDoNotOptimize(const volatile void *value);
+void HuntClobberMemory(void);
+#endif
+
+/* Events counted for each test with HUNT_INCLUDE_PERF_COUNTERS. The hardware
+ * events are often not permitted, in virtual machines and containers for one,
+ * and are then left out. */
+typedef enum {
+  HUNT_PERF_INSTRUCTIONS = 0,
+  HUNT_PERF_CYCLES,
+  HUNT_PERF_BRANCH_MISSES,
+  HUNT_PERF_CACHE_MISSES,
+  HUNT_PERF_PAGE_FAULTS,
+  HUNT_PERF_CONTEXT_SWITCHES,
+  HUNT_PERF_EVENT_COUNT
+} HUNT_PERF_EVENT_T;
+
+/* Count of an event in the current test so far, or 0 if it is not counted */
+HUNT_UINT HuntPerfCount(const HUNT_PERF_EVENT_T event);
+#ifdef HUNT_USE_PERF_EVENTS
+void HuntPerfStart(void);
+void HuntPerfStop(void);
+void HuntPerfPrint(void);
+#endif
+
+#ifdef HUNT_USE_RUSAGE
+void HuntRusageStart(void);
+void HuntRusageStop(void);
+void HuntRusagePrint(void);
+#endif
+
+#ifdef HUNT_USE_TRACE
+int HuntTraceOpen(const char *path);
+void HuntTraceBegin(const char *name, const char *category);
+void HuntTraceEnd(void);
+void HuntTraceTestStart(void);
+void HuntTraceTestStop(void);
+#endif
+
+#ifdef HUNT_USE_PROFILER
+int HuntProfileOpen(const char *path);
+void HuntProfileWrite(void);
+#endif
+
+#ifdef HUNT_USE_PHASE_HOOKS
+void HuntPhaseStart(const HUNT_PHASE_T phase);
+void HuntPhaseStop(void);
+#endif
+#ifdef HUNT_INCLUDE_PHASE_TIMES
+void HuntPrintPhaseTimes(void);
+#endif
+
+/* Wrap the runners of several test files in one process. Each runner still
+ * calls HuntBegin() and HuntEnd() for its own file, but the counts are
+ * combined and only HuntAggregateEnd() prints the summary. */
+void HuntAggregateBegin(void);
+
+int HuntAggregateEnd(void);
+
 /*-------------------------------------------------------
  * Details Support
  *-------------------------------------------------------*/
@@ -636,6 +1176,26 @@ void HuntIgnore(const char *message, const HUNT_LINE_TYPE line);
 
 void HuntMessage(const char *message, const HUNT_LINE_TYPE line);
 
+void HuntAssertPercentileBelow(const HuntHistogram *histogram,
+                               const HUNT_UINT percentile,
+                               const HUNT_UINT threshold,
+                               const char *msg,
+                               const HUNT_LINE_TYPE lineNumber);
+
+#ifdef HUNT_USE_TIME_BUDGETS
+extern HUNT_UINT HuntTimeBudgetScale;
+
+void HuntAssertExecTimeBelow(const HUNT_UINT budget,
+                             const char *msg,
+                             const HUNT_LINE_TYPE lineNumber);
+
+void HuntCheckTimeBudget(void);
+#endif
+
+#ifdef HUNT_USE_SLOWEST_TESTS
+void HuntRecordTestTime(void);
+#endif
+
 #ifndef HUNT_EXCLUDE_FLOAT
 
 void HuntAssertFloatsWithin(const HUNT_FLOAT delta,
@@ -705,6 +1265,8 @@ extern const char HuntStrIgnore[];
 extern const char HuntStrErrFloat[];
 extern const char HuntStrErrDouble[];
 extern const char HuntStrErr64[];
+extern const char HuntStrErrBenchmark[];
+extern const char HuntStrErrParams[];
 extern const char HuntStrErrShorthand[];
 
 /*-------------------------------------------------------
@@ -1023,5 +1585,13 @@ int HuntTestMatches(void);
 #define HUNT_TEST_ASSERT_DOUBLE_IS_NOT_DETERMINATE(actual, line, message)                       HuntAssertDoubleSpecial((HUNT_DOUBLE)(actual), (message), (HUNT_LINE_TYPE)(line), HUNT_FLOAT_IS_NOT_DET)
 #endif
 
+#define HUNT_TEST_ASSERT_PERCENTILE_BELOW(histogram, percentile, threshold, line, message)      HuntAssertPercentileBelow((histogram), HUNT_PERCENTILE(percentile), (HUNT_UINT)(threshold), (message), (HUNT_LINE_TYPE)(line))
+
+#ifdef HUNT_USE_TIME_BUDGETS
+#define HUNT_TEST_ASSERT_EXEC_TIME_BELOW(budget, line, message)                                 HuntAssertExecTimeBelow((HUNT_UINT)(budget), (message), (HUNT_LINE_TYPE)(line))
+#else
+#define HUNT_TEST_ASSERT_EXEC_TIME_BELOW(budget, line, message)                                 do{}while(0)
+#endif
+
 /* End of HUNT_INTERNALS_H */
 #endif
@@ -0,0 +1,19 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+
+/*=======Test File Runners=====*/
+extern int main_testAggregateFirst(void);
+extern int main_testAggregateSecond(void);
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  int num_failures = 0;
+  HuntAggregateBegin();
+  num_failures += main_testAggregateFirst();
+  num_failures += main_testAggregateSecond();
+  (void)HuntAggregateEnd();
+  return num_failures;
+}
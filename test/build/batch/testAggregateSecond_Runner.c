@@ -0,0 +1,88 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Hunt.CurrentTestName = #TestFunc; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_SecondFileRunsItsOwnSetup(void);
+extern void test_SecondFileFails(void);
+extern void test_SecondFileIgnores(void);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest_testAggregateSecond(void);
+void resetTest_testAggregateSecond(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+ int main_testAggregateSecond(void);
+int main_testAggregateSecond(void)
+{
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("testdata/testAggregateSecond.c");
+  RUN_TEST(test_SecondFileRunsItsOwnSetup, 20);
+  RUN_TEST(test_SecondFileFails, 25);
+  RUN_TEST(test_SecondFileIgnores, 30);
+
+  return suite_teardown(HuntEnd());
+}
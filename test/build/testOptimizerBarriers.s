@@ -0,0 +1,27 @@
+	.file	"testOptimizerBarriers.c"
+	.text
+	.p2align 4
+	.globl	multiplyIsKept
+	.type	multiplyIsKept, @function
+multiplyIsKept:
+.LFB0:
+	.cfi_startproc
+	imull	$-1640531535, %edi, %edi
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	multiplyIsKept, .-multiplyIsKept
+	.p2align 4
+	.globl	storeIsKept
+	.type	storeIsKept, @function
+storeIsKept:
+.LFB1:
+	.cfi_startproc
+	leaq	-24(%rsp), %rax
+	movl	$625341585, -24(%rsp)
+	ret
+	.cfi_endproc
+.LFE1:
+	.size	storeIsKept, .-storeIsKept
+	.ident	"GCC: (Debian 12.2.0-14+deb12u1) 12.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,1412 @@
+#include "hunt.h" /* Autogenerated by awk in Makefile */
+void testHuntSizeInitializationReminder(void);
+void testPassShouldEndImmediatelyWithPass(void);
+void testPassShouldEndImmediatelyWithPassAndMessage(void);
+void testMessageShouldDisplayMessageWithoutEndingAndGoOnToPass(void);
+void testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail(void);
+void testTrue(void);
+void testFalse(void);
+void testPreviousPass(void);
+void testNotVanilla(void);
+void testNotTrue(void);
+void testNotFalse(void);
+void testNotUnless(void);
+void testNotNotEqual(void);
+void testFail(void);
+void testIsNull(void);
+void testIsNullShouldFailIfNot(void);
+void testNotNullShouldFailIfNULL(void);
+void testIgnore(void);
+void testIgnoreMessage(void);
+void testNotEqualInts(void);
+void testNotEqualInt8s(void);
+void testNotEqualInt16s(void);
+void testNotEqualInt32s(void);
+void testNotEqualBits(void);
+void testNotEqualUInts(void);
+void testNotEqualUInt8s(void);
+void testNotEqualUInt16s(void);
+void testNotEqualUInt32s(void);
+void testNotEqualHex8s(void);
+void testNotEqualHex8sIfSigned(void);
+void testNotEqualHex16s(void);
+void testNotEqualHex16sIfSigned(void);
+void testNotEqualHex32s(void);
+void testNotEqualHex32sIfSigned(void);
+void testEqualInts(void);
+void testEqualInt8s(void);
+void testEqualInt8sWhenThereAreDifferencesOutside8Bits(void);
+void testEqualInt16s(void);
+void testEqualInt16sNegatives(void);
+void testEqualInt16sWhenThereAreDifferencesOutside16Bits(void);
+void testEqualInt32s(void);
+void testEqualInt32sNegatives(void);
+void testEqualUints(void);
+void testEqualUint8s(void);
+void testEqualUint8sWhenThereAreDifferencesOutside8Bits(void);
+void testEqualUint16s(void);
+void testEqualUint16sWhenThereAreDifferencesOutside16Bits(void);
+void testEqualUint32s(void);
+void testNotEqual(void);
+void testEqualHex8s(void);
+void testEqualHex8sWhenThereAreDifferencesOutside8Bits(void);
+void testEqualHex8sNegatives(void);
+void testEqualHex16s(void);
+void testEqualHex16sWhenThereAreDifferencesOutside16Bits(void);
+void testEqualHex32s(void);
+void testEqualBits(void);
+void testNotEqualBitHigh(void);
+void testNotEqualBitLow(void);
+void testNotEqualBitsHigh(void);
+void testNotEqualBitsLow(void);
+void testEqualShorts(void);
+void testEqualUShorts(void);
+void testEqualChars(void);
+void testEqualUChars(void);
+void testEqualPointers(void);
+void testNotEqualPointers(void);
+void testIntsWithinDelta(void);
+void testIntsWithinDeltaAndCustomMessage(void);
+void testIntsNotWithinDelta(void);
+void testIntsNotWithinDeltaAndCustomMessage(void);
+void testUIntsWithinDelta(void);
+void testUIntsWithinDeltaAndCustomMessage(void);
+void testUIntsNotWithinDelta(void);
+void testUIntsNotWithinDeltaAndCustomMessage(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst(void);
+void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage(void);
+void testHEX32sWithinDelta(void);
+void testHEX32sWithinDeltaAndCustomMessage(void);
+void testHEX32sNotWithinDelta(void);
+void testHEX32sNotWithinDeltaAndCustomMessage(void);
+void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+void testHEX16sWithinDelta(void);
+void testHEX16sWithinDeltaAndCustomMessage(void);
+void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+void testHEX16sNotWithinDelta(void);
+void testHEX16sNotWithinDeltaAndCustomMessage(void);
+void testHEX8sWithinDelta(void);
+void testHEX8sWithinDeltaAndCustomMessage(void);
+void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testHEX8sNotWithinDelta(void);
+void testHEX8sNotWithinDeltaAndCustomMessage(void);
+void testUINT32sWithinDelta(void);
+void testUINT32sWithinDeltaAndCustomMessage(void);
+void testUINT32sNotWithinDelta(void);
+void testUINT32sNotWithinDeltaAndCustomMessage(void);
+void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+void testUINT16sWithinDelta(void);
+void testUINT16sWithinDeltaAndCustomMessage(void);
+void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+void testUINT16sNotWithinDelta(void);
+void testUINT16sNotWithinDeltaAndCustomMessage(void);
+void testUINT8sWithinDelta(void);
+void testUINT8sWithinDeltaAndCustomMessage(void);
+void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testUINT8sNotWithinDelta(void);
+void testUINT8sNotWithinDeltaAndCustomMessage(void);
+void testINT32sWithinDelta(void);
+void testINT32sWithinDeltaAndCustomMessage(void);
+void testINT32sNotWithinDelta(void);
+void testINT32sNotWithinDeltaAndDifferenceOverflows(void);
+void testINT32sNotWithinDeltaAndCustomMessage(void);
+void testINT16sWithinDelta(void);
+void testINT16sWithinDeltaAndCustomMessage(void);
+void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+void testINT16sNotWithinDelta(void);
+void testINT16sNotWithinDeltaAndCustomMessage(void);
+void testINT8sWithinDelta(void);
+void testINT8sWithinDeltaAndCustomMessage(void);
+void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+void testINT8sNotWithinDelta(void);
+void testINT8sNotWithinDeltaAndCustomMessage(void);
+void testInt64ArrayWithinDelta(void);
+void testInt64ArrayWithinDeltaAndMessage(void);
+void testInt64ArrayNotWithinDeltaAndMessage(void);
+void testInt64ArrayWithinDeltaPointless(void);
+void testInt64ArrayWithinDeltaPointlessAndMessage(void);
+void testInt64ArrayWithinDeltaExpectedNull(void);
+void testInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt64ArrayWithinDeltaActualNull(void);
+void testInt64ArrayWithinDeltaActualNullAndMessage(void);
+void testInt64ArrayWithinDeltaSamePointer(void);
+void testInt64ArrayWithinDeltaSamePointerAndMessage(void);
+void testIntArrayWithinDelta(void);
+void testIntArrayWithinDeltaAndMessage(void);
+void testIntArrayNotWithinDelta(void);
+void testIntArrayNotWithinDeltaAndMessage(void);
+void testIntArrayWithinDeltaPointless(void);
+void testIntArrayWithinDeltaPointlessAndMessage(void);
+void testIntArrayWithinDeltaExpectedNull(void);
+void testIntArrayWithinDeltaExpectedNullAndMessage(void);
+void testIntArrayWithinDeltaActualNull(void);
+void testIntArrayWithinDeltaActualNullAndMessage(void);
+void testIntArrayWithinDeltaSamePointer(void);
+void testIntArrayWithinDeltaSamePointerAndMessage(void);
+void testInt16ArrayWithinDelta(void);
+void testInt16ArrayWithinDeltaAndMessage(void);
+void testInt16ArrayNotWithinDelta(void);
+void testInt16ArrayNotWithinDeltaAndMessage(void);
+void testInt16ArrayWithinDeltaPointless(void);
+void testInt16ArrayWithinDeltaPointlessAndMessage(void);
+void testInt16ArrayWithinDeltaExpectedNull(void);
+void testInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt16ArrayWithinDeltaActualNull(void);
+void testInt16ArrayWithinDeltaActualNullAndMessage(void);
+void testInt16ArrayWithinDeltaSamePointer(void);
+void testInt16ArrayWithinDeltaSamePointerAndMessage(void);
+void testInt8ArrayWithinDelta(void);
+void testInt8ArrayWithinDeltaAndMessage(void);
+void testInt8ArrayNotWithinDelta(void);
+void testInt8ArrayNotWithinDeltaAndMessage(void);
+void testInt8ArrayWithinDeltaPointless(void);
+void testInt8ArrayWithinDeltaPointlessAndMessage(void);
+void testInt8ArrayWithinDeltaExpectedNull(void);
+void testInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+void testInt8ArrayWithinDeltaActualNull(void);
+void testInt8ArrayWithinDeltaActualNullAndMessage(void);
+void testInt8ArrayWithinDeltaSamePointer(void);
+void testInt8ArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt64ArrayWithinDelta(void);
+void testUInt64ArrayWithinDeltaAndMessage(void);
+void testUInt64ArrayNotWithinDelta(void);
+void testUInt64ArrayNotWithinDeltaAndMessage(void);
+void testUInt64ArrayWithinDeltaPointless(void);
+void testUInt64ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt64ArrayWithinDeltaExpectedNull(void);
+void testUInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt64ArrayWithinDeltaActualNull(void);
+void testUInt64ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt64ArrayWithinDeltaSamePointer(void);
+void testUInt64ArrayWithinDeltaSamePointerAndMessage(void);
+void testUIntArrayWithinDelta(void);
+void testUIntArrayWithinDeltaAndMessage(void);
+void testUIntArrayNotWithinDelta(void);
+void testUIntArrayNotWithinDeltaAndMessage(void);
+void testUIntArrayWithinDeltaPointless(void);
+void testUIntArrayWithinDeltaPointlessAndMessage(void);
+void testUIntArrayWithinDeltaExpectedNull(void);
+void testUIntArrayWithinDeltaExpectedNullAndMessage(void);
+void testUIntArrayWithinDeltaActualNull(void);
+void testUIntArrayWithinDeltaActualNullAndMessage(void);
+void testUIntArrayWithinDeltaSamePointer(void);
+void testUIntArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt16ArrayWithinDelta(void);
+void testUInt16ArrayWithinDeltaAndMessage(void);
+void testUInt16ArrayNotWithinDelta(void);
+void testUInt16ArrayNotWithinDeltaAndMessage(void);
+void testUInt16ArrayWithinDeltaPointless(void);
+void testUInt16ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt16ArrayWithinDeltaExpectedNull(void);
+void testUInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt16ArrayWithinDeltaActualNull(void);
+void testUInt16ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt16ArrayWithinDeltaSamePointer(void);
+void testUInt16ArrayWithinDeltaSamePointerAndMessage(void);
+void testUInt8ArrayWithinDelta(void);
+void testUInt8ArrayWithinDeltaAndMessage(void);
+void testUInt8ArrayNotWithinDelta(void);
+void testUInt8ArrayNotWithinDeltaAndMessage(void);
+void testUInt8ArrayWithinDeltaPointless(void);
+void testUInt8ArrayWithinDeltaPointlessAndMessage(void);
+void testUInt8ArrayWithinDeltaExpectedNull(void);
+void testUInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+void testUInt8ArrayWithinDeltaActualNull(void);
+void testUInt8ArrayWithinDeltaActualNullAndMessage(void);
+void testUInt8ArrayWithinDeltaSamePointer(void);
+void testUInt8ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX64ArrayWithinDelta(void);
+void testHEX64ArrayWithinDeltaAndMessage(void);
+void testHEX64ArrayNotWithinDelta(void);
+void testHEX64ArrayNotWithinDeltaAndMessage(void);
+void testHEX64ArrayWithinDeltaPointless(void);
+void testHEX64ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX64ArrayWithinDeltaExpectedNull(void);
+void testHEX64ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX64ArrayWithinDeltaActualNull(void);
+void testHEX64ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX64ArrayWithinDeltaSamePointer(void);
+void testHEX64ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX32ArrayWithinDelta(void);
+void testHEX32ArrayWithinDeltaAndMessage(void);
+void testHEX32ArrayNotWithinDelta(void);
+void testHEX32ArrayNotWithinDeltaAndMessage(void);
+void testHEX32ArrayWithinDeltaPointless(void);
+void testHEX32ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX32ArrayWithinDeltaExpectedNull(void);
+void testHEX32ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX32ArrayWithinDeltaActualNull(void);
+void testHEX32ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX32ArrayWithinDeltaSamePointer(void);
+void testHEX32ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX16ArrayWithinDelta(void);
+void testHEX16ArrayWithinDeltaAndMessage(void);
+void testHEX16ArrayNotWithinDelta(void);
+void testHEX16ArrayNotWithinDeltaAndMessage(void);
+void testHEX16ArrayWithinDeltaPointless(void);
+void testHEX16ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX16ArrayWithinDeltaExpectedNull(void);
+void testHEX16ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX16ArrayWithinDeltaActualNull(void);
+void testHEX16ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX16ArrayWithinDeltaSamePointer(void);
+void testHEX16ArrayWithinDeltaSamePointerAndMessage(void);
+void testHEX8ArrayWithinDelta(void);
+void testHEX8ArrayWithinDeltaAndMessage(void);
+void testHEX8ArrayNotWithinDelta(void);
+void testHEX8ArrayNotWithinDeltaAndMessage(void);
+void testHEX8ArrayWithinDeltaPointless(void);
+void testHEX8ArrayWithinDeltaPointlessAndMessage(void);
+void testHEX8ArrayWithinDeltaExpectedNull(void);
+void testHEX8ArrayWithinDeltaExpectedNullAndMessage(void);
+void testHEX8ArrayWithinDeltaActualNull(void);
+void testHEX8ArrayWithinDeltaActualNullAndMessage(void);
+void testHEX8ArrayWithinDeltaSamePointer(void);
+void testHEX8ArrayWithinDeltaSamePointerAndMessage(void);
+void testGreaterThan(void);
+void testNotGreaterThan(void);
+void testGreaterThanINT(void);
+void testNotGreaterThanINT(void);
+void testGreaterThanINT8(void);
+void testNotGreaterThanINT8(void);
+void testGreaterThanINT16(void);
+void testNotGreaterThanINT16(void);
+void testGreaterThanINT32(void);
+void testNotGreaterThanINT32(void);
+void testGreaterThanUINT(void);
+void testNotGreaterThanUINT(void);
+void testGreaterThanUINT8(void);
+void testNotGreaterThanUINT8(void);
+void testGreaterThanUINT16(void);
+void testNotGreaterThanUINT16(void);
+void testGreaterThanUINT32(void);
+void testNotGreaterThanUINT32(void);
+void testGreaterThanHEX8(void);
+void testNotGreaterThanHEX8(void);
+void testGreaterThanHEX16(void);
+void testNotGreaterThanHEX16(void);
+void testGreaterThanHEX32(void);
+void testNotGreaterThanHEX32(void);
+void testGreaterOrEqual(void);
+void testNotGreaterOrEqual(void);
+void testGreaterOrEqualINT(void);
+void testNotGreaterOrEqualINT(void);
+void testGreaterOrEqualINT8(void);
+void testNotGreaterOrEqualINT8(void);
+void testGreaterOrEqualINT16(void);
+void testNotGreaterOrEqualINT16(void);
+void testGreaterOrEqualINT32(void);
+void testNotGreaterOrEqualINT32(void);
+void testGreaterOrEqualUINT(void);
+void testNotGreaterOrEqualUINT(void);
+void testGreaterOrEqualUINT8(void);
+void testNotGreaterOrEqualUINT8(void);
+void testGreaterOrEqualUINT16(void);
+void testNotGreaterOrEqualUINT16(void);
+void testGreaterOrEqualUINT32(void);
+void testNotGreaterOrEqualUINT32(void);
+void testGreaterOrEqualHEX8(void);
+void testNotGreaterOrEqualHEX8(void);
+void testGreaterOrEqualHEX16(void);
+void testNotGreaterOrEqualHEX16(void);
+void testGreaterOrEqualHEX32(void);
+void testNotGreaterOrEqualHEX32(void);
+void testLessThan(void);
+void testNotLessThan(void);
+void testLessThanINT(void);
+void testNotLessThanINT(void);
+void testLessThanINT8(void);
+void testNotLessThanINT8(void);
+void testLessThanINT16(void);
+void testNotLessThanINT16(void);
+void testLessThanINT32(void);
+void testNotLessThanINT32(void);
+void testLessThanUINT(void);
+void testNotLessThanUINT(void);
+void testLessThanUINT8(void);
+void testNotLessThanUINT8(void);
+void testLessThanUINT16(void);
+void testNotLessThanUINT16(void);
+void testLessThanUINT32(void);
+void testNotLessThanUINT32(void);
+void testLessThanHEX8(void);
+void testNotLessThanHEX8(void);
+void testLessThanHEX16(void);
+void testNotLessThanHEX16(void);
+void testLessThanHEX32(void);
+void testNotLessThanHEX32(void);
+void testLessOrEqual(void);
+void testNotLessOrEqual(void);
+void testLessOrEqualINT(void);
+void testNotLessOrEqualINT(void);
+void testLessOrEqualINT8(void);
+void testNotLessOrEqualINT8(void);
+void testLessOrEqualINT16(void);
+void testNotLessOrEqualINT16(void);
+void testLessOrEqualINT32(void);
+void testNotLessOrEqualINT32(void);
+void testLessOrEqualUINT(void);
+void testNotLessOrEqualUINT(void);
+void testLessOrEqualUINT8(void);
+void testNotLessOrEqualUINT8(void);
+void testLessOrEqualUINT16(void);
+void testNotLessOrEqualUINT16(void);
+void testLessOrEqualUINT32(void);
+void testNotLessOrEqualUINT32(void);
+void testLessOrEqualHEX8(void);
+void testNotLessOrEqualHEX8(void);
+void testLessOrEqualHEX16(void);
+void testNotLessOrEqualHEX16(void);
+void testLessOrEqualHEX32(void);
+void testNotLessOrEqualHEX32(void);
+void testEqualStrings(void);
+void testEqualStringsLen(void);
+void testEqualStringsWithCarriageReturnsAndLineFeeds(void);
+void testNotEqualString1(void);
+void testNotEqualStringLen1(void);
+void testNotEqualString2(void);
+void testNotEqualStringLen2(void);
+void testNotEqualString3(void);
+void testNotEqualStringLen3(void);
+void testNotEqualString4(void);
+void testNotEqualStringLen4(void);
+void testNotEqualString5(void);
+void testNotEqualString_ExpectedStringIsNull(void);
+void testNotEqualStringLen_ExpectedStringIsNull(void);
+void testNotEqualString_ActualStringIsNull(void);
+void testNotEqualStringLen_ActualStringIsNull(void);
+void testNotEqualString_ExpectedStringIsLonger(void);
+void testNotEqualString_ActualStringIsLonger(void);
+void testEqualStringArrays(void);
+void testNotEqualStringArray1(void);
+void testNotEqualStringArray2(void);
+void testNotEqualStringArray3(void);
+void testNotEqualStringArray4(void);
+void testNotEqualStringArray5(void);
+void testNotEqualStringArray6(void);
+void testEqualStringArrayIfBothNulls(void);
+void testNotEqualStringArrayLengthZero(void);
+void testEqualStringEachEqual(void);
+void testNotEqualStringEachEqual1(void);
+void testNotEqualStringEachEqual2(void);
+void testNotEqualStringEachEqual3(void);
+void testNotEqualStringEachEqual4(void);
+void testNotEqualStringEachEqual5(void);
+void testEqualMemory(void);
+void testNotEqualMemory1(void);
+void testNotEqualMemory2(void);
+void testNotEqualMemory3(void);
+void testNotEqualMemory4(void);
+void testNotEqualMemoryLengthZero(void);
+void testEqualIntArrays(void);
+void testNotEqualIntArraysNullExpected(void);
+void testNotEqualIntArraysNullActual(void);
+void testNotEqualIntArrays1(void);
+void testNotEqualIntArrays2(void);
+void testNotEqualIntArrays3(void);
+void testNotEqualIntArraysLengthZero(void);
+void testEqualIntEachEqual(void);
+void testNotEqualIntEachEqualNullActual(void);
+void testNotEqualIntEachEqual1(void);
+void testNotEqualIntEachEqual2(void);
+void testNotEqualIntEachEqual3(void);
+void testNotEqualEachEqualLengthZero(void);
+void testEqualPtrArrays(void);
+void testNotEqualPtrArraysNullExpected(void);
+void testNotEqualPtrArraysNullActual(void);
+void testNotEqualPtrArrays1(void);
+void testNotEqualPtrArrays2(void);
+void testNotEqualPtrArrays3(void);
+void testEqualPtrEachEqual(void);
+void testNotEqualPtrEachEqualNullExpected(void);
+void testNotEqualPtrEachEqualNullActual(void);
+void testNotEqualPtrEachEqual1(void);
+void testNotEqualPtrEachEqual2(void);
+void testNotEqualPtrEachEqual3(void);
+void testEqualInt8Arrays(void);
+void testNotEqualInt8Arrays(void);
+void testEqualInt8EachEqual(void);
+void testNotEqualInt8EachEqual(void);
+void testEqualUIntArrays(void);
+void testNotEqualUIntArrays1(void);
+void testNotEqualUIntArrays2(void);
+void testNotEqualUIntArrays3(void);
+void testEqualUIntEachEqual(void);
+void testNotEqualUIntEachEqual1(void);
+void testNotEqualUIntEachEqual2(void);
+void testNotEqualUIntEachEqual3(void);
+void testEqualInt16Arrays(void);
+void testNotEqualInt16Arrays(void);
+void testEqualInt16EachEqual(void);
+void testNotEqualInt16EachEqual(void);
+void testEqualInt32Arrays(void);
+void testNotEqualInt32Arrays(void);
+void testEqualInt32EachEqual(void);
+void testNotEqualInt32EachEqual(void);
+void testEqualUINT8Arrays(void);
+void testNotEqualUINT8Arrays1(void);
+void testNotEqualUINT8Arrays2(void);
+void testNotEqualUINT8Arrays3(void);
+void testEqualUINT16Arrays(void);
+void testNotEqualUINT16Arrays1(void);
+void testNotEqualUINT16Arrays2(void);
+void testNotEqualUINT16Arrays3(void);
+void testEqualUINT32Arrays(void);
+void testNotEqualUINT32Arrays1(void);
+void testNotEqualUINT32Arrays2(void);
+void testNotEqualUINT32Arrays3(void);
+void testEqualHEXArrays(void);
+void testNotEqualHEXArrays1(void);
+void testNotEqualHEXArrays2(void);
+void testNotEqualHEXArrays3(void);
+void testEqualHEX32Arrays(void);
+void testNotEqualHEX32Arrays1(void);
+void testNotEqualHEX32Arrays2(void);
+void testNotEqualHEX32Arrays3(void);
+void testEqualHEX16Arrays(void);
+void testNotEqualHEX16Arrays1(void);
+void testNotEqualHEX16Arrays2(void);
+void testNotEqualHEX16Arrays3(void);
+void testEqualHEX8Arrays(void);
+void testNotEqualHEX8Arrays1(void);
+void testNotEqualHEX8Arrays2(void);
+void testNotEqualHEX8Arrays3(void);
+void testEqualUINT8EachEqual(void);
+void testNotEqualUINT8EachEqual1(void);
+void testNotEqualUINT8EachEqual2(void);
+void testNotEqualUINT8EachEqual3(void);
+void testEqualUINT16EachEqual(void);
+void testNotEqualUINT16EachEqual1(void);
+void testNotEqualUINT16EachEqual2(void);
+void testNotEqualUINT16EachEqual3(void);
+void testEqualUINT32EachEqual(void);
+void testNotEqualUINT32EachEqual1(void);
+void testNotEqualUINT32EachEqual2(void);
+void testNotEqualUINT32EachEqual3(void);
+void testEqualHEXEachEqual(void);
+void testNotEqualHEXEachEqual1(void);
+void testNotEqualHEXEachEqual2(void);
+void testNotEqualHEXEachEqual3(void);
+void testEqualHEX32EachEqual(void);
+void testNotEqualHEX32EachEqual1(void);
+void testNotEqualHEX32EachEqual2(void);
+void testNotEqualHEX32EachEqual3(void);
+void testEqualHEX16EachEqual(void);
+void testNotEqualHEX16EachEqual1(void);
+void testNotEqualHEX16EachEqual2(void);
+void testNotEqualHEX16EachEqual3(void);
+void testEqualHEX8EachEqual(void);
+void testNotEqualHEX8EachEqual1(void);
+void testNotEqualHEX8EachEqual2(void);
+void testNotEqualHEX8EachEqual3(void);
+void testEqualMemoryArrays(void);
+void testNotEqualMemoryArraysExpectedNull(void);
+void testNotEqualMemoryArraysActualNull(void);
+void testNotEqualMemoryArrays1(void);
+void testNotEqualMemoryArrays2(void);
+void testNotEqualMemoryArrays3(void);
+void testEqualMemoryEachEqual(void);
+void testNotEqualMemoryEachEqualExpectedNull(void);
+void testNotEqualMemoryEachEqualActualNull(void);
+void testNotEqualMemoryEachEqual1(void);
+void testNotEqualMemoryEachEqual2(void);
+void testNotEqualMemoryEachEqual3(void);
+void testProtection(void);
+void testIgnoredAndThenFailInTearDown(void);
+void testFailureCountIncrementsAndIsReturnedAtEnd(void);
+void testAggregatedRunCombinesCountsOfEachTestFile(void);
+void testParamsRunEveryEntryAndReportFailingOnes(void);
+void testParamsNameFailingEntriesWithTheirLabel(void);
+void testParamsIgnoreTheTestWhenEveryEntryIsIgnored(void);
+void testParamsCountAsOneTest(void);
+void testCombinationsRunEveryCombinationOfRangesAndValues(void);
+void testCombinationsOfAnEmptyAxisAreIgnored(void);
+void testCombinationsWithTooManyPairsFail(void);
+void testCombinationsPairwiseCoverEveryPairInFewerCases(void);
+void testBenchSummarizeFindsMedianMinimumAndDeviation(void);
+void testBenchSummarizeEstimatesNoise(void);
+void testBenchMedianIntervalHoldsTheConfidenceLevel(void);
+void testBigOFitFindsTheComplexityOfTimes(void);
+void testBenchmarkCalibratesAndReportsItsLoop(void);
+void testBenchmarkWithoutLoopFails(void);
+void testBenchmarkABCannotBeHundredPercentFaster(void);
+void testBenchmarksAreIgnoredWhenDisabled(void);
+void testHistogramFindsPercentiles(void);
+void testHistogramCountsSmallValuesExactly(void);
+void testHistogramHoldsTheLargestValues(void);
+void testPercentileBelowPasses(void);
+void testPercentileBelowFailsInTheTail(void);
+void testPercentileBelowFailsWithoutSamples(void);
+void testPercentileFailureNamesThePercentile(void);
+void testHistogramIsPrinted(void);
+void testExecTimeIsPrintedInAdaptiveUnits(void);
+void testCstringsEscapeSequence(void);
+void testHexPrintsUpToMaxNumberOfNibbles(void);
+void testPrintNumbers32(void);
+void testPrintNumbersUnsigned32(void);
+void testPrintNumbersInt64(void);
+void testPrintNumbersUInt64(void);
+void testEqualHex64s(void);
+void testEqualUint64s(void);
+void testEqualInt64s(void);
+void testNotEqualHex64s(void);
+void testNotEqualUint64s(void);
+void testNotEqualInt64s(void);
+void testNotEqualHex64sIfSigned(void);
+void testHEX64sWithinDelta(void);
+void testHEX64sNotWithinDelta(void);
+void testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testUINT64sWithinDelta(void);
+void testUINT64sNotWithinDelta(void);
+void testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+void testINT64sWithinDelta(void);
+void testINT64sNotWithinDelta(void);
+void testINT64sNotWithinDeltaAndDifferenceOverflows(void);
+void testEqualHEX64Arrays(void);
+void testEqualUint64Arrays(void);
+void testEqualInt64Arrays(void);
+void testNotEqualHEX64Arrays1(void);
+void testNotEqualHEX64Arrays2(void);
+void testNotEqualUint64Arrays(void);
+void testNotEqualInt64Arrays(void);
+void testFloatsWithinDelta(void);
+void testFloatsNotWithinDelta(void);
+void testFloatsEqual(void);
+void testFloatsNotEqual(void);
+void testFloatsNotEqualNegative1(void);
+void testFloatsNotEqualNegative2(void);
+void testFloatsNotEqualActualNaN(void);
+void testFloatsNotEqualExpectedNaN(void);
+void testFloatsEqualBothNaN(void);
+void testFloatsNotEqualInfNaN(void);
+void testFloatsNotEqualNaNInf(void);
+void testFloatsNotEqualActualInf(void);
+void testFloatsNotEqualExpectedInf(void);
+void testFloatsEqualBothInf(void);
+void testFloatsNotEqualPlusMinusInf(void);
+void testFloatIsPosInf1(void);
+void testFloatIsPosInf2(void);
+void testFloatIsNegInf1(void);
+void testFloatIsNegInf2(void);
+void testFloatIsNotPosInf1(void);
+void testFloatIsNotPosInf2(void);
+void testFloatIsNotNegInf(void);
+void testFloatIsNan1(void);
+void testFloatIsNan2(void);
+void testFloatIsNotNan1(void);
+void testFloatIsNotNan2(void);
+void testFloatInfIsNotNan(void);
+void testFloatNanIsNotInf(void);
+void testFloatIsDeterminate1(void);
+void testFloatIsDeterminate2(void);
+void testFloatIsNotDeterminate1(void);
+void testFloatIsNotDeterminate2(void);
+void testFloatTraitFailsOnInvalidTrait(void);
+void testEqualFloatArrays(void);
+void testNotEqualFloatArraysExpectedNull(void);
+void testNotEqualFloatArraysActualNull(void);
+void testNotEqualFloatArrays1(void);
+void testNotEqualFloatArrays2(void);
+void testNotEqualFloatArrays3(void);
+void testNotEqualFloatArraysNegative1(void);
+void testNotEqualFloatArraysNegative2(void);
+void testNotEqualFloatArraysNegative3(void);
+void testEqualFloatArraysNaN(void);
+void testEqualFloatArraysInf(void);
+void testNotEqualFloatArraysLengthZero(void);
+void testEqualFloatEachEqual(void);
+void testNotEqualFloatEachEqualActualNull(void);
+void testNotEqualFloatEachEqual1(void);
+void testNotEqualFloatEachEqual2(void);
+void testNotEqualFloatEachEqual3(void);
+void testNotEqualFloatEachEqualNegative1(void);
+void testNotEqualFloatEachEqualNegative2(void);
+void testNotEqualFloatEachEqualNegative3(void);
+void testEqualFloatEachEqualNaN(void);
+void testEqualFloatEachEqualInf(void);
+void testNotEqualFloatEachEqualLengthZero(void);
+void testFloatPrinting(void);
+void testFloatPrintingRoundTiesToEven(void);
+void testFloatPrintingInfinityAndNaN(void);
+void testFloatPrintingRandomSamples(void);
+void testDoublesWithinDelta(void);
+void testDoublesNotWithinDelta(void);
+void testDoublesEqual(void);
+void testDoublesNotEqual(void);
+void testDoublesNotEqualNegative1(void);
+void testDoublesNotEqualNegative2(void);
+void testDoublesNotEqualActualNaN(void);
+void testDoublesNotEqualExpectedNaN(void);
+void testDoublesEqualBothNaN(void);
+void testDoublesNotEqualInfNaN(void);
+void testDoublesNotEqualNaNInf(void);
+void testDoublesNotEqualActualInf(void);
+void testDoublesNotEqualExpectedInf(void);
+void testDoublesEqualBothInf(void);
+void testDoublesNotEqualPlusMinusInf(void);
+void testDoubleIsPosInf1(void);
+void testDoubleIsPosInf2(void);
+void testDoubleIsNegInf1(void);
+void testDoubleIsNegInf2(void);
+void testDoubleIsNotPosInf1(void);
+void testDoubleIsNotPosInf2(void);
+void testDoubleIsNotNegInf(void);
+void testDoubleIsNan1(void);
+void testDoubleIsNan2(void);
+void testDoubleIsNotNan1(void);
+void testDoubleIsNotNan2(void);
+void testDoubleInfIsNotNan(void);
+void testDoubleNanIsNotInf(void);
+void testDoubleIsDeterminate1(void);
+void testDoubleIsDeterminate2(void);
+void testDoubleIsNotDeterminate1(void);
+void testDoubleIsNotDeterminate2(void);
+void testDoubleTraitFailsOnInvalidTrait(void);
+void testEqualDoubleArrays(void);
+void testNotEqualDoubleArraysExpectedNull(void);
+void testNotEqualDoubleArraysActualNull(void);
+void testNotEqualDoubleArrays1(void);
+void testNotEqualDoubleArrays2(void);
+void testNotEqualDoubleArrays3(void);
+void testNotEqualDoubleArraysNegative1(void);
+void testNotEqualDoubleArraysNegative2(void);
+void testNotEqualDoubleArraysNegative3(void);
+void testEqualDoubleArraysNaN(void);
+void testEqualDoubleArraysInf(void);
+void testNotEqualDoubleArraysLengthZero(void);
+void testEqualDoubleEachEqual(void);
+void testNotEqualDoubleEachEqualActualNull(void);
+void testNotEqualDoubleEachEqual1(void);
+void testNotEqualDoubleEachEqual2(void);
+void testNotEqualDoubleEachEqual3(void);
+void testNotEqualDoubleEachEqualNegative1(void);
+void testNotEqualDoubleEachEqualNegative2(void);
+void testNotEqualDoubleEachEqualNegative3(void);
+void testEqualDoubleEachEqualNaN(void);
+void testEqualDoubleEachEqualInf(void);
+void testNotEqualDoubleEachEqualLengthZero(void);
+void testDoublePrinting(void);
+void testDoublePrintingRoundTiesToEven(void);
+void testDoublePrintingInfinityAndNaN(void);
+void testThatDetailsCanBeHandleOneDetail(void);
+void testThatDetailsCanHandleTestFail(void);
+void testThatDetailsCanBeHandleTwoDetails(void);
+void testThatDetailsCanBeHandleSingleDetailClearingTwoDetails(void);
+int main(void)
+{
+    HuntBegin("tests/testhunt.c");
+    RUN_TEST(testHuntSizeInitializationReminder, 86);
+    RUN_TEST(testPassShouldEndImmediatelyWithPass, 144);
+    RUN_TEST(testPassShouldEndImmediatelyWithPassAndMessage, 150);
+    RUN_TEST(testMessageShouldDisplayMessageWithoutEndingAndGoOnToPass, 156);
+    RUN_TEST(testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail, 163);
+    RUN_TEST(testTrue, 172);
+    RUN_TEST(testFalse, 179);
+    RUN_TEST(testPreviousPass, 186);
+    RUN_TEST(testNotVanilla, 191);
+    RUN_TEST(testNotTrue, 198);
+    RUN_TEST(testNotFalse, 205);
+    RUN_TEST(testNotUnless, 212);
+    RUN_TEST(testNotNotEqual, 219);
+    RUN_TEST(testFail, 226);
+    RUN_TEST(testIsNull, 233);
+    RUN_TEST(testIsNullShouldFailIfNot, 242);
+    RUN_TEST(testNotNullShouldFailIfNULL, 251);
+    RUN_TEST(testIgnore, 260);
+    RUN_TEST(testIgnoreMessage, 268);
+    RUN_TEST(testNotEqualInts, 276);
+    RUN_TEST(testNotEqualInt8s, 283);
+    RUN_TEST(testNotEqualInt16s, 290);
+    RUN_TEST(testNotEqualInt32s, 297);
+    RUN_TEST(testNotEqualBits, 304);
+    RUN_TEST(testNotEqualUInts, 311);
+    RUN_TEST(testNotEqualUInt8s, 323);
+    RUN_TEST(testNotEqualUInt16s, 335);
+    RUN_TEST(testNotEqualUInt32s, 347);
+    RUN_TEST(testNotEqualHex8s, 359);
+    RUN_TEST(testNotEqualHex8sIfSigned, 371);
+    RUN_TEST(testNotEqualHex16s, 383);
+    RUN_TEST(testNotEqualHex16sIfSigned, 395);
+    RUN_TEST(testNotEqualHex32s, 407);
+    RUN_TEST(testNotEqualHex32sIfSigned, 419);
+    RUN_TEST(testEqualInts, 431);
+    RUN_TEST(testEqualInt8s, 451);
+    RUN_TEST(testEqualInt8sWhenThereAreDifferencesOutside8Bits, 470);
+    RUN_TEST(testEqualInt16s, 476);
+    RUN_TEST(testEqualInt16sNegatives, 495);
+    RUN_TEST(testEqualInt16sWhenThereAreDifferencesOutside16Bits, 514);
+    RUN_TEST(testEqualInt32s, 520);
+    RUN_TEST(testEqualInt32sNegatives, 539);
+    RUN_TEST(testEqualUints, 559);
+    RUN_TEST(testEqualUint8s, 580);
+    RUN_TEST(testEqualUint8sWhenThereAreDifferencesOutside8Bits, 599);
+    RUN_TEST(testEqualUint16s, 605);
+    RUN_TEST(testEqualUint16sWhenThereAreDifferencesOutside16Bits, 624);
+    RUN_TEST(testEqualUint32s, 630);
+    RUN_TEST(testNotEqual, 649);
+    RUN_TEST(testEqualHex8s, 660);
+    RUN_TEST(testEqualHex8sWhenThereAreDifferencesOutside8Bits, 679);
+    RUN_TEST(testEqualHex8sNegatives, 685);
+    RUN_TEST(testEqualHex16s, 704);
+    RUN_TEST(testEqualHex16sWhenThereAreDifferencesOutside16Bits, 723);
+    RUN_TEST(testEqualHex32s, 729);
+    RUN_TEST(testEqualBits, 748);
+    RUN_TEST(testNotEqualBitHigh, 764);
+    RUN_TEST(testNotEqualBitLow, 773);
+    RUN_TEST(testNotEqualBitsHigh, 782);
+    RUN_TEST(testNotEqualBitsLow, 793);
+    RUN_TEST(testEqualShorts, 804);
+    RUN_TEST(testEqualUShorts, 824);
+    RUN_TEST(testEqualChars, 844);
+    RUN_TEST(testEqualUChars, 864);
+    RUN_TEST(testEqualPointers, 883);
+    RUN_TEST(testNotEqualPointers, 900);
+    RUN_TEST(testIntsWithinDelta, 907);
+    RUN_TEST(testIntsWithinDeltaAndCustomMessage, 919);
+    RUN_TEST(testIntsNotWithinDelta, 931);
+    RUN_TEST(testIntsNotWithinDeltaAndCustomMessage, 938);
+    RUN_TEST(testUIntsWithinDelta, 945);
+    RUN_TEST(testUIntsWithinDeltaAndCustomMessage, 952);
+    RUN_TEST(testUIntsNotWithinDelta, 959);
+    RUN_TEST(testUIntsNotWithinDeltaAndCustomMessage, 966);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst, 973);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage, 980);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst, 987);
+    RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage, 994);
+    RUN_TEST(testHEX32sWithinDelta, 1001);
+    RUN_TEST(testHEX32sWithinDeltaAndCustomMessage, 1008);
+    RUN_TEST(testHEX32sNotWithinDelta, 1015);
+    RUN_TEST(testHEX32sNotWithinDeltaAndCustomMessage, 1022);
+    RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass, 1029);
+    RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 1036);
+    RUN_TEST(testHEX16sWithinDelta, 1043);
+    RUN_TEST(testHEX16sWithinDeltaAndCustomMessage, 1050);
+    RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1057);
+    RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1062);
+    RUN_TEST(testHEX16sNotWithinDelta, 1067);
+    RUN_TEST(testHEX16sNotWithinDeltaAndCustomMessage, 1074);
+    RUN_TEST(testHEX8sWithinDelta, 1081);
+    RUN_TEST(testHEX8sWithinDeltaAndCustomMessage, 1088);
+    RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1095);
+    RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1100);
+    RUN_TEST(testHEX8sNotWithinDelta, 1105);
+    RUN_TEST(testHEX8sNotWithinDeltaAndCustomMessage, 1112);
+    RUN_TEST(testUINT32sWithinDelta, 1121);
+    RUN_TEST(testUINT32sWithinDeltaAndCustomMessage, 1128);
+    RUN_TEST(testUINT32sNotWithinDelta, 1135);
+    RUN_TEST(testUINT32sNotWithinDeltaAndCustomMessage, 1142);
+    RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass, 1149);
+    RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 1156);
+    RUN_TEST(testUINT16sWithinDelta, 1163);
+    RUN_TEST(testUINT16sWithinDeltaAndCustomMessage, 1170);
+    RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1177);
+    RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1182);
+    RUN_TEST(testUINT16sNotWithinDelta, 1187);
+    RUN_TEST(testUINT16sNotWithinDeltaAndCustomMessage, 1194);
+    RUN_TEST(testUINT8sWithinDelta, 1201);
+    RUN_TEST(testUINT8sWithinDeltaAndCustomMessage, 1208);
+    RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1215);
+    RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1220);
+    RUN_TEST(testUINT8sNotWithinDelta, 1225);
+    RUN_TEST(testUINT8sNotWithinDeltaAndCustomMessage, 1232);
+    RUN_TEST(testINT32sWithinDelta, 1239);
+    RUN_TEST(testINT32sWithinDeltaAndCustomMessage, 1246);
+    RUN_TEST(testINT32sNotWithinDelta, 1251);
+    RUN_TEST(testINT32sNotWithinDeltaAndDifferenceOverflows, 1258);
+    RUN_TEST(testINT32sNotWithinDeltaAndCustomMessage, 1264);
+    RUN_TEST(testINT16sWithinDelta, 1271);
+    RUN_TEST(testINT16sWithinDeltaAndCustomMessage, 1278);
+    RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1283);
+    RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1288);
+    RUN_TEST(testINT16sNotWithinDelta, 1293);
+    RUN_TEST(testINT16sNotWithinDeltaAndCustomMessage, 1300);
+    RUN_TEST(testINT8sWithinDelta, 1307);
+    RUN_TEST(testINT8sWithinDeltaAndCustomMessage, 1314);
+    RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1319);
+    RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1324);
+    RUN_TEST(testINT8sNotWithinDelta, 1329);
+    RUN_TEST(testINT8sNotWithinDeltaAndCustomMessage, 1336);
+    RUN_TEST(testInt64ArrayWithinDelta, 1345);
+    RUN_TEST(testInt64ArrayWithinDeltaAndMessage, 1359);
+    RUN_TEST(testInt64ArrayNotWithinDeltaAndMessage, 1387);
+    RUN_TEST(testInt64ArrayWithinDeltaPointless, 1401);
+    RUN_TEST(testInt64ArrayWithinDeltaPointlessAndMessage, 1415);
+    RUN_TEST(testInt64ArrayWithinDeltaExpectedNull, 1429);
+    RUN_TEST(testInt64ArrayWithinDeltaExpectedNullAndMessage, 1442);
+    RUN_TEST(testInt64ArrayWithinDeltaActualNull, 1455);
+    RUN_TEST(testInt64ArrayWithinDeltaActualNullAndMessage, 1468);
+    RUN_TEST(testInt64ArrayWithinDeltaSamePointer, 1481);
+    RUN_TEST(testInt64ArrayWithinDeltaSamePointerAndMessage, 1492);
+    RUN_TEST(testIntArrayWithinDelta, 1503);
+    RUN_TEST(testIntArrayWithinDeltaAndMessage, 1513);
+    RUN_TEST(testIntArrayNotWithinDelta, 1523);
+    RUN_TEST(testIntArrayNotWithinDeltaAndMessage, 1533);
+    RUN_TEST(testIntArrayWithinDeltaPointless, 1543);
+    RUN_TEST(testIntArrayWithinDeltaPointlessAndMessage, 1553);
+    RUN_TEST(testIntArrayWithinDeltaExpectedNull, 1563);
+    RUN_TEST(testIntArrayWithinDeltaExpectedNullAndMessage, 1572);
+    RUN_TEST(testIntArrayWithinDeltaActualNull, 1581);
+    RUN_TEST(testIntArrayWithinDeltaActualNullAndMessage, 1590);
+    RUN_TEST(testIntArrayWithinDeltaSamePointer, 1599);
+    RUN_TEST(testIntArrayWithinDeltaSamePointerAndMessage, 1606);
+    RUN_TEST(testInt16ArrayWithinDelta, 1613);
+    RUN_TEST(testInt16ArrayWithinDeltaAndMessage, 1623);
+    RUN_TEST(testInt16ArrayNotWithinDelta, 1633);
+    RUN_TEST(testInt16ArrayNotWithinDeltaAndMessage, 1643);
+    RUN_TEST(testInt16ArrayWithinDeltaPointless, 1653);
+    RUN_TEST(testInt16ArrayWithinDeltaPointlessAndMessage, 1663);
+    RUN_TEST(testInt16ArrayWithinDeltaExpectedNull, 1673);
+    RUN_TEST(testInt16ArrayWithinDeltaExpectedNullAndMessage, 1682);
+    RUN_TEST(testInt16ArrayWithinDeltaActualNull, 1691);
+    RUN_TEST(testInt16ArrayWithinDeltaActualNullAndMessage, 1700);
+    RUN_TEST(testInt16ArrayWithinDeltaSamePointer, 1709);
+    RUN_TEST(testInt16ArrayWithinDeltaSamePointerAndMessage, 1716);
+    RUN_TEST(testInt8ArrayWithinDelta, 1723);
+    RUN_TEST(testInt8ArrayWithinDeltaAndMessage, 1733);
+    RUN_TEST(testInt8ArrayNotWithinDelta, 1743);
+    RUN_TEST(testInt8ArrayNotWithinDeltaAndMessage, 1753);
+    RUN_TEST(testInt8ArrayWithinDeltaPointless, 1763);
+    RUN_TEST(testInt8ArrayWithinDeltaPointlessAndMessage, 1773);
+    RUN_TEST(testInt8ArrayWithinDeltaExpectedNull, 1783);
+    RUN_TEST(testInt8ArrayWithinDeltaExpectedNullAndMessage, 1792);
+    RUN_TEST(testInt8ArrayWithinDeltaActualNull, 1801);
+    RUN_TEST(testInt8ArrayWithinDeltaActualNullAndMessage, 1810);
+    RUN_TEST(testInt8ArrayWithinDeltaSamePointer, 1819);
+    RUN_TEST(testInt8ArrayWithinDeltaSamePointerAndMessage, 1826);
+    RUN_TEST(testUInt64ArrayWithinDelta, 1833);
+    RUN_TEST(testUInt64ArrayWithinDeltaAndMessage, 1847);
+    RUN_TEST(testUInt64ArrayNotWithinDelta, 1861);
+    RUN_TEST(testUInt64ArrayNotWithinDeltaAndMessage, 1875);
+    RUN_TEST(testUInt64ArrayWithinDeltaPointless, 1889);
+    RUN_TEST(testUInt64ArrayWithinDeltaPointlessAndMessage, 1903);
+    RUN_TEST(testUInt64ArrayWithinDeltaExpectedNull, 1917);
+    RUN_TEST(testUInt64ArrayWithinDeltaExpectedNullAndMessage, 1930);
+    RUN_TEST(testUInt64ArrayWithinDeltaActualNull, 1943);
+    RUN_TEST(testUInt64ArrayWithinDeltaActualNullAndMessage, 1956);
+    RUN_TEST(testUInt64ArrayWithinDeltaSamePointer, 1969);
+    RUN_TEST(testUInt64ArrayWithinDeltaSamePointerAndMessage, 1980);
+    RUN_TEST(testUIntArrayWithinDelta, 1991);
+    RUN_TEST(testUIntArrayWithinDeltaAndMessage, 2001);
+    RUN_TEST(testUIntArrayNotWithinDelta, 2011);
+    RUN_TEST(testUIntArrayNotWithinDeltaAndMessage, 2021);
+    RUN_TEST(testUIntArrayWithinDeltaPointless, 2031);
+    RUN_TEST(testUIntArrayWithinDeltaPointlessAndMessage, 2041);
+    RUN_TEST(testUIntArrayWithinDeltaExpectedNull, 2051);
+    RUN_TEST(testUIntArrayWithinDeltaExpectedNullAndMessage, 2060);
+    RUN_TEST(testUIntArrayWithinDeltaActualNull, 2069);
+    RUN_TEST(testUIntArrayWithinDeltaActualNullAndMessage, 2078);
+    RUN_TEST(testUIntArrayWithinDeltaSamePointer, 2087);
+    RUN_TEST(testUIntArrayWithinDeltaSamePointerAndMessage, 2094);
+    RUN_TEST(testUInt16ArrayWithinDelta, 2101);
+    RUN_TEST(testUInt16ArrayWithinDeltaAndMessage, 2111);
+    RUN_TEST(testUInt16ArrayNotWithinDelta, 2121);
+    RUN_TEST(testUInt16ArrayNotWithinDeltaAndMessage, 2131);
+    RUN_TEST(testUInt16ArrayWithinDeltaPointless, 2141);
+    RUN_TEST(testUInt16ArrayWithinDeltaPointlessAndMessage, 2151);
+    RUN_TEST(testUInt16ArrayWithinDeltaExpectedNull, 2161);
+    RUN_TEST(testUInt16ArrayWithinDeltaExpectedNullAndMessage, 2170);
+    RUN_TEST(testUInt16ArrayWithinDeltaActualNull, 2179);
+    RUN_TEST(testUInt16ArrayWithinDeltaActualNullAndMessage, 2188);
+    RUN_TEST(testUInt16ArrayWithinDeltaSamePointer, 2197);
+    RUN_TEST(testUInt16ArrayWithinDeltaSamePointerAndMessage, 2204);
+    RUN_TEST(testUInt8ArrayWithinDelta, 2211);
+    RUN_TEST(testUInt8ArrayWithinDeltaAndMessage, 2221);
+    RUN_TEST(testUInt8ArrayNotWithinDelta, 2231);
+    RUN_TEST(testUInt8ArrayNotWithinDeltaAndMessage, 2241);
+    RUN_TEST(testUInt8ArrayWithinDeltaPointless, 2251);
+    RUN_TEST(testUInt8ArrayWithinDeltaPointlessAndMessage, 2261);
+    RUN_TEST(testUInt8ArrayWithinDeltaExpectedNull, 2271);
+    RUN_TEST(testUInt8ArrayWithinDeltaExpectedNullAndMessage, 2280);
+    RUN_TEST(testUInt8ArrayWithinDeltaActualNull, 2289);
+    RUN_TEST(testUInt8ArrayWithinDeltaActualNullAndMessage, 2298);
+    RUN_TEST(testUInt8ArrayWithinDeltaSamePointer, 2307);
+    RUN_TEST(testUInt8ArrayWithinDeltaSamePointerAndMessage, 2314);
+    RUN_TEST(testHEX64ArrayWithinDelta, 2321);
+    RUN_TEST(testHEX64ArrayWithinDeltaAndMessage, 2335);
+    RUN_TEST(testHEX64ArrayNotWithinDelta, 2349);
+    RUN_TEST(testHEX64ArrayNotWithinDeltaAndMessage, 2363);
+    RUN_TEST(testHEX64ArrayWithinDeltaPointless, 2377);
+    RUN_TEST(testHEX64ArrayWithinDeltaPointlessAndMessage, 2391);
+    RUN_TEST(testHEX64ArrayWithinDeltaExpectedNull, 2405);
+    RUN_TEST(testHEX64ArrayWithinDeltaExpectedNullAndMessage, 2418);
+    RUN_TEST(testHEX64ArrayWithinDeltaActualNull, 2431);
+    RUN_TEST(testHEX64ArrayWithinDeltaActualNullAndMessage, 2444);
+    RUN_TEST(testHEX64ArrayWithinDeltaSamePointer, 2457);
+    RUN_TEST(testHEX64ArrayWithinDeltaSamePointerAndMessage, 2468);
+    RUN_TEST(testHEX32ArrayWithinDelta, 2479);
+    RUN_TEST(testHEX32ArrayWithinDeltaAndMessage, 2489);
+    RUN_TEST(testHEX32ArrayNotWithinDelta, 2499);
+    RUN_TEST(testHEX32ArrayNotWithinDeltaAndMessage, 2509);
+    RUN_TEST(testHEX32ArrayWithinDeltaPointless, 2519);
+    RUN_TEST(testHEX32ArrayWithinDeltaPointlessAndMessage, 2529);
+    RUN_TEST(testHEX32ArrayWithinDeltaExpectedNull, 2539);
+    RUN_TEST(testHEX32ArrayWithinDeltaExpectedNullAndMessage, 2548);
+    RUN_TEST(testHEX32ArrayWithinDeltaActualNull, 2557);
+    RUN_TEST(testHEX32ArrayWithinDeltaActualNullAndMessage, 2566);
+    RUN_TEST(testHEX32ArrayWithinDeltaSamePointer, 2575);
+    RUN_TEST(testHEX32ArrayWithinDeltaSamePointerAndMessage, 2582);
+    RUN_TEST(testHEX16ArrayWithinDelta, 2590);
+    RUN_TEST(testHEX16ArrayWithinDeltaAndMessage, 2600);
+    RUN_TEST(testHEX16ArrayNotWithinDelta, 2610);
+    RUN_TEST(testHEX16ArrayNotWithinDeltaAndMessage, 2620);
+    RUN_TEST(testHEX16ArrayWithinDeltaPointless, 2630);
+    RUN_TEST(testHEX16ArrayWithinDeltaPointlessAndMessage, 2640);
+    RUN_TEST(testHEX16ArrayWithinDeltaExpectedNull, 2650);
+    RUN_TEST(testHEX16ArrayWithinDeltaExpectedNullAndMessage, 2659);
+    RUN_TEST(testHEX16ArrayWithinDeltaActualNull, 2668);
+    RUN_TEST(testHEX16ArrayWithinDeltaActualNullAndMessage, 2677);
+    RUN_TEST(testHEX16ArrayWithinDeltaSamePointer, 2686);
+    RUN_TEST(testHEX16ArrayWithinDeltaSamePointerAndMessage, 2693);
+    RUN_TEST(testHEX8ArrayWithinDelta, 2700);
+    RUN_TEST(testHEX8ArrayWithinDeltaAndMessage, 2710);
+    RUN_TEST(testHEX8ArrayNotWithinDelta, 2720);
+    RUN_TEST(testHEX8ArrayNotWithinDeltaAndMessage, 2730);
+    RUN_TEST(testHEX8ArrayWithinDeltaPointless, 2740);
+    RUN_TEST(testHEX8ArrayWithinDeltaPointlessAndMessage, 2750);
+    RUN_TEST(testHEX8ArrayWithinDeltaExpectedNull, 2760);
+    RUN_TEST(testHEX8ArrayWithinDeltaExpectedNullAndMessage, 2769);
+    RUN_TEST(testHEX8ArrayWithinDeltaActualNull, 2778);
+    RUN_TEST(testHEX8ArrayWithinDeltaActualNullAndMessage, 2787);
+    RUN_TEST(testHEX8ArrayWithinDeltaSamePointer, 2796);
+    RUN_TEST(testHEX8ArrayWithinDeltaSamePointerAndMessage, 2803);
+    RUN_TEST(testGreaterThan, 2812);
+    RUN_TEST(testNotGreaterThan, 2828);
+    RUN_TEST(testGreaterThanINT, 2835);
+    RUN_TEST(testNotGreaterThanINT, 2851);
+    RUN_TEST(testGreaterThanINT8, 2858);
+    RUN_TEST(testNotGreaterThanINT8, 2874);
+    RUN_TEST(testGreaterThanINT16, 2881);
+    RUN_TEST(testNotGreaterThanINT16, 2897);
+    RUN_TEST(testGreaterThanINT32, 2904);
+    RUN_TEST(testNotGreaterThanINT32, 2920);
+    RUN_TEST(testGreaterThanUINT, 2927);
+    RUN_TEST(testNotGreaterThanUINT, 2943);
+    RUN_TEST(testGreaterThanUINT8, 2950);
+    RUN_TEST(testNotGreaterThanUINT8, 2966);
+    RUN_TEST(testGreaterThanUINT16, 2973);
+    RUN_TEST(testNotGreaterThanUINT16, 2989);
+    RUN_TEST(testGreaterThanUINT32, 2996);
+    RUN_TEST(testNotGreaterThanUINT32, 3012);
+    RUN_TEST(testGreaterThanHEX8, 3019);
+    RUN_TEST(testNotGreaterThanHEX8, 3035);
+    RUN_TEST(testGreaterThanHEX16, 3042);
+    RUN_TEST(testNotGreaterThanHEX16, 3058);
+    RUN_TEST(testGreaterThanHEX32, 3065);
+    RUN_TEST(testNotGreaterThanHEX32, 3081);
+    RUN_TEST(testGreaterOrEqual, 3088);
+    RUN_TEST(testNotGreaterOrEqual, 3110);
+    RUN_TEST(testGreaterOrEqualINT, 3117);
+    RUN_TEST(testNotGreaterOrEqualINT, 3139);
+    RUN_TEST(testGreaterOrEqualINT8, 3146);
+    RUN_TEST(testNotGreaterOrEqualINT8, 3168);
+    RUN_TEST(testGreaterOrEqualINT16, 3175);
+    RUN_TEST(testNotGreaterOrEqualINT16, 3197);
+    RUN_TEST(testGreaterOrEqualINT32, 3204);
+    RUN_TEST(testNotGreaterOrEqualINT32, 3226);
+    RUN_TEST(testGreaterOrEqualUINT, 3233);
+    RUN_TEST(testNotGreaterOrEqualUINT, 3255);
+    RUN_TEST(testGreaterOrEqualUINT8, 3262);
+    RUN_TEST(testNotGreaterOrEqualUINT8, 3284);
+    RUN_TEST(testGreaterOrEqualUINT16, 3291);
+    RUN_TEST(testNotGreaterOrEqualUINT16, 3313);
+    RUN_TEST(testGreaterOrEqualUINT32, 3320);
+    RUN_TEST(testNotGreaterOrEqualUINT32, 3342);
+    RUN_TEST(testGreaterOrEqualHEX8, 3349);
+    RUN_TEST(testNotGreaterOrEqualHEX8, 3371);
+    RUN_TEST(testGreaterOrEqualHEX16, 3378);
+    RUN_TEST(testNotGreaterOrEqualHEX16, 3400);
+    RUN_TEST(testGreaterOrEqualHEX32, 3407);
+    RUN_TEST(testNotGreaterOrEqualHEX32, 3429);
+    RUN_TEST(testLessThan, 3439);
+    RUN_TEST(testNotLessThan, 3455);
+    RUN_TEST(testLessThanINT, 3462);
+    RUN_TEST(testNotLessThanINT, 3478);
+    RUN_TEST(testLessThanINT8, 3485);
+    RUN_TEST(testNotLessThanINT8, 3501);
+    RUN_TEST(testLessThanINT16, 3508);
+    RUN_TEST(testNotLessThanINT16, 3524);
+    RUN_TEST(testLessThanINT32, 3531);
+    RUN_TEST(testNotLessThanINT32, 3547);
+    RUN_TEST(testLessThanUINT, 3554);
+    RUN_TEST(testNotLessThanUINT, 3570);
+    RUN_TEST(testLessThanUINT8, 3577);
+    RUN_TEST(testNotLessThanUINT8, 3593);
+    RUN_TEST(testLessThanUINT16, 3600);
+    RUN_TEST(testNotLessThanUINT16, 3616);
+    RUN_TEST(testLessThanUINT32, 3623);
+    RUN_TEST(testNotLessThanUINT32, 3639);
+    RUN_TEST(testLessThanHEX8, 3646);
+    RUN_TEST(testNotLessThanHEX8, 3662);
+    RUN_TEST(testLessThanHEX16, 3669);
+    RUN_TEST(testNotLessThanHEX16, 3685);
+    RUN_TEST(testLessThanHEX32, 3692);
+    RUN_TEST(testNotLessThanHEX32, 3708);
+    RUN_TEST(testLessOrEqual, 3715);
+    RUN_TEST(testNotLessOrEqual, 3737);
+    RUN_TEST(testLessOrEqualINT, 3744);
+    RUN_TEST(testNotLessOrEqualINT, 3766);
+    RUN_TEST(testLessOrEqualINT8, 3773);
+    RUN_TEST(testNotLessOrEqualINT8, 3795);
+    RUN_TEST(testLessOrEqualINT16, 3802);
+    RUN_TEST(testNotLessOrEqualINT16, 3824);
+    RUN_TEST(testLessOrEqualINT32, 3831);
+    RUN_TEST(testNotLessOrEqualINT32, 3853);
+    RUN_TEST(testLessOrEqualUINT, 3860);
+    RUN_TEST(testNotLessOrEqualUINT, 3882);
+    RUN_TEST(testLessOrEqualUINT8, 3889);
+    RUN_TEST(testNotLessOrEqualUINT8, 3911);
+    RUN_TEST(testLessOrEqualUINT16, 3918);
+    RUN_TEST(testNotLessOrEqualUINT16, 3940);
+    RUN_TEST(testLessOrEqualUINT32, 3947);
+    RUN_TEST(testNotLessOrEqualUINT32, 3969);
+    RUN_TEST(testLessOrEqualHEX8, 3976);
+    RUN_TEST(testNotLessOrEqualHEX8, 3998);
+    RUN_TEST(testLessOrEqualHEX16, 4005);
+    RUN_TEST(testNotLessOrEqualHEX16, 4027);
+    RUN_TEST(testLessOrEqualHEX32, 4034);
+    RUN_TEST(testNotLessOrEqualHEX32, 4056);
+    RUN_TEST(testEqualStrings, 4064);
+    RUN_TEST(testEqualStringsLen, 4075);
+    RUN_TEST(testEqualStringsWithCarriageReturnsAndLineFeeds, 4085);
+    RUN_TEST(testNotEqualString1, 4096);
+    RUN_TEST(testNotEqualStringLen1, 4103);
+    RUN_TEST(testNotEqualString2, 4110);
+    RUN_TEST(testNotEqualStringLen2, 4117);
+    RUN_TEST(testNotEqualString3, 4124);
+    RUN_TEST(testNotEqualStringLen3, 4131);
+    RUN_TEST(testNotEqualString4, 4138);
+    RUN_TEST(testNotEqualStringLen4, 4145);
+    RUN_TEST(testNotEqualString5, 4152);
+    RUN_TEST(testNotEqualString_ExpectedStringIsNull, 4161);
+    RUN_TEST(testNotEqualStringLen_ExpectedStringIsNull, 4168);
+    RUN_TEST(testNotEqualString_ActualStringIsNull, 4175);
+    RUN_TEST(testNotEqualStringLen_ActualStringIsNull, 4182);
+    RUN_TEST(testNotEqualString_ExpectedStringIsLonger, 4189);
+    RUN_TEST(testNotEqualString_ActualStringIsLonger, 4196);
+    RUN_TEST(testEqualStringArrays, 4203);
+    RUN_TEST(testNotEqualStringArray1, 4214);
+    RUN_TEST(testNotEqualStringArray2, 4224);
+    RUN_TEST(testNotEqualStringArray3, 4234);
+    RUN_TEST(testNotEqualStringArray4, 4244);
+    RUN_TEST(testNotEqualStringArray5, 4254);
+    RUN_TEST(testNotEqualStringArray6, 4264);
+    RUN_TEST(testEqualStringArrayIfBothNulls, 4274);
+    RUN_TEST(testNotEqualStringArrayLengthZero, 4282);
+    RUN_TEST(testEqualStringEachEqual, 4292);
+    RUN_TEST(testNotEqualStringEachEqual1, 4304);
+    RUN_TEST(testNotEqualStringEachEqual2, 4313);
+    RUN_TEST(testNotEqualStringEachEqual3, 4322);
+    RUN_TEST(testNotEqualStringEachEqual4, 4331);
+    RUN_TEST(testNotEqualStringEachEqual5, 4340);
+    RUN_TEST(testEqualMemory, 4347);
+    RUN_TEST(testNotEqualMemory1, 4359);
+    RUN_TEST(testNotEqualMemory2, 4366);
+    RUN_TEST(testNotEqualMemory3, 4373);
+    RUN_TEST(testNotEqualMemory4, 4380);
+    RUN_TEST(testNotEqualMemoryLengthZero, 4387);
+    RUN_TEST(testEqualIntArrays, 4394);
+    RUN_TEST(testNotEqualIntArraysNullExpected, 4409);
+    RUN_TEST(testNotEqualIntArraysNullActual, 4419);
+    RUN_TEST(testNotEqualIntArrays1, 4429);
+    RUN_TEST(testNotEqualIntArrays2, 4439);
+    RUN_TEST(testNotEqualIntArrays3, 4449);
+    RUN_TEST(testNotEqualIntArraysLengthZero, 4459);
+    RUN_TEST(testEqualIntEachEqual, 4469);
+    RUN_TEST(testNotEqualIntEachEqualNullActual, 4483);
+    RUN_TEST(testNotEqualIntEachEqual1, 4492);
+    RUN_TEST(testNotEqualIntEachEqual2, 4501);
+    RUN_TEST(testNotEqualIntEachEqual3, 4510);
+    RUN_TEST(testNotEqualEachEqualLengthZero, 4519);
+    RUN_TEST(testEqualPtrArrays, 4528);
+    RUN_TEST(testNotEqualPtrArraysNullExpected, 4545);
+    RUN_TEST(testNotEqualPtrArraysNullActual, 4557);
+    RUN_TEST(testNotEqualPtrArrays1, 4569);
+    RUN_TEST(testNotEqualPtrArrays2, 4582);
+    RUN_TEST(testNotEqualPtrArrays3, 4595);
+    RUN_TEST(testEqualPtrEachEqual, 4608);
+    RUN_TEST(testNotEqualPtrEachEqualNullExpected, 4625);
+    RUN_TEST(testNotEqualPtrEachEqualNullActual, 4636);
+    RUN_TEST(testNotEqualPtrEachEqual1, 4646);
+    RUN_TEST(testNotEqualPtrEachEqual2, 4657);
+    RUN_TEST(testNotEqualPtrEachEqual3, 4668);
+    RUN_TEST(testEqualInt8Arrays, 4679);
+    RUN_TEST(testNotEqualInt8Arrays, 4693);
+    RUN_TEST(testEqualInt8EachEqual, 4703);
+    RUN_TEST(testNotEqualInt8EachEqual, 4717);
+    RUN_TEST(testEqualUIntArrays, 4726);
+    RUN_TEST(testNotEqualUIntArrays1, 4740);
+    RUN_TEST(testNotEqualUIntArrays2, 4750);
+    RUN_TEST(testNotEqualUIntArrays3, 4760);
+    RUN_TEST(testEqualUIntEachEqual, 4770);
+    RUN_TEST(testNotEqualUIntEachEqual1, 4784);
+    RUN_TEST(testNotEqualUIntEachEqual2, 4793);
+    RUN_TEST(testNotEqualUIntEachEqual3, 4802);
+    RUN_TEST(testEqualInt16Arrays, 4811);
+    RUN_TEST(testNotEqualInt16Arrays, 4825);
+    RUN_TEST(testEqualInt16EachEqual, 4835);
+    RUN_TEST(testNotEqualInt16EachEqual, 4849);
+    RUN_TEST(testEqualInt32Arrays, 4858);
+    RUN_TEST(testNotEqualInt32Arrays, 4872);
+    RUN_TEST(testEqualInt32EachEqual, 4882);
+    RUN_TEST(testNotEqualInt32EachEqual, 4896);
+    RUN_TEST(testEqualUINT8Arrays, 4905);
+    RUN_TEST(testNotEqualUINT8Arrays1, 4919);
+    RUN_TEST(testNotEqualUINT8Arrays2, 4929);
+    RUN_TEST(testNotEqualUINT8Arrays3, 4939);
+    RUN_TEST(testEqualUINT16Arrays, 4950);
+    RUN_TEST(testNotEqualUINT16Arrays1, 4964);
+    RUN_TEST(testNotEqualUINT16Arrays2, 4974);
+    RUN_TEST(testNotEqualUINT16Arrays3, 4984);
+    RUN_TEST(testEqualUINT32Arrays, 4994);
+    RUN_TEST(testNotEqualUINT32Arrays1, 5008);
+    RUN_TEST(testNotEqualUINT32Arrays2, 5018);
+    RUN_TEST(testNotEqualUINT32Arrays3, 5028);
+    RUN_TEST(testEqualHEXArrays, 5038);
+    RUN_TEST(testNotEqualHEXArrays1, 5052);
+    RUN_TEST(testNotEqualHEXArrays2, 5062);
+    RUN_TEST(testNotEqualHEXArrays3, 5072);
+    RUN_TEST(testEqualHEX32Arrays, 5082);
+    RUN_TEST(testNotEqualHEX32Arrays1, 5096);
+    RUN_TEST(testNotEqualHEX32Arrays2, 5106);
+    RUN_TEST(testNotEqualHEX32Arrays3, 5116);
+    RUN_TEST(testEqualHEX16Arrays, 5126);
+    RUN_TEST(testNotEqualHEX16Arrays1, 5140);
+    RUN_TEST(testNotEqualHEX16Arrays2, 5150);
+    RUN_TEST(testNotEqualHEX16Arrays3, 5160);
+    RUN_TEST(testEqualHEX8Arrays, 5170);
+    RUN_TEST(testNotEqualHEX8Arrays1, 5184);
+    RUN_TEST(testNotEqualHEX8Arrays2, 5194);
+    RUN_TEST(testNotEqualHEX8Arrays3, 5204);
+    RUN_TEST(testEqualUINT8EachEqual, 5214);
+    RUN_TEST(testNotEqualUINT8EachEqual1, 5228);
+    RUN_TEST(testNotEqualUINT8EachEqual2, 5237);
+    RUN_TEST(testNotEqualUINT8EachEqual3, 5246);
+    RUN_TEST(testEqualUINT16EachEqual, 5255);
+    RUN_TEST(testNotEqualUINT16EachEqual1, 5269);
+    RUN_TEST(testNotEqualUINT16EachEqual2, 5278);
+    RUN_TEST(testNotEqualUINT16EachEqual3, 5287);
+    RUN_TEST(testEqualUINT32EachEqual, 5296);
+    RUN_TEST(testNotEqualUINT32EachEqual1, 5310);
+    RUN_TEST(testNotEqualUINT32EachEqual2, 5319);
+    RUN_TEST(testNotEqualUINT32EachEqual3, 5328);
+    RUN_TEST(testEqualHEXEachEqual, 5337);
+    RUN_TEST(testNotEqualHEXEachEqual1, 5351);
+    RUN_TEST(testNotEqualHEXEachEqual2, 5360);
+    RUN_TEST(testNotEqualHEXEachEqual3, 5369);
+    RUN_TEST(testEqualHEX32EachEqual, 5378);
+    RUN_TEST(testNotEqualHEX32EachEqual1, 5392);
+    RUN_TEST(testNotEqualHEX32EachEqual2, 5401);
+    RUN_TEST(testNotEqualHEX32EachEqual3, 5410);
+    RUN_TEST(testEqualHEX16EachEqual, 5419);
+    RUN_TEST(testNotEqualHEX16EachEqual1, 5433);
+    RUN_TEST(testNotEqualHEX16EachEqual2, 5442);
+    RUN_TEST(testNotEqualHEX16EachEqual3, 5451);
+    RUN_TEST(testEqualHEX8EachEqual, 5460);
+    RUN_TEST(testNotEqualHEX8EachEqual1, 5474);
+    RUN_TEST(testNotEqualHEX8EachEqual2, 5483);
+    RUN_TEST(testNotEqualHEX8EachEqual3, 5492);
+    RUN_TEST(testEqualMemoryArrays, 5501);
+    RUN_TEST(testNotEqualMemoryArraysExpectedNull, 5515);
+    RUN_TEST(testNotEqualMemoryArraysActualNull, 5525);
+    RUN_TEST(testNotEqualMemoryArrays1, 5535);
+    RUN_TEST(testNotEqualMemoryArrays2, 5545);
+    RUN_TEST(testNotEqualMemoryArrays3, 5555);
+    RUN_TEST(testEqualMemoryEachEqual, 5565);
+    RUN_TEST(testNotEqualMemoryEachEqualExpectedNull, 5580);
+    RUN_TEST(testNotEqualMemoryEachEqualActualNull, 5590);
+    RUN_TEST(testNotEqualMemoryEachEqual1, 5600);
+    RUN_TEST(testNotEqualMemoryEachEqual2, 5610);
+    RUN_TEST(testNotEqualMemoryEachEqual3, 5620);
+    RUN_TEST(testProtection, 5630);
+    RUN_TEST(testIgnoredAndThenFailInTearDown, 5648);
+    RUN_TEST(testFailureCountIncrementsAndIsReturnedAtEnd, 5711);
+    RUN_TEST(testAggregatedRunCombinesCountsOfEachTestFile, 5735);
+    RUN_TEST(testParamsRunEveryEntryAndReportFailingOnes, 5798);
+    RUN_TEST(testParamsNameFailingEntriesWithTheirLabel, 5823);
+    RUN_TEST(testParamsIgnoreTheTestWhenEveryEntryIsIgnored, 5843);
+    RUN_TEST(testParamsCountAsOneTest, 5865);
+    RUN_TEST(testCombinationsRunEveryCombinationOfRangesAndValues, 5920);
+    RUN_TEST(testCombinationsOfAnEmptyAxisAreIgnored, 5945);
+    RUN_TEST(testCombinationsWithTooManyPairsFail, 5958);
+    RUN_TEST(testCombinationsPairwiseCoverEveryPairInFewerCases, 5971);
+    RUN_TEST(testBenchSummarizeFindsMedianMinimumAndDeviation, 6010);
+    RUN_TEST(testBenchSummarizeEstimatesNoise, 6032);
+    RUN_TEST(testBenchMedianIntervalHoldsTheConfidenceLevel, 6053);
+    RUN_TEST(testBigOFitFindsTheComplexityOfTimes, 6066);
+    RUN_TEST(testBenchmarkCalibratesAndReportsItsLoop, 6095);
+    RUN_TEST(testBenchmarkWithoutLoopFails, 6115);
+    RUN_TEST(testBenchmarkABCannotBeHundredPercentFaster, 6126);
+    RUN_TEST(testBenchmarksAreIgnoredWhenDisabled, 6137);
+    RUN_TEST(testHistogramFindsPercentiles, 6150);
+    RUN_TEST(testHistogramCountsSmallValuesExactly, 6172);
+    RUN_TEST(testHistogramHoldsTheLargestValues, 6186);
+    RUN_TEST(testPercentileBelowPasses, 6195);
+    RUN_TEST(testPercentileBelowFailsInTheTail, 6209);
+    RUN_TEST(testPercentileBelowFailsWithoutSamples, 6228);
+    RUN_TEST(testPercentileFailureNamesThePercentile, 6237);
+    RUN_TEST(testHistogramIsPrinted, 6252);
+    RUN_TEST(testExecTimeIsPrintedInAdaptiveUnits, 6282);
+    RUN_TEST(testCstringsEscapeSequence, 6297);
+    RUN_TEST(testHexPrintsUpToMaxNumberOfNibbles, 6309);
+    RUN_TEST(testPrintNumbers32, 6335);
+    RUN_TEST(testPrintNumbersUnsigned32, 6349);
+    RUN_TEST(testPrintNumbersInt64, 6365);
+    RUN_TEST(testPrintNumbersUInt64, 6381);
+    RUN_TEST(testEqualHex64s, 6397);
+    RUN_TEST(testEqualUint64s, 6420);
+    RUN_TEST(testEqualInt64s, 6443);
+    RUN_TEST(testNotEqualHex64s, 6467);
+    RUN_TEST(testNotEqualUint64s, 6483);
+    RUN_TEST(testNotEqualInt64s, 6499);
+    RUN_TEST(testNotEqualHex64sIfSigned, 6515);
+    RUN_TEST(testHEX64sWithinDelta, 6531);
+    RUN_TEST(testHEX64sNotWithinDelta, 6542);
+    RUN_TEST(testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass, 6553);
+    RUN_TEST(testUINT64sWithinDelta, 6564);
+    RUN_TEST(testUINT64sNotWithinDelta, 6575);
+    RUN_TEST(testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass, 6586);
+    RUN_TEST(testINT64sWithinDelta, 6597);
+    RUN_TEST(testINT64sNotWithinDelta, 6608);
+    RUN_TEST(testINT64sNotWithinDeltaAndDifferenceOverflows, 6619);
+    RUN_TEST(testEqualHEX64Arrays, 6630);
+    RUN_TEST(testEqualUint64Arrays, 6648);
+    RUN_TEST(testEqualInt64Arrays, 6666);
+    RUN_TEST(testNotEqualHEX64Arrays1, 6685);
+    RUN_TEST(testNotEqualHEX64Arrays2, 6699);
+    RUN_TEST(testNotEqualUint64Arrays, 6713);
+    RUN_TEST(testNotEqualInt64Arrays, 6727);
+    RUN_TEST(testFloatsWithinDelta, 6742);
+    RUN_TEST(testFloatsNotWithinDelta, 6754);
+    RUN_TEST(testFloatsEqual, 6765);
+    RUN_TEST(testFloatsNotEqual, 6777);
+    RUN_TEST(testFloatsNotEqualNegative1, 6788);
+    RUN_TEST(testFloatsNotEqualNegative2, 6799);
+    RUN_TEST(testFloatsNotEqualActualNaN, 6810);
+    RUN_TEST(testFloatsNotEqualExpectedNaN, 6821);
+    RUN_TEST(testFloatsEqualBothNaN, 6832);
+    RUN_TEST(testFloatsNotEqualInfNaN, 6841);
+    RUN_TEST(testFloatsNotEqualNaNInf, 6852);
+    RUN_TEST(testFloatsNotEqualActualInf, 6863);
+    RUN_TEST(testFloatsNotEqualExpectedInf, 6874);
+    RUN_TEST(testFloatsEqualBothInf, 6885);
+    RUN_TEST(testFloatsNotEqualPlusMinusInf, 6894);
+    RUN_TEST(testFloatIsPosInf1, 6905);
+    RUN_TEST(testFloatIsPosInf2, 6914);
+    RUN_TEST(testFloatIsNegInf1, 6925);
+    RUN_TEST(testFloatIsNegInf2, 6934);
+    RUN_TEST(testFloatIsNotPosInf1, 6945);
+    RUN_TEST(testFloatIsNotPosInf2, 6956);
+    RUN_TEST(testFloatIsNotNegInf, 6965);
+    RUN_TEST(testFloatIsNan1, 6976);
+    RUN_TEST(testFloatIsNan2, 6985);
+    RUN_TEST(testFloatIsNotNan1, 6996);
+    RUN_TEST(testFloatIsNotNan2, 7007);
+    RUN_TEST(testFloatInfIsNotNan, 7016);
+    RUN_TEST(testFloatNanIsNotInf, 7027);
+    RUN_TEST(testFloatIsDeterminate1, 7038);
+    RUN_TEST(testFloatIsDeterminate2, 7049);
+    RUN_TEST(testFloatIsNotDeterminate1, 7060);
+    RUN_TEST(testFloatIsNotDeterminate2, 7071);
+    RUN_TEST(testFloatTraitFailsOnInvalidTrait, 7082);
+    RUN_TEST(testEqualFloatArrays, 7094);
+    RUN_TEST(testNotEqualFloatArraysExpectedNull, 7113);
+    RUN_TEST(testNotEqualFloatArraysActualNull, 7127);
+    RUN_TEST(testNotEqualFloatArrays1, 7141);
+    RUN_TEST(testNotEqualFloatArrays2, 7155);
+    RUN_TEST(testNotEqualFloatArrays3, 7169);
+    RUN_TEST(testNotEqualFloatArraysNegative1, 7183);
+    RUN_TEST(testNotEqualFloatArraysNegative2, 7197);
+    RUN_TEST(testNotEqualFloatArraysNegative3, 7211);
+    RUN_TEST(testEqualFloatArraysNaN, 7225);
+    RUN_TEST(testEqualFloatArraysInf, 7237);
+    RUN_TEST(testNotEqualFloatArraysLengthZero, 7249);
+    RUN_TEST(testEqualFloatEachEqual, 7263);
+    RUN_TEST(testNotEqualFloatEachEqualActualNull, 7281);
+    RUN_TEST(testNotEqualFloatEachEqual1, 7294);
+    RUN_TEST(testNotEqualFloatEachEqual2, 7307);
+    RUN_TEST(testNotEqualFloatEachEqual3, 7320);
+    RUN_TEST(testNotEqualFloatEachEqualNegative1, 7333);
+    RUN_TEST(testNotEqualFloatEachEqualNegative2, 7346);
+    RUN_TEST(testNotEqualFloatEachEqualNegative3, 7359);
+    RUN_TEST(testEqualFloatEachEqualNaN, 7372);
+    RUN_TEST(testEqualFloatEachEqualInf, 7383);
+    RUN_TEST(testNotEqualFloatEachEqualLengthZero, 7394);
+    RUN_TEST(testFloatPrinting, 7412);
+    RUN_TEST(testFloatPrintingRoundTiesToEven, 7461);
+    RUN_TEST(testFloatPrintingInfinityAndNaN, 7480);
+    RUN_TEST(testFloatPrintingRandomSamples, 7572);
+    RUN_TEST(testDoublesWithinDelta, 7600);
+    RUN_TEST(testDoublesNotWithinDelta, 7612);
+    RUN_TEST(testDoublesEqual, 7624);
+    RUN_TEST(testDoublesNotEqual, 7636);
+    RUN_TEST(testDoublesNotEqualNegative1, 7647);
+    RUN_TEST(testDoublesNotEqualNegative2, 7658);
+    RUN_TEST(testDoublesNotEqualActualNaN, 7669);
+    RUN_TEST(testDoublesNotEqualExpectedNaN, 7680);
+    RUN_TEST(testDoublesEqualBothNaN, 7691);
+    RUN_TEST(testDoublesNotEqualInfNaN, 7700);
+    RUN_TEST(testDoublesNotEqualNaNInf, 7711);
+    RUN_TEST(testDoublesNotEqualActualInf, 7722);
+    RUN_TEST(testDoublesNotEqualExpectedInf, 7733);
+    RUN_TEST(testDoublesEqualBothInf, 7744);
+    RUN_TEST(testDoublesNotEqualPlusMinusInf, 7753);
+    RUN_TEST(testDoubleIsPosInf1, 7764);
+    RUN_TEST(testDoubleIsPosInf2, 7773);
+    RUN_TEST(testDoubleIsNegInf1, 7784);
+    RUN_TEST(testDoubleIsNegInf2, 7793);
+    RUN_TEST(testDoubleIsNotPosInf1, 7804);
+    RUN_TEST(testDoubleIsNotPosInf2, 7815);
+    RUN_TEST(testDoubleIsNotNegInf, 7824);
+    RUN_TEST(testDoubleIsNan1, 7835);
+    RUN_TEST(testDoubleIsNan2, 7844);
+    RUN_TEST(testDoubleIsNotNan1, 7855);
+    RUN_TEST(testDoubleIsNotNan2, 7866);
+    RUN_TEST(testDoubleInfIsNotNan, 7875);
+    RUN_TEST(testDoubleNanIsNotInf, 7886);
+    RUN_TEST(testDoubleIsDeterminate1, 7897);
+    RUN_TEST(testDoubleIsDeterminate2, 7908);
+    RUN_TEST(testDoubleIsNotDeterminate1, 7919);
+    RUN_TEST(testDoubleIsNotDeterminate2, 7930);
+    RUN_TEST(testDoubleTraitFailsOnInvalidTrait, 7941);
+    RUN_TEST(testEqualDoubleArrays, 7952);
+    RUN_TEST(testNotEqualDoubleArraysExpectedNull, 7971);
+    RUN_TEST(testNotEqualDoubleArraysActualNull, 7985);
+    RUN_TEST(testNotEqualDoubleArrays1, 7999);
+    RUN_TEST(testNotEqualDoubleArrays2, 8013);
+    RUN_TEST(testNotEqualDoubleArrays3, 8027);
+    RUN_TEST(testNotEqualDoubleArraysNegative1, 8041);
+    RUN_TEST(testNotEqualDoubleArraysNegative2, 8055);
+    RUN_TEST(testNotEqualDoubleArraysNegative3, 8069);
+    RUN_TEST(testEqualDoubleArraysNaN, 8083);
+    RUN_TEST(testEqualDoubleArraysInf, 8095);
+    RUN_TEST(testNotEqualDoubleArraysLengthZero, 8107);
+    RUN_TEST(testEqualDoubleEachEqual, 8121);
+    RUN_TEST(testNotEqualDoubleEachEqualActualNull, 8139);
+    RUN_TEST(testNotEqualDoubleEachEqual1, 8152);
+    RUN_TEST(testNotEqualDoubleEachEqual2, 8165);
+    RUN_TEST(testNotEqualDoubleEachEqual3, 8178);
+    RUN_TEST(testNotEqualDoubleEachEqualNegative1, 8191);
+    RUN_TEST(testNotEqualDoubleEachEqualNegative2, 8204);
+    RUN_TEST(testNotEqualDoubleEachEqualNegative3, 8217);
+    RUN_TEST(testEqualDoubleEachEqualNaN, 8230);
+    RUN_TEST(testEqualDoubleEachEqualInf, 8241);
+    RUN_TEST(testNotEqualDoubleEachEqualLengthZero, 8252);
+    RUN_TEST(testDoublePrinting, 8265);
+    RUN_TEST(testDoublePrintingRoundTiesToEven, 8312);
+    RUN_TEST(testDoublePrintingInfinityAndNaN, 8327);
+    RUN_TEST(testThatDetailsCanBeHandleOneDetail, 8341);
+    RUN_TEST(testThatDetailsCanHandleTestFail, 8354);
+    RUN_TEST(testThatDetailsCanBeHandleTwoDetails, 8367);
+    RUN_TEST(testThatDetailsCanBeHandleSingleDetailClearingTwoDetails, 8380);
+    return HUNT_END();
+}
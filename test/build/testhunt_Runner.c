@@ -0,0 +1,1490 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Hunt.CurrentTestName = #TestFunc; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void testHuntSizeInitializationReminder(void);
+extern void testPassShouldEndImmediatelyWithPass(void);
+extern void testPassShouldEndImmediatelyWithPassAndMessage(void);
+extern void testMessageShouldDisplayMessageWithoutEndingAndGoOnToPass(void);
+extern void testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail(void);
+extern void testTrue(void);
+extern void testFalse(void);
+extern void testPreviousPass(void);
+extern void testNotVanilla(void);
+extern void testNotTrue(void);
+extern void testNotFalse(void);
+extern void testNotUnless(void);
+extern void testNotNotEqual(void);
+extern void testFail(void);
+extern void testIsNull(void);
+extern void testIsNullShouldFailIfNot(void);
+extern void testNotNullShouldFailIfNULL(void);
+extern void testIgnore(void);
+extern void testIgnoreMessage(void);
+extern void testNotEqualInts(void);
+extern void testNotEqualInt8s(void);
+extern void testNotEqualInt16s(void);
+extern void testNotEqualInt32s(void);
+extern void testNotEqualBits(void);
+extern void testNotEqualUInts(void);
+extern void testNotEqualUInt8s(void);
+extern void testNotEqualUInt16s(void);
+extern void testNotEqualUInt32s(void);
+extern void testNotEqualHex8s(void);
+extern void testNotEqualHex8sIfSigned(void);
+extern void testNotEqualHex16s(void);
+extern void testNotEqualHex16sIfSigned(void);
+extern void testNotEqualHex32s(void);
+extern void testNotEqualHex32sIfSigned(void);
+extern void testEqualInts(void);
+extern void testEqualInt8s(void);
+extern void testEqualInt8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualInt16s(void);
+extern void testEqualInt16sNegatives(void);
+extern void testEqualInt16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualInt32s(void);
+extern void testEqualInt32sNegatives(void);
+extern void testEqualUints(void);
+extern void testEqualUint8s(void);
+extern void testEqualUint8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualUint16s(void);
+extern void testEqualUint16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualUint32s(void);
+extern void testNotEqual(void);
+extern void testEqualHex8s(void);
+extern void testEqualHex8sWhenThereAreDifferencesOutside8Bits(void);
+extern void testEqualHex8sNegatives(void);
+extern void testEqualHex16s(void);
+extern void testEqualHex16sWhenThereAreDifferencesOutside16Bits(void);
+extern void testEqualHex32s(void);
+extern void testEqualBits(void);
+extern void testNotEqualBitHigh(void);
+extern void testNotEqualBitLow(void);
+extern void testNotEqualBitsHigh(void);
+extern void testNotEqualBitsLow(void);
+extern void testEqualShorts(void);
+extern void testEqualUShorts(void);
+extern void testEqualChars(void);
+extern void testEqualUChars(void);
+extern void testEqualPointers(void);
+extern void testNotEqualPointers(void);
+extern void testIntsWithinDelta(void);
+extern void testIntsWithinDeltaAndCustomMessage(void);
+extern void testIntsNotWithinDelta(void);
+extern void testIntsNotWithinDeltaAndCustomMessage(void);
+extern void testUIntsWithinDelta(void);
+extern void testUIntsWithinDeltaAndCustomMessage(void);
+extern void testUIntsNotWithinDelta(void);
+extern void testUIntsNotWithinDeltaAndCustomMessage(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst(void);
+extern void testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage(void);
+extern void testHEX32sWithinDelta(void);
+extern void testHEX32sWithinDeltaAndCustomMessage(void);
+extern void testHEX32sNotWithinDelta(void);
+extern void testHEX32sNotWithinDeltaAndCustomMessage(void);
+extern void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+extern void testHEX16sWithinDelta(void);
+extern void testHEX16sWithinDeltaAndCustomMessage(void);
+extern void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testHEX16sNotWithinDelta(void);
+extern void testHEX16sNotWithinDeltaAndCustomMessage(void);
+extern void testHEX8sWithinDelta(void);
+extern void testHEX8sWithinDeltaAndCustomMessage(void);
+extern void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testHEX8sNotWithinDelta(void);
+extern void testHEX8sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT32sWithinDelta(void);
+extern void testUINT32sWithinDeltaAndCustomMessage(void);
+extern void testUINT32sNotWithinDelta(void);
+extern void testUINT32sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage(void);
+extern void testUINT16sWithinDelta(void);
+extern void testUINT16sWithinDeltaAndCustomMessage(void);
+extern void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testUINT16sNotWithinDelta(void);
+extern void testUINT16sNotWithinDeltaAndCustomMessage(void);
+extern void testUINT8sWithinDelta(void);
+extern void testUINT8sWithinDeltaAndCustomMessage(void);
+extern void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testUINT8sNotWithinDelta(void);
+extern void testUINT8sNotWithinDeltaAndCustomMessage(void);
+extern void testINT32sWithinDelta(void);
+extern void testINT32sWithinDeltaAndCustomMessage(void);
+extern void testINT32sNotWithinDelta(void);
+extern void testINT32sNotWithinDeltaAndDifferenceOverflows(void);
+extern void testINT32sNotWithinDeltaAndCustomMessage(void);
+extern void testINT16sWithinDelta(void);
+extern void testINT16sWithinDeltaAndCustomMessage(void);
+extern void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits(void);
+extern void testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage(void);
+extern void testINT16sNotWithinDelta(void);
+extern void testINT16sNotWithinDeltaAndCustomMessage(void);
+extern void testINT8sWithinDelta(void);
+extern void testINT8sWithinDeltaAndCustomMessage(void);
+extern void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits(void);
+extern void testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage(void);
+extern void testINT8sNotWithinDelta(void);
+extern void testINT8sNotWithinDeltaAndCustomMessage(void);
+extern void testInt64ArrayWithinDelta(void);
+extern void testInt64ArrayWithinDeltaAndMessage(void);
+extern void testInt64ArrayNotWithinDeltaAndMessage(void);
+extern void testInt64ArrayWithinDeltaPointless(void);
+extern void testInt64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt64ArrayWithinDeltaExpectedNull(void);
+extern void testInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt64ArrayWithinDeltaActualNull(void);
+extern void testInt64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt64ArrayWithinDeltaSamePointer(void);
+extern void testInt64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testIntArrayWithinDelta(void);
+extern void testIntArrayWithinDeltaAndMessage(void);
+extern void testIntArrayNotWithinDelta(void);
+extern void testIntArrayNotWithinDeltaAndMessage(void);
+extern void testIntArrayWithinDeltaPointless(void);
+extern void testIntArrayWithinDeltaPointlessAndMessage(void);
+extern void testIntArrayWithinDeltaExpectedNull(void);
+extern void testIntArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testIntArrayWithinDeltaActualNull(void);
+extern void testIntArrayWithinDeltaActualNullAndMessage(void);
+extern void testIntArrayWithinDeltaSamePointer(void);
+extern void testIntArrayWithinDeltaSamePointerAndMessage(void);
+extern void testInt16ArrayWithinDelta(void);
+extern void testInt16ArrayWithinDeltaAndMessage(void);
+extern void testInt16ArrayNotWithinDelta(void);
+extern void testInt16ArrayNotWithinDeltaAndMessage(void);
+extern void testInt16ArrayWithinDeltaPointless(void);
+extern void testInt16ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt16ArrayWithinDeltaExpectedNull(void);
+extern void testInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt16ArrayWithinDeltaActualNull(void);
+extern void testInt16ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt16ArrayWithinDeltaSamePointer(void);
+extern void testInt16ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testInt8ArrayWithinDelta(void);
+extern void testInt8ArrayWithinDeltaAndMessage(void);
+extern void testInt8ArrayNotWithinDelta(void);
+extern void testInt8ArrayNotWithinDeltaAndMessage(void);
+extern void testInt8ArrayWithinDeltaPointless(void);
+extern void testInt8ArrayWithinDeltaPointlessAndMessage(void);
+extern void testInt8ArrayWithinDeltaExpectedNull(void);
+extern void testInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testInt8ArrayWithinDeltaActualNull(void);
+extern void testInt8ArrayWithinDeltaActualNullAndMessage(void);
+extern void testInt8ArrayWithinDeltaSamePointer(void);
+extern void testInt8ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt64ArrayWithinDelta(void);
+extern void testUInt64ArrayWithinDeltaAndMessage(void);
+extern void testUInt64ArrayNotWithinDelta(void);
+extern void testUInt64ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt64ArrayWithinDeltaPointless(void);
+extern void testUInt64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt64ArrayWithinDeltaExpectedNull(void);
+extern void testUInt64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt64ArrayWithinDeltaActualNull(void);
+extern void testUInt64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt64ArrayWithinDeltaSamePointer(void);
+extern void testUInt64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUIntArrayWithinDelta(void);
+extern void testUIntArrayWithinDeltaAndMessage(void);
+extern void testUIntArrayNotWithinDelta(void);
+extern void testUIntArrayNotWithinDeltaAndMessage(void);
+extern void testUIntArrayWithinDeltaPointless(void);
+extern void testUIntArrayWithinDeltaPointlessAndMessage(void);
+extern void testUIntArrayWithinDeltaExpectedNull(void);
+extern void testUIntArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUIntArrayWithinDeltaActualNull(void);
+extern void testUIntArrayWithinDeltaActualNullAndMessage(void);
+extern void testUIntArrayWithinDeltaSamePointer(void);
+extern void testUIntArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt16ArrayWithinDelta(void);
+extern void testUInt16ArrayWithinDeltaAndMessage(void);
+extern void testUInt16ArrayNotWithinDelta(void);
+extern void testUInt16ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt16ArrayWithinDeltaPointless(void);
+extern void testUInt16ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt16ArrayWithinDeltaExpectedNull(void);
+extern void testUInt16ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt16ArrayWithinDeltaActualNull(void);
+extern void testUInt16ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt16ArrayWithinDeltaSamePointer(void);
+extern void testUInt16ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testUInt8ArrayWithinDelta(void);
+extern void testUInt8ArrayWithinDeltaAndMessage(void);
+extern void testUInt8ArrayNotWithinDelta(void);
+extern void testUInt8ArrayNotWithinDeltaAndMessage(void);
+extern void testUInt8ArrayWithinDeltaPointless(void);
+extern void testUInt8ArrayWithinDeltaPointlessAndMessage(void);
+extern void testUInt8ArrayWithinDeltaExpectedNull(void);
+extern void testUInt8ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testUInt8ArrayWithinDeltaActualNull(void);
+extern void testUInt8ArrayWithinDeltaActualNullAndMessage(void);
+extern void testUInt8ArrayWithinDeltaSamePointer(void);
+extern void testUInt8ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX64ArrayWithinDelta(void);
+extern void testHEX64ArrayWithinDeltaAndMessage(void);
+extern void testHEX64ArrayNotWithinDelta(void);
+extern void testHEX64ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX64ArrayWithinDeltaPointless(void);
+extern void testHEX64ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX64ArrayWithinDeltaExpectedNull(void);
+extern void testHEX64ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX64ArrayWithinDeltaActualNull(void);
+extern void testHEX64ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX64ArrayWithinDeltaSamePointer(void);
+extern void testHEX64ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX32ArrayWithinDelta(void);
+extern void testHEX32ArrayWithinDeltaAndMessage(void);
+extern void testHEX32ArrayNotWithinDelta(void);
+extern void testHEX32ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX32ArrayWithinDeltaPointless(void);
+extern void testHEX32ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX32ArrayWithinDeltaExpectedNull(void);
+extern void testHEX32ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX32ArrayWithinDeltaActualNull(void);
+extern void testHEX32ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX32ArrayWithinDeltaSamePointer(void);
+extern void testHEX32ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX16ArrayWithinDelta(void);
+extern void testHEX16ArrayWithinDeltaAndMessage(void);
+extern void testHEX16ArrayNotWithinDelta(void);
+extern void testHEX16ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX16ArrayWithinDeltaPointless(void);
+extern void testHEX16ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX16ArrayWithinDeltaExpectedNull(void);
+extern void testHEX16ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX16ArrayWithinDeltaActualNull(void);
+extern void testHEX16ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX16ArrayWithinDeltaSamePointer(void);
+extern void testHEX16ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testHEX8ArrayWithinDelta(void);
+extern void testHEX8ArrayWithinDeltaAndMessage(void);
+extern void testHEX8ArrayNotWithinDelta(void);
+extern void testHEX8ArrayNotWithinDeltaAndMessage(void);
+extern void testHEX8ArrayWithinDeltaPointless(void);
+extern void testHEX8ArrayWithinDeltaPointlessAndMessage(void);
+extern void testHEX8ArrayWithinDeltaExpectedNull(void);
+extern void testHEX8ArrayWithinDeltaExpectedNullAndMessage(void);
+extern void testHEX8ArrayWithinDeltaActualNull(void);
+extern void testHEX8ArrayWithinDeltaActualNullAndMessage(void);
+extern void testHEX8ArrayWithinDeltaSamePointer(void);
+extern void testHEX8ArrayWithinDeltaSamePointerAndMessage(void);
+extern void testGreaterThan(void);
+extern void testNotGreaterThan(void);
+extern void testGreaterThanINT(void);
+extern void testNotGreaterThanINT(void);
+extern void testGreaterThanINT8(void);
+extern void testNotGreaterThanINT8(void);
+extern void testGreaterThanINT16(void);
+extern void testNotGreaterThanINT16(void);
+extern void testGreaterThanINT32(void);
+extern void testNotGreaterThanINT32(void);
+extern void testGreaterThanUINT(void);
+extern void testNotGreaterThanUINT(void);
+extern void testGreaterThanUINT8(void);
+extern void testNotGreaterThanUINT8(void);
+extern void testGreaterThanUINT16(void);
+extern void testNotGreaterThanUINT16(void);
+extern void testGreaterThanUINT32(void);
+extern void testNotGreaterThanUINT32(void);
+extern void testGreaterThanHEX8(void);
+extern void testNotGreaterThanHEX8(void);
+extern void testGreaterThanHEX16(void);
+extern void testNotGreaterThanHEX16(void);
+extern void testGreaterThanHEX32(void);
+extern void testNotGreaterThanHEX32(void);
+extern void testGreaterOrEqual(void);
+extern void testNotGreaterOrEqual(void);
+extern void testGreaterOrEqualINT(void);
+extern void testNotGreaterOrEqualINT(void);
+extern void testGreaterOrEqualINT8(void);
+extern void testNotGreaterOrEqualINT8(void);
+extern void testGreaterOrEqualINT16(void);
+extern void testNotGreaterOrEqualINT16(void);
+extern void testGreaterOrEqualINT32(void);
+extern void testNotGreaterOrEqualINT32(void);
+extern void testGreaterOrEqualUINT(void);
+extern void testNotGreaterOrEqualUINT(void);
+extern void testGreaterOrEqualUINT8(void);
+extern void testNotGreaterOrEqualUINT8(void);
+extern void testGreaterOrEqualUINT16(void);
+extern void testNotGreaterOrEqualUINT16(void);
+extern void testGreaterOrEqualUINT32(void);
+extern void testNotGreaterOrEqualUINT32(void);
+extern void testGreaterOrEqualHEX8(void);
+extern void testNotGreaterOrEqualHEX8(void);
+extern void testGreaterOrEqualHEX16(void);
+extern void testNotGreaterOrEqualHEX16(void);
+extern void testGreaterOrEqualHEX32(void);
+extern void testNotGreaterOrEqualHEX32(void);
+extern void testLessThan(void);
+extern void testNotLessThan(void);
+extern void testLessThanINT(void);
+extern void testNotLessThanINT(void);
+extern void testLessThanINT8(void);
+extern void testNotLessThanINT8(void);
+extern void testLessThanINT16(void);
+extern void testNotLessThanINT16(void);
+extern void testLessThanINT32(void);
+extern void testNotLessThanINT32(void);
+extern void testLessThanUINT(void);
+extern void testNotLessThanUINT(void);
+extern void testLessThanUINT8(void);
+extern void testNotLessThanUINT8(void);
+extern void testLessThanUINT16(void);
+extern void testNotLessThanUINT16(void);
+extern void testLessThanUINT32(void);
+extern void testNotLessThanUINT32(void);
+extern void testLessThanHEX8(void);
+extern void testNotLessThanHEX8(void);
+extern void testLessThanHEX16(void);
+extern void testNotLessThanHEX16(void);
+extern void testLessThanHEX32(void);
+extern void testNotLessThanHEX32(void);
+extern void testLessOrEqual(void);
+extern void testNotLessOrEqual(void);
+extern void testLessOrEqualINT(void);
+extern void testNotLessOrEqualINT(void);
+extern void testLessOrEqualINT8(void);
+extern void testNotLessOrEqualINT8(void);
+extern void testLessOrEqualINT16(void);
+extern void testNotLessOrEqualINT16(void);
+extern void testLessOrEqualINT32(void);
+extern void testNotLessOrEqualINT32(void);
+extern void testLessOrEqualUINT(void);
+extern void testNotLessOrEqualUINT(void);
+extern void testLessOrEqualUINT8(void);
+extern void testNotLessOrEqualUINT8(void);
+extern void testLessOrEqualUINT16(void);
+extern void testNotLessOrEqualUINT16(void);
+extern void testLessOrEqualUINT32(void);
+extern void testNotLessOrEqualUINT32(void);
+extern void testLessOrEqualHEX8(void);
+extern void testNotLessOrEqualHEX8(void);
+extern void testLessOrEqualHEX16(void);
+extern void testNotLessOrEqualHEX16(void);
+extern void testLessOrEqualHEX32(void);
+extern void testNotLessOrEqualHEX32(void);
+extern void testEqualStrings(void);
+extern void testEqualStringsLen(void);
+extern void testEqualStringsWithCarriageReturnsAndLineFeeds(void);
+extern void testNotEqualString1(void);
+extern void testNotEqualStringLen1(void);
+extern void testNotEqualString2(void);
+extern void testNotEqualStringLen2(void);
+extern void testNotEqualString3(void);
+extern void testNotEqualStringLen3(void);
+extern void testNotEqualString4(void);
+extern void testNotEqualStringLen4(void);
+extern void testNotEqualString5(void);
+extern void testNotEqualString_ExpectedStringIsNull(void);
+extern void testNotEqualStringLen_ExpectedStringIsNull(void);
+extern void testNotEqualString_ActualStringIsNull(void);
+extern void testNotEqualStringLen_ActualStringIsNull(void);
+extern void testNotEqualString_ExpectedStringIsLonger(void);
+extern void testNotEqualString_ActualStringIsLonger(void);
+extern void testEqualStringArrays(void);
+extern void testNotEqualStringArray1(void);
+extern void testNotEqualStringArray2(void);
+extern void testNotEqualStringArray3(void);
+extern void testNotEqualStringArray4(void);
+extern void testNotEqualStringArray5(void);
+extern void testNotEqualStringArray6(void);
+extern void testEqualStringArrayIfBothNulls(void);
+extern void testNotEqualStringArrayLengthZero(void);
+extern void testEqualStringEachEqual(void);
+extern void testNotEqualStringEachEqual1(void);
+extern void testNotEqualStringEachEqual2(void);
+extern void testNotEqualStringEachEqual3(void);
+extern void testNotEqualStringEachEqual4(void);
+extern void testNotEqualStringEachEqual5(void);
+extern void testEqualMemory(void);
+extern void testNotEqualMemory1(void);
+extern void testNotEqualMemory2(void);
+extern void testNotEqualMemory3(void);
+extern void testNotEqualMemory4(void);
+extern void testNotEqualMemoryLengthZero(void);
+extern void testEqualIntArrays(void);
+extern void testNotEqualIntArraysNullExpected(void);
+extern void testNotEqualIntArraysNullActual(void);
+extern void testNotEqualIntArrays1(void);
+extern void testNotEqualIntArrays2(void);
+extern void testNotEqualIntArrays3(void);
+extern void testNotEqualIntArraysLengthZero(void);
+extern void testEqualIntEachEqual(void);
+extern void testNotEqualIntEachEqualNullActual(void);
+extern void testNotEqualIntEachEqual1(void);
+extern void testNotEqualIntEachEqual2(void);
+extern void testNotEqualIntEachEqual3(void);
+extern void testNotEqualEachEqualLengthZero(void);
+extern void testEqualPtrArrays(void);
+extern void testNotEqualPtrArraysNullExpected(void);
+extern void testNotEqualPtrArraysNullActual(void);
+extern void testNotEqualPtrArrays1(void);
+extern void testNotEqualPtrArrays2(void);
+extern void testNotEqualPtrArrays3(void);
+extern void testEqualPtrEachEqual(void);
+extern void testNotEqualPtrEachEqualNullExpected(void);
+extern void testNotEqualPtrEachEqualNullActual(void);
+extern void testNotEqualPtrEachEqual1(void);
+extern void testNotEqualPtrEachEqual2(void);
+extern void testNotEqualPtrEachEqual3(void);
+extern void testEqualInt8Arrays(void);
+extern void testNotEqualInt8Arrays(void);
+extern void testEqualInt8EachEqual(void);
+extern void testNotEqualInt8EachEqual(void);
+extern void testEqualUIntArrays(void);
+extern void testNotEqualUIntArrays1(void);
+extern void testNotEqualUIntArrays2(void);
+extern void testNotEqualUIntArrays3(void);
+extern void testEqualUIntEachEqual(void);
+extern void testNotEqualUIntEachEqual1(void);
+extern void testNotEqualUIntEachEqual2(void);
+extern void testNotEqualUIntEachEqual3(void);
+extern void testEqualInt16Arrays(void);
+extern void testNotEqualInt16Arrays(void);
+extern void testEqualInt16EachEqual(void);
+extern void testNotEqualInt16EachEqual(void);
+extern void testEqualInt32Arrays(void);
+extern void testNotEqualInt32Arrays(void);
+extern void testEqualInt32EachEqual(void);
+extern void testNotEqualInt32EachEqual(void);
+extern void testEqualUINT8Arrays(void);
+extern void testNotEqualUINT8Arrays1(void);
+extern void testNotEqualUINT8Arrays2(void);
+extern void testNotEqualUINT8Arrays3(void);
+extern void testEqualUINT16Arrays(void);
+extern void testNotEqualUINT16Arrays1(void);
+extern void testNotEqualUINT16Arrays2(void);
+extern void testNotEqualUINT16Arrays3(void);
+extern void testEqualUINT32Arrays(void);
+extern void testNotEqualUINT32Arrays1(void);
+extern void testNotEqualUINT32Arrays2(void);
+extern void testNotEqualUINT32Arrays3(void);
+extern void testEqualHEXArrays(void);
+extern void testNotEqualHEXArrays1(void);
+extern void testNotEqualHEXArrays2(void);
+extern void testNotEqualHEXArrays3(void);
+extern void testEqualHEX32Arrays(void);
+extern void testNotEqualHEX32Arrays1(void);
+extern void testNotEqualHEX32Arrays2(void);
+extern void testNotEqualHEX32Arrays3(void);
+extern void testEqualHEX16Arrays(void);
+extern void testNotEqualHEX16Arrays1(void);
+extern void testNotEqualHEX16Arrays2(void);
+extern void testNotEqualHEX16Arrays3(void);
+extern void testEqualHEX8Arrays(void);
+extern void testNotEqualHEX8Arrays1(void);
+extern void testNotEqualHEX8Arrays2(void);
+extern void testNotEqualHEX8Arrays3(void);
+extern void testEqualUINT8EachEqual(void);
+extern void testNotEqualUINT8EachEqual1(void);
+extern void testNotEqualUINT8EachEqual2(void);
+extern void testNotEqualUINT8EachEqual3(void);
+extern void testEqualUINT16EachEqual(void);
+extern void testNotEqualUINT16EachEqual1(void);
+extern void testNotEqualUINT16EachEqual2(void);
+extern void testNotEqualUINT16EachEqual3(void);
+extern void testEqualUINT32EachEqual(void);
+extern void testNotEqualUINT32EachEqual1(void);
+extern void testNotEqualUINT32EachEqual2(void);
+extern void testNotEqualUINT32EachEqual3(void);
+extern void testEqualHEXEachEqual(void);
+extern void testNotEqualHEXEachEqual1(void);
+extern void testNotEqualHEXEachEqual2(void);
+extern void testNotEqualHEXEachEqual3(void);
+extern void testEqualHEX32EachEqual(void);
+extern void testNotEqualHEX32EachEqual1(void);
+extern void testNotEqualHEX32EachEqual2(void);
+extern void testNotEqualHEX32EachEqual3(void);
+extern void testEqualHEX16EachEqual(void);
+extern void testNotEqualHEX16EachEqual1(void);
+extern void testNotEqualHEX16EachEqual2(void);
+extern void testNotEqualHEX16EachEqual3(void);
+extern void testEqualHEX8EachEqual(void);
+extern void testNotEqualHEX8EachEqual1(void);
+extern void testNotEqualHEX8EachEqual2(void);
+extern void testNotEqualHEX8EachEqual3(void);
+extern void testEqualMemoryArrays(void);
+extern void testNotEqualMemoryArraysExpectedNull(void);
+extern void testNotEqualMemoryArraysActualNull(void);
+extern void testNotEqualMemoryArrays1(void);
+extern void testNotEqualMemoryArrays2(void);
+extern void testNotEqualMemoryArrays3(void);
+extern void testEqualMemoryEachEqual(void);
+extern void testNotEqualMemoryEachEqualExpectedNull(void);
+extern void testNotEqualMemoryEachEqualActualNull(void);
+extern void testNotEqualMemoryEachEqual1(void);
+extern void testNotEqualMemoryEachEqual2(void);
+extern void testNotEqualMemoryEachEqual3(void);
+extern void testProtection(void);
+extern void testIgnoredAndThenFailInTearDown(void);
+extern void testFailureCountIncrementsAndIsReturnedAtEnd(void);
+extern void testAggregatedRunCombinesCountsOfEachTestFile(void);
+extern void testParamsRunEveryEntryAndReportFailingOnes(void);
+extern void testParamsNameFailingEntriesWithTheirLabel(void);
+extern void testParamsIgnoreTheTestWhenEveryEntryIsIgnored(void);
+extern void testParamsCountAsOneTest(void);
+extern void testCombinationsRunEveryCombinationOfRangesAndValues(void);
+extern void testCombinationsOfAnEmptyAxisAreIgnored(void);
+extern void testCombinationsWithTooManyPairsFail(void);
+extern void testCombinationsPairwiseCoverEveryPairInFewerCases(void);
+extern void testBenchSummarizeFindsMedianMinimumAndDeviation(void);
+extern void testBenchSummarizeEstimatesNoise(void);
+extern void testBenchMedianIntervalHoldsTheConfidenceLevel(void);
+extern void testBigOFitFindsTheComplexityOfTimes(void);
+extern void testBenchmarkCalibratesAndReportsItsLoop(void);
+extern void testBenchmarkWithoutLoopFails(void);
+extern void testBenchmarkABCannotBeHundredPercentFaster(void);
+extern void testBenchmarksAreIgnoredWhenDisabled(void);
+extern void testHistogramFindsPercentiles(void);
+extern void testHistogramCountsSmallValuesExactly(void);
+extern void testHistogramHoldsTheLargestValues(void);
+extern void testPercentileBelowPasses(void);
+extern void testPercentileBelowFailsInTheTail(void);
+extern void testPercentileBelowFailsWithoutSamples(void);
+extern void testPercentileFailureNamesThePercentile(void);
+extern void testHistogramIsPrinted(void);
+extern void testExecTimeIsPrintedInAdaptiveUnits(void);
+extern void testCstringsEscapeSequence(void);
+extern void testHexPrintsUpToMaxNumberOfNibbles(void);
+extern void testPrintNumbers32(void);
+extern void testPrintNumbersUnsigned32(void);
+extern void testPrintNumbersInt64(void);
+extern void testPrintNumbersUInt64(void);
+extern void testEqualHex64s(void);
+extern void testEqualUint64s(void);
+extern void testEqualInt64s(void);
+extern void testNotEqualHex64s(void);
+extern void testNotEqualUint64s(void);
+extern void testNotEqualInt64s(void);
+extern void testNotEqualHex64sIfSigned(void);
+extern void testHEX64sWithinDelta(void);
+extern void testHEX64sNotWithinDelta(void);
+extern void testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testUINT64sWithinDelta(void);
+extern void testUINT64sNotWithinDelta(void);
+extern void testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass(void);
+extern void testINT64sWithinDelta(void);
+extern void testINT64sNotWithinDelta(void);
+extern void testINT64sNotWithinDeltaAndDifferenceOverflows(void);
+extern void testEqualHEX64Arrays(void);
+extern void testEqualUint64Arrays(void);
+extern void testEqualInt64Arrays(void);
+extern void testNotEqualHEX64Arrays1(void);
+extern void testNotEqualHEX64Arrays2(void);
+extern void testNotEqualUint64Arrays(void);
+extern void testNotEqualInt64Arrays(void);
+extern void testFloatsWithinDelta(void);
+extern void testFloatsNotWithinDelta(void);
+extern void testFloatsEqual(void);
+extern void testFloatsNotEqual(void);
+extern void testFloatsNotEqualNegative1(void);
+extern void testFloatsNotEqualNegative2(void);
+extern void testFloatsNotEqualActualNaN(void);
+extern void testFloatsNotEqualExpectedNaN(void);
+extern void testFloatsEqualBothNaN(void);
+extern void testFloatsNotEqualInfNaN(void);
+extern void testFloatsNotEqualNaNInf(void);
+extern void testFloatsNotEqualActualInf(void);
+extern void testFloatsNotEqualExpectedInf(void);
+extern void testFloatsEqualBothInf(void);
+extern void testFloatsNotEqualPlusMinusInf(void);
+extern void testFloatIsPosInf1(void);
+extern void testFloatIsPosInf2(void);
+extern void testFloatIsNegInf1(void);
+extern void testFloatIsNegInf2(void);
+extern void testFloatIsNotPosInf1(void);
+extern void testFloatIsNotPosInf2(void);
+extern void testFloatIsNotNegInf(void);
+extern void testFloatIsNan1(void);
+extern void testFloatIsNan2(void);
+extern void testFloatIsNotNan1(void);
+extern void testFloatIsNotNan2(void);
+extern void testFloatInfIsNotNan(void);
+extern void testFloatNanIsNotInf(void);
+extern void testFloatIsDeterminate1(void);
+extern void testFloatIsDeterminate2(void);
+extern void testFloatIsNotDeterminate1(void);
+extern void testFloatIsNotDeterminate2(void);
+extern void testFloatTraitFailsOnInvalidTrait(void);
+extern void testEqualFloatArrays(void);
+extern void testNotEqualFloatArraysExpectedNull(void);
+extern void testNotEqualFloatArraysActualNull(void);
+extern void testNotEqualFloatArrays1(void);
+extern void testNotEqualFloatArrays2(void);
+extern void testNotEqualFloatArrays3(void);
+extern void testNotEqualFloatArraysNegative1(void);
+extern void testNotEqualFloatArraysNegative2(void);
+extern void testNotEqualFloatArraysNegative3(void);
+extern void testEqualFloatArraysNaN(void);
+extern void testEqualFloatArraysInf(void);
+extern void testNotEqualFloatArraysLengthZero(void);
+extern void testEqualFloatEachEqual(void);
+extern void testNotEqualFloatEachEqualActualNull(void);
+extern void testNotEqualFloatEachEqual1(void);
+extern void testNotEqualFloatEachEqual2(void);
+extern void testNotEqualFloatEachEqual3(void);
+extern void testNotEqualFloatEachEqualNegative1(void);
+extern void testNotEqualFloatEachEqualNegative2(void);
+extern void testNotEqualFloatEachEqualNegative3(void);
+extern void testEqualFloatEachEqualNaN(void);
+extern void testEqualFloatEachEqualInf(void);
+extern void testNotEqualFloatEachEqualLengthZero(void);
+extern void testFloatPrinting(void);
+extern void testFloatPrintingRoundTiesToEven(void);
+extern void testFloatPrintingInfinityAndNaN(void);
+extern void testFloatPrintingRandomSamples(void);
+extern void testDoublesWithinDelta(void);
+extern void testDoublesNotWithinDelta(void);
+extern void testDoublesEqual(void);
+extern void testDoublesNotEqual(void);
+extern void testDoublesNotEqualNegative1(void);
+extern void testDoublesNotEqualNegative2(void);
+extern void testDoublesNotEqualActualNaN(void);
+extern void testDoublesNotEqualExpectedNaN(void);
+extern void testDoublesEqualBothNaN(void);
+extern void testDoublesNotEqualInfNaN(void);
+extern void testDoublesNotEqualNaNInf(void);
+extern void testDoublesNotEqualActualInf(void);
+extern void testDoublesNotEqualExpectedInf(void);
+extern void testDoublesEqualBothInf(void);
+extern void testDoublesNotEqualPlusMinusInf(void);
+extern void testDoubleIsPosInf1(void);
+extern void testDoubleIsPosInf2(void);
+extern void testDoubleIsNegInf1(void);
+extern void testDoubleIsNegInf2(void);
+extern void testDoubleIsNotPosInf1(void);
+extern void testDoubleIsNotPosInf2(void);
+extern void testDoubleIsNotNegInf(void);
+extern void testDoubleIsNan1(void);
+extern void testDoubleIsNan2(void);
+extern void testDoubleIsNotNan1(void);
+extern void testDoubleIsNotNan2(void);
+extern void testDoubleInfIsNotNan(void);
+extern void testDoubleNanIsNotInf(void);
+extern void testDoubleIsDeterminate1(void);
+extern void testDoubleIsDeterminate2(void);
+extern void testDoubleIsNotDeterminate1(void);
+extern void testDoubleIsNotDeterminate2(void);
+extern void testDoubleTraitFailsOnInvalidTrait(void);
+extern void testEqualDoubleArrays(void);
+extern void testNotEqualDoubleArraysExpectedNull(void);
+extern void testNotEqualDoubleArraysActualNull(void);
+extern void testNotEqualDoubleArrays1(void);
+extern void testNotEqualDoubleArrays2(void);
+extern void testNotEqualDoubleArrays3(void);
+extern void testNotEqualDoubleArraysNegative1(void);
+extern void testNotEqualDoubleArraysNegative2(void);
+extern void testNotEqualDoubleArraysNegative3(void);
+extern void testEqualDoubleArraysNaN(void);
+extern void testEqualDoubleArraysInf(void);
+extern void testNotEqualDoubleArraysLengthZero(void);
+extern void testEqualDoubleEachEqual(void);
+extern void testNotEqualDoubleEachEqualActualNull(void);
+extern void testNotEqualDoubleEachEqual1(void);
+extern void testNotEqualDoubleEachEqual2(void);
+extern void testNotEqualDoubleEachEqual3(void);
+extern void testNotEqualDoubleEachEqualNegative1(void);
+extern void testNotEqualDoubleEachEqualNegative2(void);
+extern void testNotEqualDoubleEachEqualNegative3(void);
+extern void testEqualDoubleEachEqualNaN(void);
+extern void testEqualDoubleEachEqualInf(void);
+extern void testNotEqualDoubleEachEqualLengthZero(void);
+extern void testDoublePrinting(void);
+extern void testDoublePrintingRoundTiesToEven(void);
+extern void testDoublePrintingInfinityAndNaN(void);
+extern void testThatDetailsCanBeHandleOneDetail(void);
+extern void testThatDetailsCanHandleTestFail(void);
+extern void testThatDetailsCanBeHandleTwoDetails(void);
+extern void testThatDetailsCanBeHandleSingleDetailClearingTwoDetails(void);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("tests/testhunt.c");
+  RUN_TEST(testHuntSizeInitializationReminder, 86);
+  RUN_TEST(testPassShouldEndImmediatelyWithPass, 144);
+  RUN_TEST(testPassShouldEndImmediatelyWithPassAndMessage, 150);
+  RUN_TEST(testMessageShouldDisplayMessageWithoutEndingAndGoOnToPass, 156);
+  RUN_TEST(testMessageShouldDisplayMessageWithoutEndingAndGoOnToFail, 163);
+  RUN_TEST(testTrue, 172);
+  RUN_TEST(testFalse, 179);
+  RUN_TEST(testPreviousPass, 186);
+  RUN_TEST(testNotVanilla, 191);
+  RUN_TEST(testNotTrue, 198);
+  RUN_TEST(testNotFalse, 205);
+  RUN_TEST(testNotUnless, 212);
+  RUN_TEST(testNotNotEqual, 219);
+  RUN_TEST(testFail, 226);
+  RUN_TEST(testIsNull, 233);
+  RUN_TEST(testIsNullShouldFailIfNot, 242);
+  RUN_TEST(testNotNullShouldFailIfNULL, 251);
+  RUN_TEST(testIgnore, 260);
+  RUN_TEST(testIgnoreMessage, 268);
+  RUN_TEST(testNotEqualInts, 276);
+  RUN_TEST(testNotEqualInt8s, 283);
+  RUN_TEST(testNotEqualInt16s, 290);
+  RUN_TEST(testNotEqualInt32s, 297);
+  RUN_TEST(testNotEqualBits, 304);
+  RUN_TEST(testNotEqualUInts, 311);
+  RUN_TEST(testNotEqualUInt8s, 323);
+  RUN_TEST(testNotEqualUInt16s, 335);
+  RUN_TEST(testNotEqualUInt32s, 347);
+  RUN_TEST(testNotEqualHex8s, 359);
+  RUN_TEST(testNotEqualHex8sIfSigned, 371);
+  RUN_TEST(testNotEqualHex16s, 383);
+  RUN_TEST(testNotEqualHex16sIfSigned, 395);
+  RUN_TEST(testNotEqualHex32s, 407);
+  RUN_TEST(testNotEqualHex32sIfSigned, 419);
+  RUN_TEST(testEqualInts, 431);
+  RUN_TEST(testEqualInt8s, 451);
+  RUN_TEST(testEqualInt8sWhenThereAreDifferencesOutside8Bits, 470);
+  RUN_TEST(testEqualInt16s, 476);
+  RUN_TEST(testEqualInt16sNegatives, 495);
+  RUN_TEST(testEqualInt16sWhenThereAreDifferencesOutside16Bits, 514);
+  RUN_TEST(testEqualInt32s, 520);
+  RUN_TEST(testEqualInt32sNegatives, 539);
+  RUN_TEST(testEqualUints, 559);
+  RUN_TEST(testEqualUint8s, 580);
+  RUN_TEST(testEqualUint8sWhenThereAreDifferencesOutside8Bits, 599);
+  RUN_TEST(testEqualUint16s, 605);
+  RUN_TEST(testEqualUint16sWhenThereAreDifferencesOutside16Bits, 624);
+  RUN_TEST(testEqualUint32s, 630);
+  RUN_TEST(testNotEqual, 649);
+  RUN_TEST(testEqualHex8s, 660);
+  RUN_TEST(testEqualHex8sWhenThereAreDifferencesOutside8Bits, 679);
+  RUN_TEST(testEqualHex8sNegatives, 685);
+  RUN_TEST(testEqualHex16s, 704);
+  RUN_TEST(testEqualHex16sWhenThereAreDifferencesOutside16Bits, 723);
+  RUN_TEST(testEqualHex32s, 729);
+  RUN_TEST(testEqualBits, 748);
+  RUN_TEST(testNotEqualBitHigh, 764);
+  RUN_TEST(testNotEqualBitLow, 773);
+  RUN_TEST(testNotEqualBitsHigh, 782);
+  RUN_TEST(testNotEqualBitsLow, 793);
+  RUN_TEST(testEqualShorts, 804);
+  RUN_TEST(testEqualUShorts, 824);
+  RUN_TEST(testEqualChars, 844);
+  RUN_TEST(testEqualUChars, 864);
+  RUN_TEST(testEqualPointers, 883);
+  RUN_TEST(testNotEqualPointers, 900);
+  RUN_TEST(testIntsWithinDelta, 907);
+  RUN_TEST(testIntsWithinDeltaAndCustomMessage, 919);
+  RUN_TEST(testIntsNotWithinDelta, 931);
+  RUN_TEST(testIntsNotWithinDeltaAndCustomMessage, 938);
+  RUN_TEST(testUIntsWithinDelta, 945);
+  RUN_TEST(testUIntsWithinDeltaAndCustomMessage, 952);
+  RUN_TEST(testUIntsNotWithinDelta, 959);
+  RUN_TEST(testUIntsNotWithinDeltaAndCustomMessage, 966);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirst, 973);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassSmallFirstAndCustomMessage, 980);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirst, 987);
+  RUN_TEST(testUIntsNotWithinDeltaEvenThoughASignedIntWouldPassBigFirstAndCustomMessage, 994);
+  RUN_TEST(testHEX32sWithinDelta, 1001);
+  RUN_TEST(testHEX32sWithinDeltaAndCustomMessage, 1008);
+  RUN_TEST(testHEX32sNotWithinDelta, 1015);
+  RUN_TEST(testHEX32sNotWithinDeltaAndCustomMessage, 1022);
+  RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPass, 1029);
+  RUN_TEST(testHEX32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 1036);
+  RUN_TEST(testHEX16sWithinDelta, 1043);
+  RUN_TEST(testHEX16sWithinDeltaAndCustomMessage, 1050);
+  RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1057);
+  RUN_TEST(testHEX16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1062);
+  RUN_TEST(testHEX16sNotWithinDelta, 1067);
+  RUN_TEST(testHEX16sNotWithinDeltaAndCustomMessage, 1074);
+  RUN_TEST(testHEX8sWithinDelta, 1081);
+  RUN_TEST(testHEX8sWithinDeltaAndCustomMessage, 1088);
+  RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1095);
+  RUN_TEST(testHEX8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1100);
+  RUN_TEST(testHEX8sNotWithinDelta, 1105);
+  RUN_TEST(testHEX8sNotWithinDeltaAndCustomMessage, 1112);
+  RUN_TEST(testUINT32sWithinDelta, 1121);
+  RUN_TEST(testUINT32sWithinDeltaAndCustomMessage, 1128);
+  RUN_TEST(testUINT32sNotWithinDelta, 1135);
+  RUN_TEST(testUINT32sNotWithinDeltaAndCustomMessage, 1142);
+  RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPass, 1149);
+  RUN_TEST(testUINT32sNotWithinDeltaEvenThoughASignedIntWouldPassAndCustomMessage, 1156);
+  RUN_TEST(testUINT16sWithinDelta, 1163);
+  RUN_TEST(testUINT16sWithinDeltaAndCustomMessage, 1170);
+  RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1177);
+  RUN_TEST(testUINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1182);
+  RUN_TEST(testUINT16sNotWithinDelta, 1187);
+  RUN_TEST(testUINT16sNotWithinDeltaAndCustomMessage, 1194);
+  RUN_TEST(testUINT8sWithinDelta, 1201);
+  RUN_TEST(testUINT8sWithinDeltaAndCustomMessage, 1208);
+  RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1215);
+  RUN_TEST(testUINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1220);
+  RUN_TEST(testUINT8sNotWithinDelta, 1225);
+  RUN_TEST(testUINT8sNotWithinDeltaAndCustomMessage, 1232);
+  RUN_TEST(testINT32sWithinDelta, 1239);
+  RUN_TEST(testINT32sWithinDeltaAndCustomMessage, 1246);
+  RUN_TEST(testINT32sNotWithinDelta, 1251);
+  RUN_TEST(testINT32sNotWithinDeltaAndDifferenceOverflows, 1258);
+  RUN_TEST(testINT32sNotWithinDeltaAndCustomMessage, 1264);
+  RUN_TEST(testINT16sWithinDelta, 1271);
+  RUN_TEST(testINT16sWithinDeltaAndCustomMessage, 1278);
+  RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16Bits, 1283);
+  RUN_TEST(testINT16sWithinDeltaWhenThereAreDifferenceOutsideOf16BitsAndCustomMessage, 1288);
+  RUN_TEST(testINT16sNotWithinDelta, 1293);
+  RUN_TEST(testINT16sNotWithinDeltaAndCustomMessage, 1300);
+  RUN_TEST(testINT8sWithinDelta, 1307);
+  RUN_TEST(testINT8sWithinDeltaAndCustomMessage, 1314);
+  RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8Bits, 1319);
+  RUN_TEST(testINT8sWithinDeltaWhenThereAreDifferenceOutsideOf8BitsAndCustomMessage, 1324);
+  RUN_TEST(testINT8sNotWithinDelta, 1329);
+  RUN_TEST(testINT8sNotWithinDeltaAndCustomMessage, 1336);
+  RUN_TEST(testInt64ArrayWithinDelta, 1345);
+  RUN_TEST(testInt64ArrayWithinDeltaAndMessage, 1359);
+  RUN_TEST(testInt64ArrayNotWithinDeltaAndMessage, 1387);
+  RUN_TEST(testInt64ArrayWithinDeltaPointless, 1401);
+  RUN_TEST(testInt64ArrayWithinDeltaPointlessAndMessage, 1415);
+  RUN_TEST(testInt64ArrayWithinDeltaExpectedNull, 1429);
+  RUN_TEST(testInt64ArrayWithinDeltaExpectedNullAndMessage, 1442);
+  RUN_TEST(testInt64ArrayWithinDeltaActualNull, 1455);
+  RUN_TEST(testInt64ArrayWithinDeltaActualNullAndMessage, 1468);
+  RUN_TEST(testInt64ArrayWithinDeltaSamePointer, 1481);
+  RUN_TEST(testInt64ArrayWithinDeltaSamePointerAndMessage, 1492);
+  RUN_TEST(testIntArrayWithinDelta, 1503);
+  RUN_TEST(testIntArrayWithinDeltaAndMessage, 1513);
+  RUN_TEST(testIntArrayNotWithinDelta, 1523);
+  RUN_TEST(testIntArrayNotWithinDeltaAndMessage, 1533);
+  RUN_TEST(testIntArrayWithinDeltaPointless, 1543);
+  RUN_TEST(testIntArrayWithinDeltaPointlessAndMessage, 1553);
+  RUN_TEST(testIntArrayWithinDeltaExpectedNull, 1563);
+  RUN_TEST(testIntArrayWithinDeltaExpectedNullAndMessage, 1572);
+  RUN_TEST(testIntArrayWithinDeltaActualNull, 1581);
+  RUN_TEST(testIntArrayWithinDeltaActualNullAndMessage, 1590);
+  RUN_TEST(testIntArrayWithinDeltaSamePointer, 1599);
+  RUN_TEST(testIntArrayWithinDeltaSamePointerAndMessage, 1606);
+  RUN_TEST(testInt16ArrayWithinDelta, 1613);
+  RUN_TEST(testInt16ArrayWithinDeltaAndMessage, 1623);
+  RUN_TEST(testInt16ArrayNotWithinDelta, 1633);
+  RUN_TEST(testInt16ArrayNotWithinDeltaAndMessage, 1643);
+  RUN_TEST(testInt16ArrayWithinDeltaPointless, 1653);
+  RUN_TEST(testInt16ArrayWithinDeltaPointlessAndMessage, 1663);
+  RUN_TEST(testInt16ArrayWithinDeltaExpectedNull, 1673);
+  RUN_TEST(testInt16ArrayWithinDeltaExpectedNullAndMessage, 1682);
+  RUN_TEST(testInt16ArrayWithinDeltaActualNull, 1691);
+  RUN_TEST(testInt16ArrayWithinDeltaActualNullAndMessage, 1700);
+  RUN_TEST(testInt16ArrayWithinDeltaSamePointer, 1709);
+  RUN_TEST(testInt16ArrayWithinDeltaSamePointerAndMessage, 1716);
+  RUN_TEST(testInt8ArrayWithinDelta, 1723);
+  RUN_TEST(testInt8ArrayWithinDeltaAndMessage, 1733);
+  RUN_TEST(testInt8ArrayNotWithinDelta, 1743);
+  RUN_TEST(testInt8ArrayNotWithinDeltaAndMessage, 1753);
+  RUN_TEST(testInt8ArrayWithinDeltaPointless, 1763);
+  RUN_TEST(testInt8ArrayWithinDeltaPointlessAndMessage, 1773);
+  RUN_TEST(testInt8ArrayWithinDeltaExpectedNull, 1783);
+  RUN_TEST(testInt8ArrayWithinDeltaExpectedNullAndMessage, 1792);
+  RUN_TEST(testInt8ArrayWithinDeltaActualNull, 1801);
+  RUN_TEST(testInt8ArrayWithinDeltaActualNullAndMessage, 1810);
+  RUN_TEST(testInt8ArrayWithinDeltaSamePointer, 1819);
+  RUN_TEST(testInt8ArrayWithinDeltaSamePointerAndMessage, 1826);
+  RUN_TEST(testUInt64ArrayWithinDelta, 1833);
+  RUN_TEST(testUInt64ArrayWithinDeltaAndMessage, 1847);
+  RUN_TEST(testUInt64ArrayNotWithinDelta, 1861);
+  RUN_TEST(testUInt64ArrayNotWithinDeltaAndMessage, 1875);
+  RUN_TEST(testUInt64ArrayWithinDeltaPointless, 1889);
+  RUN_TEST(testUInt64ArrayWithinDeltaPointlessAndMessage, 1903);
+  RUN_TEST(testUInt64ArrayWithinDeltaExpectedNull, 1917);
+  RUN_TEST(testUInt64ArrayWithinDeltaExpectedNullAndMessage, 1930);
+  RUN_TEST(testUInt64ArrayWithinDeltaActualNull, 1943);
+  RUN_TEST(testUInt64ArrayWithinDeltaActualNullAndMessage, 1956);
+  RUN_TEST(testUInt64ArrayWithinDeltaSamePointer, 1969);
+  RUN_TEST(testUInt64ArrayWithinDeltaSamePointerAndMessage, 1980);
+  RUN_TEST(testUIntArrayWithinDelta, 1991);
+  RUN_TEST(testUIntArrayWithinDeltaAndMessage, 2001);
+  RUN_TEST(testUIntArrayNotWithinDelta, 2011);
+  RUN_TEST(testUIntArrayNotWithinDeltaAndMessage, 2021);
+  RUN_TEST(testUIntArrayWithinDeltaPointless, 2031);
+  RUN_TEST(testUIntArrayWithinDeltaPointlessAndMessage, 2041);
+  RUN_TEST(testUIntArrayWithinDeltaExpectedNull, 2051);
+  RUN_TEST(testUIntArrayWithinDeltaExpectedNullAndMessage, 2060);
+  RUN_TEST(testUIntArrayWithinDeltaActualNull, 2069);
+  RUN_TEST(testUIntArrayWithinDeltaActualNullAndMessage, 2078);
+  RUN_TEST(testUIntArrayWithinDeltaSamePointer, 2087);
+  RUN_TEST(testUIntArrayWithinDeltaSamePointerAndMessage, 2094);
+  RUN_TEST(testUInt16ArrayWithinDelta, 2101);
+  RUN_TEST(testUInt16ArrayWithinDeltaAndMessage, 2111);
+  RUN_TEST(testUInt16ArrayNotWithinDelta, 2121);
+  RUN_TEST(testUInt16ArrayNotWithinDeltaAndMessage, 2131);
+  RUN_TEST(testUInt16ArrayWithinDeltaPointless, 2141);
+  RUN_TEST(testUInt16ArrayWithinDeltaPointlessAndMessage, 2151);
+  RUN_TEST(testUInt16ArrayWithinDeltaExpectedNull, 2161);
+  RUN_TEST(testUInt16ArrayWithinDeltaExpectedNullAndMessage, 2170);
+  RUN_TEST(testUInt16ArrayWithinDeltaActualNull, 2179);
+  RUN_TEST(testUInt16ArrayWithinDeltaActualNullAndMessage, 2188);
+  RUN_TEST(testUInt16ArrayWithinDeltaSamePointer, 2197);
+  RUN_TEST(testUInt16ArrayWithinDeltaSamePointerAndMessage, 2204);
+  RUN_TEST(testUInt8ArrayWithinDelta, 2211);
+  RUN_TEST(testUInt8ArrayWithinDeltaAndMessage, 2221);
+  RUN_TEST(testUInt8ArrayNotWithinDelta, 2231);
+  RUN_TEST(testUInt8ArrayNotWithinDeltaAndMessage, 2241);
+  RUN_TEST(testUInt8ArrayWithinDeltaPointless, 2251);
+  RUN_TEST(testUInt8ArrayWithinDeltaPointlessAndMessage, 2261);
+  RUN_TEST(testUInt8ArrayWithinDeltaExpectedNull, 2271);
+  RUN_TEST(testUInt8ArrayWithinDeltaExpectedNullAndMessage, 2280);
+  RUN_TEST(testUInt8ArrayWithinDeltaActualNull, 2289);
+  RUN_TEST(testUInt8ArrayWithinDeltaActualNullAndMessage, 2298);
+  RUN_TEST(testUInt8ArrayWithinDeltaSamePointer, 2307);
+  RUN_TEST(testUInt8ArrayWithinDeltaSamePointerAndMessage, 2314);
+  RUN_TEST(testHEX64ArrayWithinDelta, 2321);
+  RUN_TEST(testHEX64ArrayWithinDeltaAndMessage, 2335);
+  RUN_TEST(testHEX64ArrayNotWithinDelta, 2349);
+  RUN_TEST(testHEX64ArrayNotWithinDeltaAndMessage, 2363);
+  RUN_TEST(testHEX64ArrayWithinDeltaPointless, 2377);
+  RUN_TEST(testHEX64ArrayWithinDeltaPointlessAndMessage, 2391);
+  RUN_TEST(testHEX64ArrayWithinDeltaExpectedNull, 2405);
+  RUN_TEST(testHEX64ArrayWithinDeltaExpectedNullAndMessage, 2418);
+  RUN_TEST(testHEX64ArrayWithinDeltaActualNull, 2431);
+  RUN_TEST(testHEX64ArrayWithinDeltaActualNullAndMessage, 2444);
+  RUN_TEST(testHEX64ArrayWithinDeltaSamePointer, 2457);
+  RUN_TEST(testHEX64ArrayWithinDeltaSamePointerAndMessage, 2468);
+  RUN_TEST(testHEX32ArrayWithinDelta, 2479);
+  RUN_TEST(testHEX32ArrayWithinDeltaAndMessage, 2489);
+  RUN_TEST(testHEX32ArrayNotWithinDelta, 2499);
+  RUN_TEST(testHEX32ArrayNotWithinDeltaAndMessage, 2509);
+  RUN_TEST(testHEX32ArrayWithinDeltaPointless, 2519);
+  RUN_TEST(testHEX32ArrayWithinDeltaPointlessAndMessage, 2529);
+  RUN_TEST(testHEX32ArrayWithinDeltaExpectedNull, 2539);
+  RUN_TEST(testHEX32ArrayWithinDeltaExpectedNullAndMessage, 2548);
+  RUN_TEST(testHEX32ArrayWithinDeltaActualNull, 2557);
+  RUN_TEST(testHEX32ArrayWithinDeltaActualNullAndMessage, 2566);
+  RUN_TEST(testHEX32ArrayWithinDeltaSamePointer, 2575);
+  RUN_TEST(testHEX32ArrayWithinDeltaSamePointerAndMessage, 2582);
+  RUN_TEST(testHEX16ArrayWithinDelta, 2590);
+  RUN_TEST(testHEX16ArrayWithinDeltaAndMessage, 2600);
+  RUN_TEST(testHEX16ArrayNotWithinDelta, 2610);
+  RUN_TEST(testHEX16ArrayNotWithinDeltaAndMessage, 2620);
+  RUN_TEST(testHEX16ArrayWithinDeltaPointless, 2630);
+  RUN_TEST(testHEX16ArrayWithinDeltaPointlessAndMessage, 2640);
+  RUN_TEST(testHEX16ArrayWithinDeltaExpectedNull, 2650);
+  RUN_TEST(testHEX16ArrayWithinDeltaExpectedNullAndMessage, 2659);
+  RUN_TEST(testHEX16ArrayWithinDeltaActualNull, 2668);
+  RUN_TEST(testHEX16ArrayWithinDeltaActualNullAndMessage, 2677);
+  RUN_TEST(testHEX16ArrayWithinDeltaSamePointer, 2686);
+  RUN_TEST(testHEX16ArrayWithinDeltaSamePointerAndMessage, 2693);
+  RUN_TEST(testHEX8ArrayWithinDelta, 2700);
+  RUN_TEST(testHEX8ArrayWithinDeltaAndMessage, 2710);
+  RUN_TEST(testHEX8ArrayNotWithinDelta, 2720);
+  RUN_TEST(testHEX8ArrayNotWithinDeltaAndMessage, 2730);
+  RUN_TEST(testHEX8ArrayWithinDeltaPointless, 2740);
+  RUN_TEST(testHEX8ArrayWithinDeltaPointlessAndMessage, 2750);
+  RUN_TEST(testHEX8ArrayWithinDeltaExpectedNull, 2760);
+  RUN_TEST(testHEX8ArrayWithinDeltaExpectedNullAndMessage, 2769);
+  RUN_TEST(testHEX8ArrayWithinDeltaActualNull, 2778);
+  RUN_TEST(testHEX8ArrayWithinDeltaActualNullAndMessage, 2787);
+  RUN_TEST(testHEX8ArrayWithinDeltaSamePointer, 2796);
+  RUN_TEST(testHEX8ArrayWithinDeltaSamePointerAndMessage, 2803);
+  RUN_TEST(testGreaterThan, 2812);
+  RUN_TEST(testNotGreaterThan, 2828);
+  RUN_TEST(testGreaterThanINT, 2835);
+  RUN_TEST(testNotGreaterThanINT, 2851);
+  RUN_TEST(testGreaterThanINT8, 2858);
+  RUN_TEST(testNotGreaterThanINT8, 2874);
+  RUN_TEST(testGreaterThanINT16, 2881);
+  RUN_TEST(testNotGreaterThanINT16, 2897);
+  RUN_TEST(testGreaterThanINT32, 2904);
+  RUN_TEST(testNotGreaterThanINT32, 2920);
+  RUN_TEST(testGreaterThanUINT, 2927);
+  RUN_TEST(testNotGreaterThanUINT, 2943);
+  RUN_TEST(testGreaterThanUINT8, 2950);
+  RUN_TEST(testNotGreaterThanUINT8, 2966);
+  RUN_TEST(testGreaterThanUINT16, 2973);
+  RUN_TEST(testNotGreaterThanUINT16, 2989);
+  RUN_TEST(testGreaterThanUINT32, 2996);
+  RUN_TEST(testNotGreaterThanUINT32, 3012);
+  RUN_TEST(testGreaterThanHEX8, 3019);
+  RUN_TEST(testNotGreaterThanHEX8, 3035);
+  RUN_TEST(testGreaterThanHEX16, 3042);
+  RUN_TEST(testNotGreaterThanHEX16, 3058);
+  RUN_TEST(testGreaterThanHEX32, 3065);
+  RUN_TEST(testNotGreaterThanHEX32, 3081);
+  RUN_TEST(testGreaterOrEqual, 3088);
+  RUN_TEST(testNotGreaterOrEqual, 3110);
+  RUN_TEST(testGreaterOrEqualINT, 3117);
+  RUN_TEST(testNotGreaterOrEqualINT, 3139);
+  RUN_TEST(testGreaterOrEqualINT8, 3146);
+  RUN_TEST(testNotGreaterOrEqualINT8, 3168);
+  RUN_TEST(testGreaterOrEqualINT16, 3175);
+  RUN_TEST(testNotGreaterOrEqualINT16, 3197);
+  RUN_TEST(testGreaterOrEqualINT32, 3204);
+  RUN_TEST(testNotGreaterOrEqualINT32, 3226);
+  RUN_TEST(testGreaterOrEqualUINT, 3233);
+  RUN_TEST(testNotGreaterOrEqualUINT, 3255);
+  RUN_TEST(testGreaterOrEqualUINT8, 3262);
+  RUN_TEST(testNotGreaterOrEqualUINT8, 3284);
+  RUN_TEST(testGreaterOrEqualUINT16, 3291);
+  RUN_TEST(testNotGreaterOrEqualUINT16, 3313);
+  RUN_TEST(testGreaterOrEqualUINT32, 3320);
+  RUN_TEST(testNotGreaterOrEqualUINT32, 3342);
+  RUN_TEST(testGreaterOrEqualHEX8, 3349);
+  RUN_TEST(testNotGreaterOrEqualHEX8, 3371);
+  RUN_TEST(testGreaterOrEqualHEX16, 3378);
+  RUN_TEST(testNotGreaterOrEqualHEX16, 3400);
+  RUN_TEST(testGreaterOrEqualHEX32, 3407);
+  RUN_TEST(testNotGreaterOrEqualHEX32, 3429);
+  RUN_TEST(testLessThan, 3439);
+  RUN_TEST(testNotLessThan, 3455);
+  RUN_TEST(testLessThanINT, 3462);
+  RUN_TEST(testNotLessThanINT, 3478);
+  RUN_TEST(testLessThanINT8, 3485);
+  RUN_TEST(testNotLessThanINT8, 3501);
+  RUN_TEST(testLessThanINT16, 3508);
+  RUN_TEST(testNotLessThanINT16, 3524);
+  RUN_TEST(testLessThanINT32, 3531);
+  RUN_TEST(testNotLessThanINT32, 3547);
+  RUN_TEST(testLessThanUINT, 3554);
+  RUN_TEST(testNotLessThanUINT, 3570);
+  RUN_TEST(testLessThanUINT8, 3577);
+  RUN_TEST(testNotLessThanUINT8, 3593);
+  RUN_TEST(testLessThanUINT16, 3600);
+  RUN_TEST(testNotLessThanUINT16, 3616);
+  RUN_TEST(testLessThanUINT32, 3623);
+  RUN_TEST(testNotLessThanUINT32, 3639);
+  RUN_TEST(testLessThanHEX8, 3646);
+  RUN_TEST(testNotLessThanHEX8, 3662);
+  RUN_TEST(testLessThanHEX16, 3669);
+  RUN_TEST(testNotLessThanHEX16, 3685);
+  RUN_TEST(testLessThanHEX32, 3692);
+  RUN_TEST(testNotLessThanHEX32, 3708);
+  RUN_TEST(testLessOrEqual, 3715);
+  RUN_TEST(testNotLessOrEqual, 3737);
+  RUN_TEST(testLessOrEqualINT, 3744);
+  RUN_TEST(testNotLessOrEqualINT, 3766);
+  RUN_TEST(testLessOrEqualINT8, 3773);
+  RUN_TEST(testNotLessOrEqualINT8, 3795);
+  RUN_TEST(testLessOrEqualINT16, 3802);
+  RUN_TEST(testNotLessOrEqualINT16, 3824);
+  RUN_TEST(testLessOrEqualINT32, 3831);
+  RUN_TEST(testNotLessOrEqualINT32, 3853);
+  RUN_TEST(testLessOrEqualUINT, 3860);
+  RUN_TEST(testNotLessOrEqualUINT, 3882);
+  RUN_TEST(testLessOrEqualUINT8, 3889);
+  RUN_TEST(testNotLessOrEqualUINT8, 3911);
+  RUN_TEST(testLessOrEqualUINT16, 3918);
+  RUN_TEST(testNotLessOrEqualUINT16, 3940);
+  RUN_TEST(testLessOrEqualUINT32, 3947);
+  RUN_TEST(testNotLessOrEqualUINT32, 3969);
+  RUN_TEST(testLessOrEqualHEX8, 3976);
+  RUN_TEST(testNotLessOrEqualHEX8, 3998);
+  RUN_TEST(testLessOrEqualHEX16, 4005);
+  RUN_TEST(testNotLessOrEqualHEX16, 4027);
+  RUN_TEST(testLessOrEqualHEX32, 4034);
+  RUN_TEST(testNotLessOrEqualHEX32, 4056);
+  RUN_TEST(testEqualStrings, 4064);
+  RUN_TEST(testEqualStringsLen, 4075);
+  RUN_TEST(testEqualStringsWithCarriageReturnsAndLineFeeds, 4085);
+  RUN_TEST(testNotEqualString1, 4096);
+  RUN_TEST(testNotEqualStringLen1, 4103);
+  RUN_TEST(testNotEqualString2, 4110);
+  RUN_TEST(testNotEqualStringLen2, 4117);
+  RUN_TEST(testNotEqualString3, 4124);
+  RUN_TEST(testNotEqualStringLen3, 4131);
+  RUN_TEST(testNotEqualString4, 4138);
+  RUN_TEST(testNotEqualStringLen4, 4145);
+  RUN_TEST(testNotEqualString5, 4152);
+  RUN_TEST(testNotEqualString_ExpectedStringIsNull, 4161);
+  RUN_TEST(testNotEqualStringLen_ExpectedStringIsNull, 4168);
+  RUN_TEST(testNotEqualString_ActualStringIsNull, 4175);
+  RUN_TEST(testNotEqualStringLen_ActualStringIsNull, 4182);
+  RUN_TEST(testNotEqualString_ExpectedStringIsLonger, 4189);
+  RUN_TEST(testNotEqualString_ActualStringIsLonger, 4196);
+  RUN_TEST(testEqualStringArrays, 4203);
+  RUN_TEST(testNotEqualStringArray1, 4214);
+  RUN_TEST(testNotEqualStringArray2, 4224);
+  RUN_TEST(testNotEqualStringArray3, 4234);
+  RUN_TEST(testNotEqualStringArray4, 4244);
+  RUN_TEST(testNotEqualStringArray5, 4254);
+  RUN_TEST(testNotEqualStringArray6, 4264);
+  RUN_TEST(testEqualStringArrayIfBothNulls, 4274);
+  RUN_TEST(testNotEqualStringArrayLengthZero, 4282);
+  RUN_TEST(testEqualStringEachEqual, 4292);
+  RUN_TEST(testNotEqualStringEachEqual1, 4304);
+  RUN_TEST(testNotEqualStringEachEqual2, 4313);
+  RUN_TEST(testNotEqualStringEachEqual3, 4322);
+  RUN_TEST(testNotEqualStringEachEqual4, 4331);
+  RUN_TEST(testNotEqualStringEachEqual5, 4340);
+  RUN_TEST(testEqualMemory, 4347);
+  RUN_TEST(testNotEqualMemory1, 4359);
+  RUN_TEST(testNotEqualMemory2, 4366);
+  RUN_TEST(testNotEqualMemory3, 4373);
+  RUN_TEST(testNotEqualMemory4, 4380);
+  RUN_TEST(testNotEqualMemoryLengthZero, 4387);
+  RUN_TEST(testEqualIntArrays, 4394);
+  RUN_TEST(testNotEqualIntArraysNullExpected, 4409);
+  RUN_TEST(testNotEqualIntArraysNullActual, 4419);
+  RUN_TEST(testNotEqualIntArrays1, 4429);
+  RUN_TEST(testNotEqualIntArrays2, 4439);
+  RUN_TEST(testNotEqualIntArrays3, 4449);
+  RUN_TEST(testNotEqualIntArraysLengthZero, 4459);
+  RUN_TEST(testEqualIntEachEqual, 4469);
+  RUN_TEST(testNotEqualIntEachEqualNullActual, 4483);
+  RUN_TEST(testNotEqualIntEachEqual1, 4492);
+  RUN_TEST(testNotEqualIntEachEqual2, 4501);
+  RUN_TEST(testNotEqualIntEachEqual3, 4510);
+  RUN_TEST(testNotEqualEachEqualLengthZero, 4519);
+  RUN_TEST(testEqualPtrArrays, 4528);
+  RUN_TEST(testNotEqualPtrArraysNullExpected, 4545);
+  RUN_TEST(testNotEqualPtrArraysNullActual, 4557);
+  RUN_TEST(testNotEqualPtrArrays1, 4569);
+  RUN_TEST(testNotEqualPtrArrays2, 4582);
+  RUN_TEST(testNotEqualPtrArrays3, 4595);
+  RUN_TEST(testEqualPtrEachEqual, 4608);
+  RUN_TEST(testNotEqualPtrEachEqualNullExpected, 4625);
+  RUN_TEST(testNotEqualPtrEachEqualNullActual, 4636);
+  RUN_TEST(testNotEqualPtrEachEqual1, 4646);
+  RUN_TEST(testNotEqualPtrEachEqual2, 4657);
+  RUN_TEST(testNotEqualPtrEachEqual3, 4668);
+  RUN_TEST(testEqualInt8Arrays, 4679);
+  RUN_TEST(testNotEqualInt8Arrays, 4693);
+  RUN_TEST(testEqualInt8EachEqual, 4703);
+  RUN_TEST(testNotEqualInt8EachEqual, 4717);
+  RUN_TEST(testEqualUIntArrays, 4726);
+  RUN_TEST(testNotEqualUIntArrays1, 4740);
+  RUN_TEST(testNotEqualUIntArrays2, 4750);
+  RUN_TEST(testNotEqualUIntArrays3, 4760);
+  RUN_TEST(testEqualUIntEachEqual, 4770);
+  RUN_TEST(testNotEqualUIntEachEqual1, 4784);
+  RUN_TEST(testNotEqualUIntEachEqual2, 4793);
+  RUN_TEST(testNotEqualUIntEachEqual3, 4802);
+  RUN_TEST(testEqualInt16Arrays, 4811);
+  RUN_TEST(testNotEqualInt16Arrays, 4825);
+  RUN_TEST(testEqualInt16EachEqual, 4835);
+  RUN_TEST(testNotEqualInt16EachEqual, 4849);
+  RUN_TEST(testEqualInt32Arrays, 4858);
+  RUN_TEST(testNotEqualInt32Arrays, 4872);
+  RUN_TEST(testEqualInt32EachEqual, 4882);
+  RUN_TEST(testNotEqualInt32EachEqual, 4896);
+  RUN_TEST(testEqualUINT8Arrays, 4905);
+  RUN_TEST(testNotEqualUINT8Arrays1, 4919);
+  RUN_TEST(testNotEqualUINT8Arrays2, 4929);
+  RUN_TEST(testNotEqualUINT8Arrays3, 4939);
+  RUN_TEST(testEqualUINT16Arrays, 4950);
+  RUN_TEST(testNotEqualUINT16Arrays1, 4964);
+  RUN_TEST(testNotEqualUINT16Arrays2, 4974);
+  RUN_TEST(testNotEqualUINT16Arrays3, 4984);
+  RUN_TEST(testEqualUINT32Arrays, 4994);
+  RUN_TEST(testNotEqualUINT32Arrays1, 5008);
+  RUN_TEST(testNotEqualUINT32Arrays2, 5018);
+  RUN_TEST(testNotEqualUINT32Arrays3, 5028);
+  RUN_TEST(testEqualHEXArrays, 5038);
+  RUN_TEST(testNotEqualHEXArrays1, 5052);
+  RUN_TEST(testNotEqualHEXArrays2, 5062);
+  RUN_TEST(testNotEqualHEXArrays3, 5072);
+  RUN_TEST(testEqualHEX32Arrays, 5082);
+  RUN_TEST(testNotEqualHEX32Arrays1, 5096);
+  RUN_TEST(testNotEqualHEX32Arrays2, 5106);
+  RUN_TEST(testNotEqualHEX32Arrays3, 5116);
+  RUN_TEST(testEqualHEX16Arrays, 5126);
+  RUN_TEST(testNotEqualHEX16Arrays1, 5140);
+  RUN_TEST(testNotEqualHEX16Arrays2, 5150);
+  RUN_TEST(testNotEqualHEX16Arrays3, 5160);
+  RUN_TEST(testEqualHEX8Arrays, 5170);
+  RUN_TEST(testNotEqualHEX8Arrays1, 5184);
+  RUN_TEST(testNotEqualHEX8Arrays2, 5194);
+  RUN_TEST(testNotEqualHEX8Arrays3, 5204);
+  RUN_TEST(testEqualUINT8EachEqual, 5214);
+  RUN_TEST(testNotEqualUINT8EachEqual1, 5228);
+  RUN_TEST(testNotEqualUINT8EachEqual2, 5237);
+  RUN_TEST(testNotEqualUINT8EachEqual3, 5246);
+  RUN_TEST(testEqualUINT16EachEqual, 5255);
+  RUN_TEST(testNotEqualUINT16EachEqual1, 5269);
+  RUN_TEST(testNotEqualUINT16EachEqual2, 5278);
+  RUN_TEST(testNotEqualUINT16EachEqual3, 5287);
+  RUN_TEST(testEqualUINT32EachEqual, 5296);
+  RUN_TEST(testNotEqualUINT32EachEqual1, 5310);
+  RUN_TEST(testNotEqualUINT32EachEqual2, 5319);
+  RUN_TEST(testNotEqualUINT32EachEqual3, 5328);
+  RUN_TEST(testEqualHEXEachEqual, 5337);
+  RUN_TEST(testNotEqualHEXEachEqual1, 5351);
+  RUN_TEST(testNotEqualHEXEachEqual2, 5360);
+  RUN_TEST(testNotEqualHEXEachEqual3, 5369);
+  RUN_TEST(testEqualHEX32EachEqual, 5378);
+  RUN_TEST(testNotEqualHEX32EachEqual1, 5392);
+  RUN_TEST(testNotEqualHEX32EachEqual2, 5401);
+  RUN_TEST(testNotEqualHEX32EachEqual3, 5410);
+  RUN_TEST(testEqualHEX16EachEqual, 5419);
+  RUN_TEST(testNotEqualHEX16EachEqual1, 5433);
+  RUN_TEST(testNotEqualHEX16EachEqual2, 5442);
+  RUN_TEST(testNotEqualHEX16EachEqual3, 5451);
+  RUN_TEST(testEqualHEX8EachEqual, 5460);
+  RUN_TEST(testNotEqualHEX8EachEqual1, 5474);
+  RUN_TEST(testNotEqualHEX8EachEqual2, 5483);
+  RUN_TEST(testNotEqualHEX8EachEqual3, 5492);
+  RUN_TEST(testEqualMemoryArrays, 5501);
+  RUN_TEST(testNotEqualMemoryArraysExpectedNull, 5515);
+  RUN_TEST(testNotEqualMemoryArraysActualNull, 5525);
+  RUN_TEST(testNotEqualMemoryArrays1, 5535);
+  RUN_TEST(testNotEqualMemoryArrays2, 5545);
+  RUN_TEST(testNotEqualMemoryArrays3, 5555);
+  RUN_TEST(testEqualMemoryEachEqual, 5565);
+  RUN_TEST(testNotEqualMemoryEachEqualExpectedNull, 5580);
+  RUN_TEST(testNotEqualMemoryEachEqualActualNull, 5590);
+  RUN_TEST(testNotEqualMemoryEachEqual1, 5600);
+  RUN_TEST(testNotEqualMemoryEachEqual2, 5610);
+  RUN_TEST(testNotEqualMemoryEachEqual3, 5620);
+  RUN_TEST(testProtection, 5630);
+  RUN_TEST(testIgnoredAndThenFailInTearDown, 5648);
+  RUN_TEST(testFailureCountIncrementsAndIsReturnedAtEnd, 5711);
+  RUN_TEST(testAggregatedRunCombinesCountsOfEachTestFile, 5735);
+  RUN_TEST(testParamsRunEveryEntryAndReportFailingOnes, 5798);
+  RUN_TEST(testParamsNameFailingEntriesWithTheirLabel, 5823);
+  RUN_TEST(testParamsIgnoreTheTestWhenEveryEntryIsIgnored, 5843);
+  RUN_TEST(testParamsCountAsOneTest, 5865);
+  RUN_TEST(testCombinationsRunEveryCombinationOfRangesAndValues, 5920);
+  RUN_TEST(testCombinationsOfAnEmptyAxisAreIgnored, 5945);
+  RUN_TEST(testCombinationsWithTooManyPairsFail, 5958);
+  RUN_TEST(testCombinationsPairwiseCoverEveryPairInFewerCases, 5971);
+  RUN_TEST(testBenchSummarizeFindsMedianMinimumAndDeviation, 6010);
+  RUN_TEST(testBenchSummarizeEstimatesNoise, 6032);
+  RUN_TEST(testBenchMedianIntervalHoldsTheConfidenceLevel, 6053);
+  RUN_TEST(testBigOFitFindsTheComplexityOfTimes, 6066);
+  RUN_TEST(testBenchmarkCalibratesAndReportsItsLoop, 6095);
+  RUN_TEST(testBenchmarkWithoutLoopFails, 6115);
+  RUN_TEST(testBenchmarkABCannotBeHundredPercentFaster, 6126);
+  RUN_TEST(testBenchmarksAreIgnoredWhenDisabled, 6137);
+  RUN_TEST(testHistogramFindsPercentiles, 6150);
+  RUN_TEST(testHistogramCountsSmallValuesExactly, 6172);
+  RUN_TEST(testHistogramHoldsTheLargestValues, 6186);
+  RUN_TEST(testPercentileBelowPasses, 6195);
+  RUN_TEST(testPercentileBelowFailsInTheTail, 6209);
+  RUN_TEST(testPercentileBelowFailsWithoutSamples, 6228);
+  RUN_TEST(testPercentileFailureNamesThePercentile, 6237);
+  RUN_TEST(testHistogramIsPrinted, 6252);
+  RUN_TEST(testExecTimeIsPrintedInAdaptiveUnits, 6282);
+  RUN_TEST(testCstringsEscapeSequence, 6297);
+  RUN_TEST(testHexPrintsUpToMaxNumberOfNibbles, 6309);
+  RUN_TEST(testPrintNumbers32, 6335);
+  RUN_TEST(testPrintNumbersUnsigned32, 6349);
+  RUN_TEST(testPrintNumbersInt64, 6365);
+  RUN_TEST(testPrintNumbersUInt64, 6381);
+  RUN_TEST(testEqualHex64s, 6397);
+  RUN_TEST(testEqualUint64s, 6420);
+  RUN_TEST(testEqualInt64s, 6443);
+  RUN_TEST(testNotEqualHex64s, 6467);
+  RUN_TEST(testNotEqualUint64s, 6483);
+  RUN_TEST(testNotEqualInt64s, 6499);
+  RUN_TEST(testNotEqualHex64sIfSigned, 6515);
+  RUN_TEST(testHEX64sWithinDelta, 6531);
+  RUN_TEST(testHEX64sNotWithinDelta, 6542);
+  RUN_TEST(testHEX64sNotWithinDeltaEvenThoughASignedIntWouldPass, 6553);
+  RUN_TEST(testUINT64sWithinDelta, 6564);
+  RUN_TEST(testUINT64sNotWithinDelta, 6575);
+  RUN_TEST(testUINT64sNotWithinDeltaEvenThoughASignedIntWouldPass, 6586);
+  RUN_TEST(testINT64sWithinDelta, 6597);
+  RUN_TEST(testINT64sNotWithinDelta, 6608);
+  RUN_TEST(testINT64sNotWithinDeltaAndDifferenceOverflows, 6619);
+  RUN_TEST(testEqualHEX64Arrays, 6630);
+  RUN_TEST(testEqualUint64Arrays, 6648);
+  RUN_TEST(testEqualInt64Arrays, 6666);
+  RUN_TEST(testNotEqualHEX64Arrays1, 6685);
+  RUN_TEST(testNotEqualHEX64Arrays2, 6699);
+  RUN_TEST(testNotEqualUint64Arrays, 6713);
+  RUN_TEST(testNotEqualInt64Arrays, 6727);
+  RUN_TEST(testFloatsWithinDelta, 6742);
+  RUN_TEST(testFloatsNotWithinDelta, 6754);
+  RUN_TEST(testFloatsEqual, 6765);
+  RUN_TEST(testFloatsNotEqual, 6777);
+  RUN_TEST(testFloatsNotEqualNegative1, 6788);
+  RUN_TEST(testFloatsNotEqualNegative2, 6799);
+  RUN_TEST(testFloatsNotEqualActualNaN, 6810);
+  RUN_TEST(testFloatsNotEqualExpectedNaN, 6821);
+  RUN_TEST(testFloatsEqualBothNaN, 6832);
+  RUN_TEST(testFloatsNotEqualInfNaN, 6841);
+  RUN_TEST(testFloatsNotEqualNaNInf, 6852);
+  RUN_TEST(testFloatsNotEqualActualInf, 6863);
+  RUN_TEST(testFloatsNotEqualExpectedInf, 6874);
+  RUN_TEST(testFloatsEqualBothInf, 6885);
+  RUN_TEST(testFloatsNotEqualPlusMinusInf, 6894);
+  RUN_TEST(testFloatIsPosInf1, 6905);
+  RUN_TEST(testFloatIsPosInf2, 6914);
+  RUN_TEST(testFloatIsNegInf1, 6925);
+  RUN_TEST(testFloatIsNegInf2, 6934);
+  RUN_TEST(testFloatIsNotPosInf1, 6945);
+  RUN_TEST(testFloatIsNotPosInf2, 6956);
+  RUN_TEST(testFloatIsNotNegInf, 6965);
+  RUN_TEST(testFloatIsNan1, 6976);
+  RUN_TEST(testFloatIsNan2, 6985);
+  RUN_TEST(testFloatIsNotNan1, 6996);
+  RUN_TEST(testFloatIsNotNan2, 7007);
+  RUN_TEST(testFloatInfIsNotNan, 7016);
+  RUN_TEST(testFloatNanIsNotInf, 7027);
+  RUN_TEST(testFloatIsDeterminate1, 7038);
+  RUN_TEST(testFloatIsDeterminate2, 7049);
+  RUN_TEST(testFloatIsNotDeterminate1, 7060);
+  RUN_TEST(testFloatIsNotDeterminate2, 7071);
+  RUN_TEST(testFloatTraitFailsOnInvalidTrait, 7082);
+  RUN_TEST(testEqualFloatArrays, 7094);
+  RUN_TEST(testNotEqualFloatArraysExpectedNull, 7113);
+  RUN_TEST(testNotEqualFloatArraysActualNull, 7127);
+  RUN_TEST(testNotEqualFloatArrays1, 7141);
+  RUN_TEST(testNotEqualFloatArrays2, 7155);
+  RUN_TEST(testNotEqualFloatArrays3, 7169);
+  RUN_TEST(testNotEqualFloatArraysNegative1, 7183);
+  RUN_TEST(testNotEqualFloatArraysNegative2, 7197);
+  RUN_TEST(testNotEqualFloatArraysNegative3, 7211);
+  RUN_TEST(testEqualFloatArraysNaN, 7225);
+  RUN_TEST(testEqualFloatArraysInf, 7237);
+  RUN_TEST(testNotEqualFloatArraysLengthZero, 7249);
+  RUN_TEST(testEqualFloatEachEqual, 7263);
+  RUN_TEST(testNotEqualFloatEachEqualActualNull, 7281);
+  RUN_TEST(testNotEqualFloatEachEqual1, 7294);
+  RUN_TEST(testNotEqualFloatEachEqual2, 7307);
+  RUN_TEST(testNotEqualFloatEachEqual3, 7320);
+  RUN_TEST(testNotEqualFloatEachEqualNegative1, 7333);
+  RUN_TEST(testNotEqualFloatEachEqualNegative2, 7346);
+  RUN_TEST(testNotEqualFloatEachEqualNegative3, 7359);
+  RUN_TEST(testEqualFloatEachEqualNaN, 7372);
+  RUN_TEST(testEqualFloatEachEqualInf, 7383);
+  RUN_TEST(testNotEqualFloatEachEqualLengthZero, 7394);
+  RUN_TEST(testFloatPrinting, 7412);
+  RUN_TEST(testFloatPrintingRoundTiesToEven, 7461);
+  RUN_TEST(testFloatPrintingInfinityAndNaN, 7480);
+  RUN_TEST(testFloatPrintingRandomSamples, 7572);
+  RUN_TEST(testDoublesWithinDelta, 7600);
+  RUN_TEST(testDoublesNotWithinDelta, 7612);
+  RUN_TEST(testDoublesEqual, 7624);
+  RUN_TEST(testDoublesNotEqual, 7636);
+  RUN_TEST(testDoublesNotEqualNegative1, 7647);
+  RUN_TEST(testDoublesNotEqualNegative2, 7658);
+  RUN_TEST(testDoublesNotEqualActualNaN, 7669);
+  RUN_TEST(testDoublesNotEqualExpectedNaN, 7680);
+  RUN_TEST(testDoublesEqualBothNaN, 7691);
+  RUN_TEST(testDoublesNotEqualInfNaN, 7700);
+  RUN_TEST(testDoublesNotEqualNaNInf, 7711);
+  RUN_TEST(testDoublesNotEqualActualInf, 7722);
+  RUN_TEST(testDoublesNotEqualExpectedInf, 7733);
+  RUN_TEST(testDoublesEqualBothInf, 7744);
+  RUN_TEST(testDoublesNotEqualPlusMinusInf, 7753);
+  RUN_TEST(testDoubleIsPosInf1, 7764);
+  RUN_TEST(testDoubleIsPosInf2, 7773);
+  RUN_TEST(testDoubleIsNegInf1, 7784);
+  RUN_TEST(testDoubleIsNegInf2, 7793);
+  RUN_TEST(testDoubleIsNotPosInf1, 7804);
+  RUN_TEST(testDoubleIsNotPosInf2, 7815);
+  RUN_TEST(testDoubleIsNotNegInf, 7824);
+  RUN_TEST(testDoubleIsNan1, 7835);
+  RUN_TEST(testDoubleIsNan2, 7844);
+  RUN_TEST(testDoubleIsNotNan1, 7855);
+  RUN_TEST(testDoubleIsNotNan2, 7866);
+  RUN_TEST(testDoubleInfIsNotNan, 7875);
+  RUN_TEST(testDoubleNanIsNotInf, 7886);
+  RUN_TEST(testDoubleIsDeterminate1, 7897);
+  RUN_TEST(testDoubleIsDeterminate2, 7908);
+  RUN_TEST(testDoubleIsNotDeterminate1, 7919);
+  RUN_TEST(testDoubleIsNotDeterminate2, 7930);
+  RUN_TEST(testDoubleTraitFailsOnInvalidTrait, 7941);
+  RUN_TEST(testEqualDoubleArrays, 7952);
+  RUN_TEST(testNotEqualDoubleArraysExpectedNull, 7971);
+  RUN_TEST(testNotEqualDoubleArraysActualNull, 7985);
+  RUN_TEST(testNotEqualDoubleArrays1, 7999);
+  RUN_TEST(testNotEqualDoubleArrays2, 8013);
+  RUN_TEST(testNotEqualDoubleArrays3, 8027);
+  RUN_TEST(testNotEqualDoubleArraysNegative1, 8041);
+  RUN_TEST(testNotEqualDoubleArraysNegative2, 8055);
+  RUN_TEST(testNotEqualDoubleArraysNegative3, 8069);
+  RUN_TEST(testEqualDoubleArraysNaN, 8083);
+  RUN_TEST(testEqualDoubleArraysInf, 8095);
+  RUN_TEST(testNotEqualDoubleArraysLengthZero, 8107);
+  RUN_TEST(testEqualDoubleEachEqual, 8121);
+  RUN_TEST(testNotEqualDoubleEachEqualActualNull, 8139);
+  RUN_TEST(testNotEqualDoubleEachEqual1, 8152);
+  RUN_TEST(testNotEqualDoubleEachEqual2, 8165);
+  RUN_TEST(testNotEqualDoubleEachEqual3, 8178);
+  RUN_TEST(testNotEqualDoubleEachEqualNegative1, 8191);
+  RUN_TEST(testNotEqualDoubleEachEqualNegative2, 8204);
+  RUN_TEST(testNotEqualDoubleEachEqualNegative3, 8217);
+  RUN_TEST(testEqualDoubleEachEqualNaN, 8230);
+  RUN_TEST(testEqualDoubleEachEqualInf, 8241);
+  RUN_TEST(testNotEqualDoubleEachEqualLengthZero, 8252);
+  RUN_TEST(testDoublePrinting, 8265);
+  RUN_TEST(testDoublePrintingRoundTiesToEven, 8312);
+  RUN_TEST(testDoublePrintingInfinityAndNaN, 8327);
+  RUN_TEST(testThatDetailsCanBeHandleOneDetail, 8341);
+  RUN_TEST(testThatDetailsCanHandleTestFail, 8354);
+  RUN_TEST(testThatDetailsCanBeHandleTwoDetails, 8367);
+  RUN_TEST(testThatDetailsCanBeHandleSingleDetailClearingTwoDetails, 8380);
+
+  return suite_teardown(HuntEnd());
+}
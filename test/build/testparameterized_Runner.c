@@ -0,0 +1,120 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST_NO_ARGS
+#define RUN_TEST(TestFunc, TestLineNum, ...) \
+{ \
+  Hunt.CurrentTestName = #TestFunc "(" #__VA_ARGS__ ")"; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(__VA_ARGS__); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include <setjmp.h>
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_TheseShouldAllPass(int Num);
+extern void test_TheseShouldAllFail(int Num);
+extern void test_TheseAreEveryOther(int Num);
+extern void test_NormalPassesStillWork(void);
+extern void test_NormalFailsStillWork(void);
+extern void test_StringsArePreserved(unsigned index, const char * str);
+extern void test_CharsArePreserved(unsigned index, char c);
+extern void test_TablesRunEveryEntry(void);
+extern void test_TablesRunAsOneTest(void);
+extern void test_CombinationsRunEveryCombination(void);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("tests/testparameterized.c");
+  RUN_TEST(test_TheseShouldAllPass, 78, 0);
+  RUN_TEST(test_TheseShouldAllPass, 78, 44);
+  RUN_TEST(test_TheseShouldAllPass, 78, (90)+9);
+  RUN_TEST(test_TheseShouldAllFail, 86, 3);
+  RUN_TEST(test_TheseShouldAllFail, 86, 77);
+  RUN_TEST(test_TheseShouldAllFail, 86,  (99) + 1 - (1));
+  RUN_TEST(test_TheseAreEveryOther, 97, 1);
+  RUN_TEST(test_TheseAreEveryOther, 97, 44);
+  RUN_TEST(test_TheseAreEveryOther, 97, 99);
+  RUN_TEST(test_TheseAreEveryOther, 97, 98);
+  RUN_TEST(test_NormalPassesStillWork, 111, RUN_TEST_NO_ARGS);
+  RUN_TEST(test_NormalFailsStillWork, 116, RUN_TEST_NO_ARGS);
+  RUN_TEST(test_StringsArePreserved, 128, 0, "abc");
+  RUN_TEST(test_StringsArePreserved, 128, 1, "{");
+  RUN_TEST(test_StringsArePreserved, 128, 2, "}");
+  RUN_TEST(test_StringsArePreserved, 128, 3, ";");
+  RUN_TEST(test_StringsArePreserved, 128, 4, "\"quoted\"");
+  RUN_TEST(test_CharsArePreserved, 153, 0, 'x');
+  RUN_TEST(test_CharsArePreserved, 153, 1, '{');
+  RUN_TEST(test_CharsArePreserved, 153, 2, '}');
+  RUN_TEST(test_CharsArePreserved, 153, 3, ';');
+  RUN_TEST(test_CharsArePreserved, 153, 4, '\'');
+  RUN_TEST(test_CharsArePreserved, 153, 5, '"');
+  RUN_TEST(test_TablesRunEveryEntry, 185, RUN_TEST_NO_ARGS);
+  RUN_TEST(test_TablesRunAsOneTest, 191, RUN_TEST_NO_ARGS);
+  RUN_TEST(test_CombinationsRunEveryCombination, 199, RUN_TEST_NO_ARGS);
+
+  return suite_teardown(HuntEnd());
+}
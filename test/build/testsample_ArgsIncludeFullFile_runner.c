@@ -0,0 +1,137 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Hunt.CurrentTestName = #TestFunc; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  if (HuntTestMatches()) { \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+  } \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include "Defs.h"
+#include "CException.h"
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ThisTestAlwaysPasses(void);
+extern void test_ThisTestAlwaysFails(void);
+extern void test_ThisTestAlwaysIgnored(void);
+extern void spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan(void);
+extern void spec_ThisTestPassesWhenNormalSetupRan(void);
+extern void spec_ThisTestPassesWhenNormalTeardownRan(void);
+extern void test_NotBeConfusedByLongComplicatedStrings(void);
+extern void test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings(void);
+extern void test_StillNotBeConfusedByLongComplicatedStrings(void);
+extern void should_RunTestsStartingWithShouldByDefault(void);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+ int main(int argc, char** argv)
+{
+  int parse_status = HuntParseOptions(argc, argv);
+  if (parse_status != 0)
+  {
+    if (parse_status < 0)
+    {
+      HuntPrint("testdata/testRunnerGenerator.");
+      HUNT_PRINT_EOL();
+      HuntPrint("  test_ThisTestAlwaysPasses");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_ThisTestAlwaysFails");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_ThisTestAlwaysIgnored");
+    HUNT_PRINT_EOL();
+      HuntPrint("  spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan");
+    HUNT_PRINT_EOL();
+      HuntPrint("  spec_ThisTestPassesWhenNormalSetupRan");
+    HUNT_PRINT_EOL();
+      HuntPrint("  spec_ThisTestPassesWhenNormalTeardownRan");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_NotBeConfusedByLongComplicatedStrings");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_StillNotBeConfusedByLongComplicatedStrings");
+    HUNT_PRINT_EOL();
+      HuntPrint("  should_RunTestsStartingWithShouldByDefault");
+    HUNT_PRINT_EOL();
+    return 0;
+    }
+  return parse_status;
+  }
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("testdata/testRunnerGenerator.c");
+  RUN_TEST(test_ThisTestAlwaysPasses, 61);
+  RUN_TEST(test_ThisTestAlwaysFails, 66);
+  RUN_TEST(test_ThisTestAlwaysIgnored, 71);
+  RUN_TEST(spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan, 86);
+  RUN_TEST(spec_ThisTestPassesWhenNormalSetupRan, 91);
+  RUN_TEST(spec_ThisTestPassesWhenNormalTeardownRan, 96);
+  RUN_TEST(test_NotBeConfusedByLongComplicatedStrings, 116);
+  RUN_TEST(test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings, 124);
+  RUN_TEST(test_StillNotBeConfusedByLongComplicatedStrings, 131);
+  RUN_TEST(should_RunTestsStartingWithShouldByDefault, 138);
+
+  return suite_teardown(HuntEnd());
+}
@@ -0,0 +1,120 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST_NO_ARGS
+#define RUN_TEST(TestFunc, TestLineNum, ...) \
+{ \
+  Hunt.CurrentTestName = #TestFunc "(" #__VA_ARGS__ ")"; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  if (HuntTestMatches()) { \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(__VA_ARGS__); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+  } \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include "Defs.h"
+#include "CException.h"
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void paratest_ShouldHandleParameterizedTests(int Num);
+extern void paratest_ShouldHandleParameterizedTests2(int Num);
+extern void paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid(void);
+extern void paratest_ShouldHandleParameterizedTestsThatFail(int Num);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+ int main(int argc, char** argv)
+{
+  int parse_status = HuntParseOptions(argc, argv);
+  if (parse_status != 0)
+  {
+    if (parse_status < 0)
+    {
+      HuntPrint("testdata/testRunnerGenerator.");
+      HUNT_PRINT_EOL();
+      HuntPrint("  paratest_ShouldHandleParameterizedTests(25)");
+      HUNT_PRINT_EOL();
+      HuntPrint("  paratest_ShouldHandleParameterizedTests(125)");
+      HUNT_PRINT_EOL();
+      HuntPrint("  paratest_ShouldHandleParameterizedTests(5)");
+      HUNT_PRINT_EOL();
+      HuntPrint("  paratest_ShouldHandleParameterizedTests2(7)");
+      HUNT_PRINT_EOL();
+      HuntPrint("  paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid(RUN_TEST_NO_ARGS)");
+      HUNT_PRINT_EOL();
+      HuntPrint("  paratest_ShouldHandleParameterizedTestsThatFail(17)");
+      HUNT_PRINT_EOL();
+    return 0;
+    }
+  return parse_status;
+  }
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("testdata/testRunnerGenerator.c");
+  RUN_TEST(paratest_ShouldHandleParameterizedTests, 146, 25);
+  RUN_TEST(paratest_ShouldHandleParameterizedTests, 146, 125);
+  RUN_TEST(paratest_ShouldHandleParameterizedTests, 146, 5);
+  RUN_TEST(paratest_ShouldHandleParameterizedTests2, 152, 7);
+  RUN_TEST(paratest_ShouldHandleNonParameterizedTestsWhenParameterizationValid, 157, RUN_TEST_NO_ARGS);
+  RUN_TEST(paratest_ShouldHandleParameterizedTestsThatFail, 163, 17);
+
+  return suite_teardown(HuntEnd());
+}
@@ -0,0 +1,116 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Hunt.CurrentTestName = #TestFunc; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  if (HuntTestMatches()) { \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+  } \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include "Defs.h"
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ThisTestAlwaysPasses(void);
+extern void test_ThisTestAlwaysFails(void);
+extern void test_ThisTestAlwaysIgnored(void);
+extern void spec_ThisTestPassesWhenNormalSetupRan(void);
+extern void spec_ThisTestPassesWhenNormalTeardownRan(void);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+ int main(int argc, char** argv)
+{
+  int parse_status = HuntParseOptions(argc, argv);
+  if (parse_status != 0)
+  {
+    if (parse_status < 0)
+    {
+      HuntPrint("testdata/testRunnerGeneratorSmall.");
+      HUNT_PRINT_EOL();
+      HuntPrint("  test_ThisTestAlwaysPasses");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_ThisTestAlwaysFails");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_ThisTestAlwaysIgnored");
+    HUNT_PRINT_EOL();
+      HuntPrint("  spec_ThisTestPassesWhenNormalSetupRan");
+    HUNT_PRINT_EOL();
+      HuntPrint("  spec_ThisTestPassesWhenNormalTeardownRan");
+    HUNT_PRINT_EOL();
+    return 0;
+    }
+  return parse_status;
+  }
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("testdata/testRunnerGeneratorSmall.c");
+  RUN_TEST(test_ThisTestAlwaysPasses, 46);
+  RUN_TEST(test_ThisTestAlwaysFails, 51);
+  RUN_TEST(test_ThisTestAlwaysIgnored, 56);
+  RUN_TEST(spec_ThisTestPassesWhenNormalSetupRan, 61);
+  RUN_TEST(spec_ThisTestPassesWhenNormalTeardownRan, 66);
+
+  return suite_teardown(HuntEnd());
+}
@@ -0,0 +1,117 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Hunt.CurrentTestName = #TestFunc; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  if (HuntTestMatches()) { \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+  } \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include <stdio.h>
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_QuickTestIsWithinItsBudget(void);
+extern void test_SlowTestExceedsItsBudget(void);
+extern void test_SlowTestWithoutBudgetPasses(void);
+extern void test_QuickTestIsBelowItsAssertedTime(void);
+extern void test_SlowTestIsNotBelowItsAssertedTime(void);
+
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  tearDown();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+ int main(int argc, char** argv)
+{
+  int parse_status = HuntParseOptions(argc, argv);
+  if (parse_status != 0)
+  {
+    if (parse_status < 0)
+    {
+      HuntPrint("testdata/testTimeBudget.");
+      HUNT_PRINT_EOL();
+      HuntPrint("  test_QuickTestIsWithinItsBudget");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_SlowTestExceedsItsBudget");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_SlowTestWithoutBudgetPasses");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_QuickTestIsBelowItsAssertedTime");
+    HUNT_PRINT_EOL();
+      HuntPrint("  test_SlowTestIsNotBelowItsAssertedTime");
+    HUNT_PRINT_EOL();
+    return 0;
+    }
+  return parse_status;
+  }
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("testdata/testTimeBudget.c");
+  HUNT_SET_TIME_BUDGET(1000000000);
+  RUN_TEST(test_QuickTestIsWithinItsBudget, 28);
+  HUNT_SET_TIME_BUDGET(5000000);
+  RUN_TEST(test_SlowTestExceedsItsBudget, 34);
+  RUN_TEST(test_SlowTestWithoutBudgetPasses, 39);
+  RUN_TEST(test_QuickTestIsBelowItsAssertedTime, 44);
+  RUN_TEST(test_SlowTestIsNotBelowItsAssertedTime, 50);
+
+  return suite_teardown(HuntEnd());
+}
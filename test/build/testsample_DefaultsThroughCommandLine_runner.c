@@ -0,0 +1,131 @@
+/* AUTOGENERATED FILE. DO NOT EDIT. */
+
+/*=======Test Runner Used To Run Each Test Below=====*/
+#define RUN_TEST(TestFunc, TestLineNum) \
+{ \
+  Hunt.CurrentTestName = #TestFunc; \
+  Hunt.CurrentTestLineNumber = TestLineNum; \
+  Hunt.NumberOfTests++; \
+  HUNT_TRACE_TEST_START(); \
+  HUNT_RUSAGE_START(); \
+  HUNT_EXEC_TIME_START(); \
+  HUNT_PERF_COUNTERS_START(); \
+  CMock_Init(); \
+  HUNT_CLR_DETAILS(); \
+  if (TEST_PROTECT()) \
+  { \
+      HUNT_PHASE_START(HUNT_PHASE_SETUP); \
+      setUp(); \
+      HUNT_PHASE_START(HUNT_PHASE_TEST); \
+      TestFunc(); \
+  } \
+  if (TEST_PROTECT()) \
+  { \
+    HUNT_PHASE_START(HUNT_PHASE_TEARDOWN); \
+    tearDown(); \
+    HUNT_PHASE_START(HUNT_PHASE_VERIFY); \
+    CMock_Verify(); \
+  } \
+  HUNT_PHASE_STOP(); \
+  CMock_Destroy(); \
+  HUNT_PERF_COUNTERS_STOP(); \
+  HUNT_EXEC_TIME_STOP(); \
+  HUNT_RUSAGE_STOP(); \
+  HuntConcludeTest(); \
+}
+
+/*=======Automagically Detected Files To Include=====*/
+#define HUNT_INCLUDE_SETUP_STUBS
+#include "hunt.h"
+#include "cmock.h"
+#ifndef HUNT_EXCLUDE_SETJMP_H
+#include <setjmp.h>
+#endif
+#include <stdio.h>
+#include "Defs.h"
+#include "CException.h"
+#include <stdio.h>
+#include "mockMock.h"
+
+/*=======External Functions This Runner Calls=====*/
+extern void setUp(void);
+extern void tearDown(void);
+extern void test_ThisTestAlwaysPasses(void);
+extern void test_ThisTestAlwaysFails(void);
+extern void test_ThisTestAlwaysIgnored(void);
+extern void spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan(void);
+extern void spec_ThisTestPassesWhenNormalSetupRan(void);
+extern void spec_ThisTestPassesWhenNormalTeardownRan(void);
+extern void test_NotBeConfusedByLongComplicatedStrings(void);
+extern void test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings(void);
+extern void test_StillNotBeConfusedByLongComplicatedStrings(void);
+extern void should_RunTestsStartingWithShouldByDefault(void);
+extern void test_ShouldCallMockInitAndVerifyFunctionsForEachTest(void);
+
+
+/*=======Mock Management=====*/
+static void CMock_Init(void)
+{
+  mockMock_Init();
+}
+static void CMock_Verify(void)
+{
+  mockMock_Verify();
+}
+static void CMock_Destroy(void)
+{
+  mockMock_Destroy();
+}
+
+/*=======Suite Setup=====*/
+static void suite_setup(void)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  suiteSetUp();
+#endif
+}
+
+/*=======Suite Teardown=====*/
+static int suite_teardown(int num_failures)
+{
+#if defined(HUNT_WEAK_ATTRIBUTE) || defined(HUNT_WEAK_PRAGMA)
+  return suiteTearDown(num_failures);
+#else
+  return num_failures;
+#endif
+}
+
+/*=======Test Reset Option=====*/
+void resetTest(void);
+void resetTest(void)
+{
+  CMock_Verify();
+  CMock_Destroy();
+  tearDown();
+  CMock_Init();
+  setUp();
+}
+
+
+/*=======MAIN=====*/
+int main(void)
+{
+  HUNT_TRACE_BEGIN("suiteSetUp", "suite");
+  suite_setup();
+  HUNT_TRACE_END();
+  HuntBegin("testdata/testRunnerGeneratorWithMocks.c");
+  RUN_TEST(test_ThisTestAlwaysPasses, 62);
+  RUN_TEST(test_ThisTestAlwaysFails, 67);
+  RUN_TEST(test_ThisTestAlwaysIgnored, 72);
+  RUN_TEST(spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan, 87);
+  RUN_TEST(spec_ThisTestPassesWhenNormalSetupRan, 92);
+  RUN_TEST(spec_ThisTestPassesWhenNormalTeardownRan, 97);
+  RUN_TEST(test_NotBeConfusedByLongComplicatedStrings, 117);
+  RUN_TEST(test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings, 124);
+  RUN_TEST(test_StillNotBeConfusedByLongComplicatedStrings, 129);
+  RUN_TEST(should_RunTestsStartingWithShouldByDefault, 136);
+  RUN_TEST(test_ShouldCallMockInitAndVerifyFunctionsForEachTest, 187);
+
+  CMock_Guts_MemFreeFinal();
+  return suite_teardown(HuntEnd());
+}
@@ -0,0 +1,33 @@
+/* ==========================================
+    Hunt Project - A Test Framework for C
+    Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+    [Released under MIT License. Please refer to license.txt for details]
+========================================== */
+
+#include <stdio.h>
+#include "hunt.h"
+
+/* Include Passthroughs for Linking Tests (once for the whole aggregated binary) */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+static int FirstSetupCalls = 0;
+
+void setUp(void)
+{
+    FirstSetupCalls++;
+}
+
+void tearDown(void)
+{
+}
+
+void test_FirstFileRunsItsOwnSetup(void)
+{
+    TEST_ASSERT_EQUAL(1, FirstSetupCalls);
+}
+
+void test_FirstFileCountsEachSetup(void)
+{
+    TEST_ASSERT_EQUAL(2, FirstSetupCalls);
+}
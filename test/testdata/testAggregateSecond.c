@@ -0,0 +1,33 @@
+/* ==========================================
+    Hunt Project - A Test Framework for C
+    Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+    [Released under MIT License. Please refer to license.txt for details]
+========================================== */
+
+#include "hunt.h"
+
+static int SecondSetupCalls = 0;
+
+void setUp(void)
+{
+    SecondSetupCalls++;
+}
+
+void tearDown(void)
+{
+}
+
+void test_SecondFileRunsItsOwnSetup(void)
+{
+    TEST_ASSERT_EQUAL(1, SecondSetupCalls);
+}
+
+void test_SecondFileFails(void)
+{
+    TEST_FAIL_MESSAGE("Expected failure");
+}
+
+void test_SecondFileIgnores(void)
+{
+    TEST_IGNORE();
+}
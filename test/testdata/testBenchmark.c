@@ -0,0 +1,51 @@
+/* This Test File Is Used To Verify Benchmarks Against A Baseline */
+
+#include <stdio.h>
+#include "hunt.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+static volatile unsigned Sink;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void Spin(void)
+{
+    unsigned i;
+    for (i = 0; i < 100; i++)
+    {
+        Sink += i;
+    }
+}
+
+TEST_BENCHMARK(test_SpinIsFasterThanItsBaseline)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Spin();
+    }
+}
+
+TEST_BENCHMARK(test_SpinIsSlowerThanItsBaseline)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Spin();
+    }
+}
+
+TEST_BENCHMARK(test_SpinHasNoBaseline)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Spin();
+    }
+}
@@ -0,0 +1,49 @@
+/* This Test File Is Used To Verify A/B Benchmarks */
+
+#include <stdio.h>
+#include "hunt.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+static volatile unsigned Sink;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void Spin(unsigned count)
+{
+    unsigned i;
+    for (i = 0; i < count; i++)
+    {
+        Sink += i;
+    }
+}
+
+static void SpinLong(HuntBenchState *state)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Spin(400);
+    }
+}
+
+static void SpinShort(HuntBenchState *state)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Spin(100);
+    }
+}
+
+TEST_BENCHMARK_AB_FASTER(test_ShortSpinIsFaster, SpinLong, SpinShort, 50);
+
+TEST_BENCHMARK_AB_FASTER(test_SameSpinIsNotFaster, SpinLong, SpinLong, 10);
+
+TEST_BENCHMARK_AB(test_SpinsAreCompared, SpinShort, SpinLong);
@@ -0,0 +1,44 @@
+/* This Test File Is Used To Verify Benchmarks With Cold Caches */
+
+#include <stdio.h>
+#include "hunt.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+#define TABLE_SIZE 4096
+
+static unsigned Table[TABLE_SIZE];
+static volatile unsigned Sink;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void Walk(void)
+{
+    unsigned i;
+    for (i = 0; i < TABLE_SIZE; i += 16)
+    {
+        Sink += Table[i];
+    }
+}
+
+TEST_BENCHMARK_COLD(test_WalkIsMeasuredColdAndWarm)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Walk();
+    }
+}
+
+TEST_BENCHMARK_COLD(test_ColdBenchmarkNeedsALoop)
+{
+    (void)state;
+    Walk();
+}
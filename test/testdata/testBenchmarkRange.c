@@ -0,0 +1,73 @@
+/* This Test File Is Used To Verify Benchmark Sweeps And Their Complexity */
+
+#include <stdio.h>
+#include "hunt.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+static volatile unsigned Sink;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+static void Sum(HUNT_UINT n)
+{
+    HUNT_UINT i;
+    for (i = 0; i < n; i++)
+    {
+        Sink += (unsigned)i;
+    }
+}
+
+static void SumPairs(HUNT_UINT n)
+{
+    HUNT_UINT i, j;
+    for (i = 0; i < n; i++)
+    {
+        for (j = 0; j < n; j++)
+        {
+            Sink += (unsigned)(i ^ j);
+        }
+    }
+}
+
+TEST_BENCHMARK_COMPLEXITY(test_SumIsLinear, 256, 1 << 16, 4, HUNT_BIG_O_N)
+{
+    HUNT_BENCH_ITEMS(state, state->Size);
+    HUNT_BENCH_LOOP(state)
+    {
+        Sum(state->Size);
+    }
+}
+
+TEST_BENCHMARK_COMPLEXITY(test_SumPairsIsQuadratic, 16, 512, 2, HUNT_BIG_O_N_SQUARED)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        SumPairs(state->Size);
+    }
+}
+
+TEST_BENCHMARK_COMPLEXITY(test_SumIsNotConstant, 256, 1 << 16, 4, HUNT_BIG_O_1)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        Sum(state->Size);
+    }
+}
+
+TEST_BENCHMARK_RANGE(test_SumReportsItsBytes, 1000, 5000, 10)
+{
+    HUNT_BENCH_BYTES(state, state->Size * sizeof(unsigned));
+    HUNT_BENCH_LOOP(state)
+    {
+        Sum(state->Size);
+    }
+}
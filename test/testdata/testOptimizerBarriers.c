@@ -0,0 +1,29 @@
+/* This Test File Is Compiled To Assembly, To Verify The Optimizer Barriers Keep Their Computations */
+
+#include "hunt.h"
+
+#ifdef WITHOUT_BARRIERS
+#undef HUNT_DO_NOT_OPTIMIZE
+#undef HUNT_CLOBBER_MEMORY
+#define HUNT_DO_NOT_OPTIMIZE(value) ((void)(value))
+#define HUNT_CLOBBER_MEMORY()
+#endif
+
+/* The product is never used, but has to be computed for the barrier */
+void multiplyIsKept(unsigned seed);
+void multiplyIsKept(unsigned seed)
+{
+    unsigned product = seed * 2654435761u;
+    HUNT_DO_NOT_OPTIMIZE(product);
+}
+
+/* The buffer is never read again, but has to be written before the barrier */
+void storeIsKept(void);
+void storeIsKept(void)
+{
+    unsigned buffer[4];
+    unsigned *escaped = buffer;
+    HUNT_DO_NOT_OPTIMIZE(escaped);
+    buffer[0] = 625341585u;
+    HUNT_CLOBBER_MEMORY();
+}
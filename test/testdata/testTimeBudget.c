@@ -0,0 +1,54 @@
+/* This Test File Is Used To Verify Time Budgets Of Tests */
+
+#include <stdio.h>
+#include "hunt.h"
+
+/* Include Passthroughs for Linking Tests */
+void putcharSpy(int c) { (void)putchar(c);}
+void flushSpy(void) {}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+/* Waits for the clock rather than counting, so that optimizing can't shorten it */
+static void Spin(HUNT_UINT ns)
+{
+    HUNT_UINT start = (HUNT_UINT)HUNT_CLOCK_NS();
+    while (((HUNT_UINT)HUNT_CLOCK_NS() - start) < ns)
+    {
+    }
+}
+
+TEST_TIME_BUDGET(1000000000)
+void test_QuickTestIsWithinItsBudget(void)
+{
+    Spin(1000);
+}
+
+TEST_TIME_BUDGET(5000000)
+void test_SlowTestExceedsItsBudget(void)
+{
+    Spin(20000000);
+}
+
+void test_SlowTestWithoutBudgetPasses(void)
+{
+    Spin(20000000);
+}
+
+void test_QuickTestIsBelowItsAssertedTime(void)
+{
+    Spin(1000);
+    TEST_ASSERT_EXEC_TIME_BELOW(1000000000);
+}
+
+void test_SlowTestIsNotBelowItsAssertedTime(void)
+{
+    Spin(20000000);
+    TEST_ASSERT_EXEC_TIME_BELOW(5000000);
+}
@@ -1055,6 +1055,50 @@ RUNNER_TESTS = [
     }
   },
 
+  { :name => 'ArgsIncludeExactTest',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-e test_NotBeConfusedByLongComplicatedStrings",
+    :expected => {
+      :to_pass => [ 'test_NotBeConfusedByLongComplicatedStrings' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsIncludeExactTestIgnoresPartialNames',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-e=ThisTestAlwaysPasses",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsIncludeExactParameterizedCase',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :cmdline => "--use_param_tests=1",
+    :yaml => {
+      :cmdline_args => true,
+      :test_prefix => "paratest"
+    },
+    :cmdline_args => "-e \"paratest_ShouldHandleParameterizedTests(5)\"",
+    :expected => {
+      :to_pass => [ 'paratest_ShouldHandleParameterizedTests\(5\)' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
   { :name => 'ArgsList',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
@@ -1135,6 +1179,237 @@ RUNNER_TESTS = [
     }
   },
 
+  { :name => 'ArgsBenchmarksPassWithoutBaseline',
+    :testfile => 'testdata/testBenchmark.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--bench-save=build/testBenchmarkSaved.txt",
+    :expected => {
+      :to_pass => [ 'test_SpinIsFasterThanItsBaseline', 'test_SpinIsSlowerThanItsBaseline', 'test_SpinHasNoBaseline' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsBenchmarksFailWhenSlowerThanBaseline',
+    :testfile => 'testdata/testBenchmark.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--bench-compare=testdata/testBenchmarkBaseline.txt --bench-threshold=5%",
+    :expected => {
+      :to_pass => [ 'test_SpinIsFasterThanItsBaseline', 'test_SpinHasNoBaseline' ],
+      :to_fail => [ 'test_SpinIsSlowerThanItsBaseline' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'PerfCountersKeepResultsOfTests',
+    :testfile => 'testdata/testRunnerGeneratorSmall.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_PERF_COUNTERS'],
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan' ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'RusageKeepResultsOfTests',
+    :testfile => 'testdata/testRunnerGeneratorSmall.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_RUSAGE', 'HUNT_INCLUDE_EXEC_TIME'],
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan' ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'PhaseTimesKeepResultsOfTests',
+    :testfile => 'testdata/testRunnerGeneratorWithMocks.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_PHASE_TIMES', 'HUNT_INCLUDE_EXEC_TIME'],
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan',
+                    'test_NotBeConfusedByLongComplicatedStrings',
+                    'test_NotDisappearJustBecauseTheTestBeforeAndAfterHaveCrazyStrings',
+                    'test_StillNotBeConfusedByLongComplicatedStrings',
+                    'should_RunTestsStartingWithShouldByDefault',
+                    'spec_ThisTestPassesWhenNormalSuiteSetupAndTeardownRan',
+                    'test_ShouldCallMockInitAndVerifyFunctionsForEachTest',
+                  ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'PerfCountersKeepResultsOfBenchmarks',
+    :testfile => 'testdata/testBenchmark.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_PERF_COUNTERS', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000'],
+    :expected => {
+      :to_pass => [ 'test_SpinIsFasterThanItsBaseline', 'test_SpinIsSlowerThanItsBaseline', 'test_SpinHasNoBaseline' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'BenchmarkSweepsFitTheirComplexity',
+    :testfile => 'testdata/testBenchmarkRange.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000'],
+    :expected => {
+      :to_pass => [ 'test_SumIsLinear', 'test_SumPairsIsQuadratic', 'test_SumReportsItsBytes' ],
+      :to_fail => [ 'test_SumIsNotConstant' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'BenchmarksCompareTwoImplementations',
+    :testfile => 'testdata/testBenchmarkAB.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000'],
+    :expected => {
+      :to_pass => [ 'test_ShortSpinIsFaster', 'test_SpinsAreCompared' ],
+      :to_fail => [ 'test_SameSpinIsNotFaster' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'BenchmarksMeasureColdCaches',
+    :testfile => 'testdata/testBenchmarkCold.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000', 'HUNT_BENCH_CACHE_BYTES=4194304'],
+    :expected => {
+      :to_pass => [ 'test_WalkIsMeasuredColdAndWarm' ],
+      :to_fail => [ 'test_ColdBenchmarkNeedsALoop' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'BenchmarksStillRunWhenTheyCannotBePinned',
+    :testfile => 'testdata/testBenchmark.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_BENCHMARK', 'HUNT_BENCH_MIN_NS=1000000', 'HUNT_PIN_CPU=4095'],
+    :expected => {
+      :to_pass => [ 'test_SpinIsFasterThanItsBaseline', 'test_SpinIsSlowerThanItsBaseline', 'test_SpinHasNoBaseline' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'TimeBudgetsFailSlowTests',
+    :testfile => 'testdata/testTimeBudget.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_EXEC_TIME'],
+    :expected => {
+      :to_pass => [ 'test_QuickTestIsWithinItsBudget', 'test_SlowTestWithoutBudgetPasses', 'test_QuickTestIsBelowItsAssertedTime' ],
+      :to_fail => [ 'test_SlowTestExceedsItsBudget', 'test_SlowTestIsNotBelowItsAssertedTime' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'SlowestTestsAreListedAtTheEnd',
+    :testfile => 'testdata/testTimeBudget.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_EXEC_TIME', 'HUNT_SLOWEST_TESTS=2'],
+    :expected => {
+      :to_pass => [ 'test_QuickTestIsWithinItsBudget', 'test_SlowTestWithoutBudgetPasses', 'test_QuickTestIsBelowItsAssertedTime' ],
+      :to_fail => [ 'test_SlowTestExceedsItsBudget', 'test_SlowTestIsNotBelowItsAssertedTime' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsTraceKeepsResultsOfTests',
+    :testfile => 'testdata/testRunnerGeneratorSmall.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_TRACE', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--trace=build/testRunnerGeneratorSmall.trace.json",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan' ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsProfileKeepsResultsOfTests',
+    :testfile => 'testdata/testRunnerGeneratorSmall.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_PROFILER', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--profile=build/testRunnerGeneratorSmall.folded",
+    :expected => {
+      :to_pass => [ 'test_ThisTestAlwaysPasses',
+                    'spec_ThisTestPassesWhenNormalSetupRan',
+                    'spec_ThisTestPassesWhenNormalTeardownRan' ],
+      :to_fail => [ 'test_ThisTestAlwaysFails' ],
+      :to_ignore => [ 'test_ThisTestAlwaysIgnored' ],
+    }
+  },
+
+  { :name => 'ArgsTimeBudgetsAreScaled',
+    :testfile => 'testdata/testTimeBudget.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_EXEC_TIME', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--time-budget-scale=1000%",
+    :expected => {
+      :to_pass => [ 'test_QuickTestIsWithinItsBudget', 'test_SlowTestExceedsItsBudget', 'test_SlowTestWithoutBudgetPasses',
+                    'test_QuickTestIsBelowItsAssertedTime', 'test_SlowTestIsNotBelowItsAssertedTime' ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsTimeBudgetsStayWithTheirTestsWhenExcluded',
+    :testfile => 'testdata/testTimeBudget.c',
+    :testdefines => ['TEST', 'HUNT_INCLUDE_EXEC_TIME', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-x test_SlowTestExceedsItsBudget",
+    :expected => {
+      :to_pass => [ 'test_QuickTestIsWithinItsBudget', 'test_SlowTestWithoutBudgetPasses', 'test_QuickTestIsBelowItsAssertedTime' ],
+      :to_fail => [ 'test_SlowTestIsNotBelowItsAssertedTime' ],
+      :to_ignore => [ ],
+    }
+  },
+
+  { :name => 'ArgsBenchmarksIgnoredWhenDisabled',
+    :testfile => 'testdata/testBenchmark.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "--bench-compare=testdata/testBenchmarkBaseline.txt",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ 'test_SpinIsFasterThanItsBaseline', 'test_SpinIsSlowerThanItsBaseline', 'test_SpinHasNoBaseline' ],
+    }
+  },
+
+  { :name => 'ArgsIncompleteExactFlags',
+    :testfile => 'testdata/testRunnerGenerator.c',
+    :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
+    :options => {
+      :cmdline_args => true,
+    },
+    :cmdline_args => "-e",
+    :expected => {
+      :to_pass => [ ],
+      :to_fail => [ ],
+      :to_ignore => [ ],
+      :text => [ "ERROR: No Test Name to Include Exactly" ],
+    }
+  },
+
   { :name => 'ArgsIllegalFlags',
     :testfile => 'testdata/testRunnerGenerator.c',
     :testdefines => ['TEST', 'HUNT_USE_COMMAND_LINE_ARGS'],
@@ -0,0 +1,112 @@
+# ==========================================
+#   Hunt Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+
+require '../auto/generate_test_runner.rb'
+require 'fileutils'
+
+$generate_batch_tests = 0
+$generate_batch_failures = 0
+
+BATCH_DIR = 'build/batch/'
+BATCH_FILES = [
+  'testdata/testRunnerGenerator.c',
+  'testdata/testRunnerGeneratorSmall.c',
+  'testdata/testRunnerGeneratorWithMocks.c'
+]
+
+def batch_jobs
+  BATCH_FILES.map { |f| [f, HuntTestRunnerGenerator.default_runner_name(f, BATCH_DIR)] }
+end
+
+def batch_mtimes
+  batch_jobs.map { |_input, output| File.mtime(output) }
+end
+
+def batch_check(name)
+  should "Batch_#{name}" do
+    if yield
+      report "Batch_#{name}:PASS"
+    else
+      report "Batch_#{name}:FAIL"
+      $generate_batch_failures += 1
+    end
+    $generate_batch_tests += 1
+  end
+end
+
+FileUtils.rm_rf(BATCH_DIR)
+FileUtils.mkdir_p(BATCH_DIR)
+
+batch_check('GeneratesEveryRunnerOnFirstPass') do
+  result = HuntTestRunnerGenerator.new(jobs: 2).run_batch(batch_jobs)
+  (result[:generated].sort == batch_jobs.map(&:last).sort) && result[:skipped].empty?
+end
+
+batch_check('MatchesRunnersGeneratedOneAtATime') do
+  batch_jobs.all? do |input, output|
+    single = BATCH_DIR + 'single_' + File.basename(output)
+    HuntTestRunnerGenerator.new.run(input, single)
+    File.read(single) == File.read(output)
+  end
+end
+
+batch_check('SkipsUnchangedRunnersWithoutTouchingThem') do
+  before = batch_mtimes
+  sleep 1.1 # coarse filesystem timestamps
+  result = HuntTestRunnerGenerator.new(jobs: 2).run_batch(batch_jobs)
+  result[:generated].empty? && (batch_mtimes == before)
+end
+
+batch_check('RegeneratesWhenOptionsChange') do
+  result = HuntTestRunnerGenerator.new(jobs: 1, cmdline_args: true).run_batch(batch_jobs)
+  (result[:generated].size == BATCH_FILES.size) && File.read(batch_jobs.first.last).include?('HuntParseOptions')
+end
+
+batch_check('RegeneratesOnlyWhenTestFileChanges') do
+  copy = BATCH_DIR + 'testCopy.c'
+  FileUtils.cp(BATCH_FILES.first, copy)
+  jobs = [[copy, BATCH_DIR + 'testCopy_Runner.c']]
+  HuntTestRunnerGenerator.new.run_batch(jobs)
+  untouched = HuntTestRunnerGenerator.new.run_batch(jobs)
+  File.open(copy, 'a') { |f| f << "\nvoid test_AddedLater(void)\n{\n}\n" }
+  changed = HuntTestRunnerGenerator.new.run_batch(jobs)
+  untouched[:generated].empty? && (changed[:generated].size == 1) && File.read(jobs.first.last).include?('test_AddedLater')
+end
+
+batch_check('ReadsManifestFromCommandLine') do
+  FileUtils.rm_f(Dir[BATCH_DIR + '*_Runner.c'])
+  File.open(BATCH_DIR + 'manifest.txt', 'w') do |f|
+    f.puts('# test files for this build')
+    f.puts(BATCH_FILES[0])
+    f.puts("#{BATCH_FILES[1]} #{BATCH_DIR}renamed_Runner.c")
+  end
+  `ruby ../auto/generate_test_runner.rb --manifest=#{BATCH_DIR}manifest.txt --output_dir=#{BATCH_DIR} -batch #{BATCH_FILES[2]}`
+  [batch_jobs[0].last, "#{BATCH_DIR}renamed_Runner.c", batch_jobs[2].last].all? { |f| File.exist?(f) }
+end
+
+batch_check('AggregatesTestFilesIntoOneBinary') do
+  load_configuration($cfg_file)
+  files = ['testdata/testAggregateFirst.c', 'testdata/testAggregateSecond.c']
+  jobs = files.map { |f| [f, HuntTestRunnerGenerator.default_runner_name(f, BATCH_DIR)] }
+  HuntTestRunnerGenerator.new.run_aggregate(jobs, BATCH_DIR + 'all_tests_Runner.c')
+
+  # each file gets its own setUp/tearDown names so they can share a binary
+  obj_list = jobs.flat_map do |test, runner|
+    base = File.basename(test, C_EXTENSION)
+    defines = ['TEST', "setUp=#{base}_setUp", "tearDown=#{base}_tearDown"]
+    [compile(test, defines), compile(runner, defines)]
+  end
+  obj_list << compile(BATCH_DIR + 'all_tests_Runner.c', ['TEST'])
+  obj_list << compile('../src/hunt.c', ['TEST'])
+  link_it('all_tests', obj_list)
+  output = execute($cfg['linker']['bin_files']['destination'] + 'all_tests' + $cfg['linker']['bin_files']['extension'], true)
+
+  %w[test_FirstFileRunsItsOwnSetup:PASS test_FirstFileCountsEachSetup:PASS
+     test_SecondFileRunsItsOwnSetup:PASS test_SecondFileFails:FAIL test_SecondFileIgnores:IGNORE].all? { |r| output.include?(r) } &&
+    output.include?('5 Tests 1 Failures 1 Ignored') && (output.scan('Tests ').length == 1) && ($?.exitstatus == 1)
+end
+
+raise "There were #{$generate_batch_failures} failures while testing batch runner generation" if $generate_batch_failures > 0
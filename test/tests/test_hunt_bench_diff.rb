@@ -0,0 +1,54 @@
+# ==========================================
+#   Hunt Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+
+require '../auto/hunt_bench_diff.rb'
+require 'fileutils'
+
+$bench_diff_failures = 0
+
+BENCH_DIFF_DIR = 'build/bench_diff/'
+
+def bench_diff_check(name)
+  should "BenchDiff_#{name}" do
+    if yield
+      report "BenchDiff_#{name}:PASS"
+    else
+      report "BenchDiff_#{name}:FAIL"
+      $bench_diff_failures += 1
+    end
+  end
+end
+
+FileUtils.mkdir_p(BENCH_DIFF_DIR)
+File.write(BENCH_DIFF_DIR + 'before.txt', "t.c:test_Steady 5.00 5.01 5.02 5.00 5.01\n" \
+                                          "t.c:test_Regressed 10.00 10.10 9.90 10.05 9.95\n" \
+                                          "t.c:test_Improved 8.00 8.10 7.90 8.05 7.95\n" \
+                                          "t.c:test_Removed 1.00\n")
+File.write(BENCH_DIFF_DIR + 'after.txt', "t.c:test_Steady 5.00 5.02 5.01 5.00 5.01\n" \
+                                         "t.c:test_Regressed 12.00 12.10 11.90 12.05 11.95\n" \
+                                         "t.c:test_Improved 4.00 4.10 3.90 4.05 3.95\n" \
+                                         "t.c:test_Added 2.00\n")
+
+bench_diff_check('FindsExactMannWhitneyProbability') do
+  (HuntBenchDiff.p_slower([2, 3, 4, 5, 6], [1, 1, 1, 1, 1]) - (1.0 / 252)).abs < 1e-12 &&
+    (HuntBenchDiff.p_slower([1] * 5, [1] * 5) == 0.5)
+end
+
+bench_diff_check('ReportsSignificantChangesBeyondThreshold') do
+  diff = HuntBenchDiff.new(5.0)
+  table = diff.run(BENCH_DIFF_DIR + 'before.txt', BENCH_DIFF_DIR + 'after.txt')
+  (diff.slower == ['t.c:test_Regressed']) && (diff.faster == ['t.c:test_Improved']) &&
+    table.include?('+20.0% SLOWER') && table.include?('-50.0% faster') &&
+    table =~ /test_Removed\s+1.00 ns\s+-/ && table =~ /test_Added\s+-\s+2.00 ns/
+end
+
+bench_diff_check('IgnoresChangesWithinThreshold') do
+  diff = HuntBenchDiff.new(25.0)
+  diff.run(BENCH_DIFF_DIR + 'before.txt', BENCH_DIFF_DIR + 'after.txt')
+  diff.slower.empty? && (diff.faster == ['t.c:test_Improved'])
+end
+
+raise "There were #{$bench_diff_failures} failures while testing hunt_bench_diff.rb" if $bench_diff_failures > 0
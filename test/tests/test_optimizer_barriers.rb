@@ -0,0 +1,47 @@
+# ==========================================
+#   Hunt Project - A Test Framework for C
+#   Copyright (c) 2007 Mike Karlesky, Mark VanderVoord, Greg Williams
+#   [Released under MIT License. Please refer to license.txt for details]
+# ==========================================
+
+$barrier_failures = 0
+
+BARRIER_SOURCE = 'testdata/testOptimizerBarriers.c'.freeze
+MULTIPLY_KEPT = /2654435761|-1640531535/
+STORE_KEPT = /625341585/
+
+# Compiles the barrier test file to optimized assembly, as a benchmark would be built
+def barrier_assembly(defines)
+  compiler = build_compiler_fields(defines)
+  options = compiler[:options].sub(/(^| )-c( |$)/, ' ')
+  output = $cfg['compiler']['build_path'] + 'testOptimizerBarriers' + (defines.empty? ? '' : '_without') + '.s'
+  execute("#{compiler[:command]}#{compiler[:defines]}#{options} -S -O3#{compiler[:includes]} #{BARRIER_SOURCE} -o #{output}")
+  File.read(output)
+end
+
+def barrier_check(name)
+  should "OptimizerBarriers_#{name}" do
+    if yield
+      report "OptimizerBarriers_#{name}:PASS"
+    else
+      report "OptimizerBarriers_#{name}:FAIL"
+      $barrier_failures += 1
+    end
+  end
+end
+
+# Only GCC and clang can be told to write assembly the same way
+if $cfg['compiler']['path'].to_s =~ /gcc|clang/
+  with_barriers = barrier_assembly([])
+  without_barriers = barrier_assembly(['WITHOUT_BARRIERS'])
+
+  barrier_check('DoNotOptimizeKeepsUnusedResult') do
+    (with_barriers =~ MULTIPLY_KEPT) && (without_barriers !~ MULTIPLY_KEPT)
+  end
+
+  barrier_check('ClobberMemoryKeepsDeadStore') do
+    (with_barriers =~ STORE_KEPT) && (without_barriers !~ STORE_KEPT)
+  end
+end
+
+raise "There were #{$barrier_failures} failures while testing the optimizer barriers" if $barrier_failures > 0
@@ -5663,7 +5663,7 @@ void testIgnoredAndThenFailInTearDown(void)
 
 #ifdef USING_OUTPUT_SPY
 #include <stdio.h>
-#define SPY_BUFFER_MAX 40
+#define SPY_BUFFER_MAX 128
 static char putcharSpyBuffer[SPY_BUFFER_MAX];
 #endif
 static int indexSpyBuffer;
@@ -5732,6 +5732,568 @@ void testFailureCountIncrementsAndIsReturnedAtEnd(void)
     TEST_ASSERT_EQUAL(savedFailures + 1, failures);
 }
 
+void testAggregatedRunCombinesCountsOfEachTestFile(void)
+{
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+    int firstFailures, secondFailures, totalFailures;
+    HUNT_UINT totalTests, totalIgnores;
+
+    startPutcharSpy(); // Suppress output
+    HuntAggregateBegin();
+    HuntBegin("first.c");
+    Hunt.NumberOfTests += 2;
+    Hunt.TestFailures += 1;
+    firstFailures = HuntEnd();
+    HuntBegin("second.c");
+    Hunt.NumberOfTests += 3;
+    Hunt.TestFailures += 2;
+    Hunt.TestIgnores += 1;
+    secondFailures = HuntEnd();
+    totalFailures = HuntAggregateEnd();
+    totalTests = Hunt.NumberOfTests;
+    totalIgnores = Hunt.TestIgnores;
+    endPutcharSpy();
+    Hunt = savedHunt;
+
+    TEST_ASSERT_EQUAL(1, firstFailures);
+    TEST_ASSERT_EQUAL(2, secondFailures);
+    TEST_ASSERT_EQUAL(3, totalFailures);
+    TEST_ASSERT_EQUAL(5, totalTests);
+    TEST_ASSERT_EQUAL(1, totalIgnores);
+}
+
+typedef struct
+{
+    const char* name;
+    int in;
+    int out;
+} SquareCase;
+
+static const SquareCase squareCases[] = { {"one", 1, 1}, {"two", 2, 4}, {"three", 3, 10}, {"four", 4, 17} };
+static int squareCasesRun;
+
+static const char* squareCaseName(const SquareCase* c)
+{
+    return c->name;
+}
+
+TEST_PARAMS(paramsSquare, SquareCase, squareCases)
+{
+    squareCasesRun++;
+    TEST_ASSERT_EQUAL_INT(param->out, param->in * param->in);
+}
+
+TEST_PARAMS_NAMED(paramsSquareNamed, SquareCase, squareCases, squareCaseName)
+{
+    squareCasesRun++;
+    TEST_ASSERT_EQUAL_INT(param->out, param->in * param->in);
+}
+
+TEST_PARAMS(paramsSquareIgnored, SquareCase, squareCases)
+{
+    squareCasesRun += param->in;
+    TEST_IGNORE();
+}
+
+void testParamsRunEveryEntryAndReportFailingOnes(void)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(HUNT_INCLUDE_PARAMS)
+    TEST_IGNORE();
+#else
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+    HUNT_COUNTER_TYPE failed, ignored;
+
+    squareCasesRun = 0;
+    Hunt.TestFile = "p.c";
+    Hunt.CurrentTestName = "p";
+    startPutcharSpy();
+    paramsSquare();
+    endPutcharSpy();
+    failed = Hunt.CurrentTestFailed;
+    ignored = Hunt.CurrentTestIgnored;
+    Hunt = savedHunt;
+
+    TEST_ASSERT_EQUAL(4, squareCasesRun);
+    TEST_ASSERT_EQUAL(1, failed);
+    TEST_ASSERT_EQUAL(0, ignored);
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), ":p[2]:FAIL:"));
+#endif
+}
+
+void testParamsNameFailingEntriesWithTheirLabel(void)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(HUNT_INCLUDE_PARAMS)
+    TEST_IGNORE();
+#else
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+
+    squareCasesRun = 0;
+    Hunt.TestFile = "p.c";
+    Hunt.CurrentTestName = "p";
+    startPutcharSpy();
+    paramsSquareNamed();
+    endPutcharSpy();
+    Hunt = savedHunt;
+
+    TEST_ASSERT_EQUAL(4, squareCasesRun);
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), ":p[three]:FAIL:"));
+#endif
+}
+
+void testParamsIgnoreTheTestWhenEveryEntryIsIgnored(void)
+{
+#ifndef HUNT_INCLUDE_PARAMS
+    TEST_IGNORE();
+#else
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+    HUNT_COUNTER_TYPE failed, ignored;
+
+    squareCasesRun = 0;
+    startPutcharSpy();
+    paramsSquareIgnored();
+    endPutcharSpy();
+    failed = Hunt.CurrentTestFailed;
+    ignored = Hunt.CurrentTestIgnored;
+    Hunt = savedHunt;
+
+    TEST_ASSERT_EQUAL(1 + 2 + 3 + 4, squareCasesRun);
+    TEST_ASSERT_EQUAL(0, failed);
+    TEST_ASSERT_EQUAL(1, ignored);
+#endif
+}
+
+void testParamsCountAsOneTest(void)
+{
+#ifndef HUNT_INCLUDE_PARAMS
+    TEST_IGNORE();
+#else
+    HUNT_COUNTER_TYPE tests = Hunt.NumberOfTests;
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+
+    startPutcharSpy();
+    paramsSquare();
+    endPutcharSpy();
+    Hunt = savedHunt;
+
+    TEST_ASSERT_EQUAL(tests, Hunt.NumberOfTests);
+#endif
+}
+
+static const HUNT_INT comboWidths[] = { 8, 16, 32 };
+static const HuntAxis comboAxes[] = { HUNT_AXIS_RANGE(0, 128, 64), HUNT_AXIS_VALUES(comboWidths), HUNT_AXIS_RANGE(-1, 1, 1) };
+static const HuntAxis comboEmptyAxes[] = { HUNT_AXIS_RANGE(0, 128, 64), { NULL, 0, 1, 0 } };
+static const HuntAxis comboPairAxes[] = { HUNT_AXIS_RANGE(0, 3, 1), HUNT_AXIS_RANGE(0, 3, 1), HUNT_AXIS_RANGE(0, 3, 1),
+                                          HUNT_AXIS_RANGE(0, 3, 1), HUNT_AXIS_RANGE(0, 2, 1) };
+static const HuntAxis comboHugeAxes[] = { HUNT_AXIS_RANGE(0, 99, 1), HUNT_AXIS_RANGE(0, 99, 1), HUNT_AXIS_RANGE(0, 99, 1) };
+static int comboSum;
+static int comboRun;
+static int comboPairsSeen[5][4][5][4];
+
+TEST_COMBINATIONS(comboCartesian, comboAxes, HUNT_CARTESIAN)
+{
+    comboRun++;
+    comboSum += (int)(param[0] + param[1] + param[2]);
+    TEST_ASSERT_FALSE((param[0] == 64) && (param[2] == -1));
+}
+
+TEST_COMBINATIONS(comboNothing, comboEmptyAxes, HUNT_CARTESIAN)
+{
+    comboRun++;
+    (void)param;
+}
+
+TEST_COMBINATIONS(comboTooManyPairs, comboHugeAxes, HUNT_PAIRWISE)
+{
+    comboRun++;
+    (void)param;
+}
+
+TEST_COMBINATIONS(comboPairwise, comboPairAxes, HUNT_PAIRWISE)
+{
+    int a, b;
+    comboRun++;
+    for (a = 0; a < 5; a++)
+        for (b = 0; b < 5; b++)
+            comboPairsSeen[a][param[a]][b][param[b]] = 1;
+}
+
+void testCombinationsRunEveryCombinationOfRangesAndValues(void)
+{
+#if !defined(USING_OUTPUT_SPY) || !defined(HUNT_INCLUDE_PARAMS)
+    TEST_IGNORE();
+#else
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+    HUNT_COUNTER_TYPE failed;
+
+    comboRun = 0;
+    comboSum = 0;
+    Hunt.TestFile = "c.c";
+    Hunt.CurrentTestName = "c";
+    startPutcharSpy();
+    comboCartesian();
+    endPutcharSpy();
+    failed = Hunt.CurrentTestFailed;
+    Hunt = savedHunt;
+
+    TEST_ASSERT_EQUAL(3 * 3 * 3, comboRun);
+    TEST_ASSERT_EQUAL((9 * (0 + 64 + 128)) + (9 * (8 + 16 + 32)) + (9 * (-1 + 0 + 1)), comboSum);
+    TEST_ASSERT_EQUAL(1, failed);
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), ":c[64,8,-1]:FAIL:"));
+#endif
+}
+
+void testCombinationsOfAnEmptyAxisAreIgnored(void)
+{
+#ifndef HUNT_INCLUDE_PARAMS
+    TEST_IGNORE();
+#else
+    comboRun = 0;
+    EXPECT_ABORT_BEGIN
+    comboNothing();
+    VERIFY_IGNORES_END
+    TEST_ASSERT_EQUAL(0, comboRun);
+#endif
+}
+
+void testCombinationsWithTooManyPairsFail(void)
+{
+#ifndef HUNT_INCLUDE_PARAMS
+    TEST_IGNORE();
+#else
+    comboRun = 0;
+    EXPECT_ABORT_BEGIN
+    comboTooManyPairs();
+    VERIFY_FAILS_END
+    TEST_ASSERT_EQUAL(0, comboRun);
+#endif
+}
+
+void testCombinationsPairwiseCoverEveryPairInFewerCases(void)
+{
+#ifndef HUNT_INCLUDE_PARAMS
+    TEST_IGNORE();
+#else
+    int a, b, va, vb;
+
+    comboRun = 0;
+    memset(comboPairsSeen, 0, sizeof(comboPairsSeen));
+    comboPairwise();
+
+    TEST_ASSERT_LESS_THAN(4 * 4 * 4 * 4 * 3, comboRun);
+    TEST_ASSERT_GREATER_OR_EQUAL(4 * 4, comboRun);
+    for (a = 0; a < 5; a++)
+        for (b = 0; b < 5; b++)
+            for (va = 0; va < (int)comboPairAxes[a].Count; va++)
+                for (vb = 0; vb < (int)comboPairAxes[b].Count; vb++)
+                    if (a != b)
+                        TEST_ASSERT_EQUAL(1, comboPairsSeen[a][va][b][vb]);
+#endif
+}
+
+static HUNT_UINT benchIterations;
+
+TEST_BENCHMARK(benchCountIterations)
+{
+    HUNT_BENCH_LOOP(state)
+    {
+        benchIterations++;
+    }
+}
+
+TEST_BENCHMARK(benchWithoutLoop)
+{
+    (void)state;
+}
+
+TEST_BENCHMARK_AB_FASTER(benchHundredPercentFaster, benchWithoutLoop_bench, benchWithoutLoop_bench, 100);
+
+void testBenchSummarizeFindsMedianMinimumAndDeviation(void)
+{
+#ifndef HUNT_INCLUDE_BENCHMARK
+    TEST_IGNORE();
+#else
+    HUNT_UINT odd[] = { 50, 10, 40, 20, 30 };
+    HUNT_UINT even[] = { 100, 20, 10, 30 };
+    HuntBenchResult result;
+
+    HuntBenchSummarize(odd, 5, &result);
+    TEST_ASSERT_EQUAL_UINT(5, result.Repetitions);
+    TEST_ASSERT_EQUAL_UINT(30, result.Median);
+    TEST_ASSERT_EQUAL_UINT(10, result.Min);
+    TEST_ASSERT_EQUAL_UINT(10, result.Mad);
+
+    HuntBenchSummarize(even, 4, &result);
+    TEST_ASSERT_EQUAL_UINT(25, result.Median);
+    TEST_ASSERT_EQUAL_UINT(10, result.Min);
+    TEST_ASSERT_EQUAL_UINT(10, result.Mad);
+#endif
+}
+
+void testBenchSummarizeEstimatesNoise(void)
+{
+#ifndef HUNT_INCLUDE_BENCHMARK
+    TEST_IGNORE();
+#else
+    HUNT_UINT steady[] = { 100, 100, 100, 100 };
+    HUNT_UINT noisy[] = { 90, 110, 90, 110 };
+    HuntBenchResult result;
+
+    HuntBenchSummarize(steady, 4, &result);
+    TEST_ASSERT_EQUAL_UINT(0, result.Cv);
+
+    HuntBenchSummarize(noisy, 4, &result);
+#ifdef HUNT_EXCLUDE_FLOAT
+    TEST_ASSERT_EQUAL_UINT(1250, result.Cv); /* 5/4 of the mean absolute deviation */
+#else
+    TEST_ASSERT_UINT_WITHIN(1, 1155, result.Cv); /* sqrt(400 / 3) / 100 */
+#endif
+#endif
+}
+
+void testBenchMedianIntervalHoldsTheConfidenceLevel(void)
+{
+#if !defined(HUNT_INCLUDE_BENCHMARK) || (HUNT_BENCH_ALPHA_PERCENT != 5)
+    TEST_IGNORE();
+#else
+    /* 15 pairs: 3 or fewer below the median has a probability of 1.8%, 4 or fewer of 5.9% */
+    TEST_ASSERT_EQUAL_UINT(3, HuntBenchMedianInterval(15));
+    /* 6 pairs: none below the median has a probability of 1.6%, one or fewer of 10.9% */
+    TEST_ASSERT_EQUAL_UINT(0, HuntBenchMedianInterval(6));
+    TEST_ASSERT_EQUAL_UINT(0, HuntBenchMedianInterval(5));
+#endif
+}
+
+void testBigOFitFindsTheComplexityOfTimes(void)
+{
+#if !defined(HUNT_INCLUDE_BENCHMARK) || defined(HUNT_EXCLUDE_FLOAT)
+    TEST_IGNORE();
+#else
+    HUNT_UINT sizes[] = { 16, 64, 256, 1024, 4096 };
+    HUNT_FLOAT constant[] = { 7.0f, 7.2f, 6.9f, 7.1f, 7.0f };
+    HUNT_FLOAT logarithmic[] = { 4.0f, 6.0f, 8.0f, 10.0f, 12.0f };
+    HUNT_FLOAT linear[] = { 32.0f, 128.0f, 512.0f, 2048.0f, 8192.0f };
+    HUNT_FLOAT linearithmic[] = { 64.0f, 384.0f, 2048.0f, 10240.0f, 49152.0f };
+    HUNT_FLOAT quadratic[] = { 256.0f, 4096.0f, 65536.0f, 1048576.0f, 16777216.0f };
+    HUNT_FLOAT rms;
+    HUNT_BIG_O_T bigO;
+
+    bigO = HuntBigOFit(sizes, constant, 5, &rms);
+    TEST_ASSERT_EQUAL_INT(HUNT_BIG_O_1, bigO);
+    TEST_ASSERT_TRUE(rms < 0.05f);
+    bigO = HuntBigOFit(sizes, logarithmic, 5, &rms);
+    TEST_ASSERT_EQUAL_INT(HUNT_BIG_O_LOG_N, bigO);
+    bigO = HuntBigOFit(sizes, linear, 5, &rms);
+    TEST_ASSERT_EQUAL_INT(HUNT_BIG_O_N, bigO);
+    TEST_ASSERT_TRUE(rms < 0.001f);
+    bigO = HuntBigOFit(sizes, linearithmic, 5, &rms);
+    TEST_ASSERT_EQUAL_INT(HUNT_BIG_O_N_LOG_N, bigO);
+    bigO = HuntBigOFit(sizes, quadratic, 5, &rms);
+    TEST_ASSERT_EQUAL_INT(HUNT_BIG_O_N_SQUARED, bigO);
+#endif
+}
+
+void testBenchmarkCalibratesAndReportsItsLoop(void)
+{
+#if !defined(HUNT_INCLUDE_BENCHMARK) || !defined(USING_OUTPUT_SPY)
+    TEST_IGNORE();
+#else
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+
+    benchIterations = 0;
+    Hunt.TestFile = "b.c";
+    Hunt.CurrentTestName = "b";
+    startPutcharSpy();
+    benchCountIterations();
+    endPutcharSpy();
+    Hunt = savedHunt;
+
+    TEST_ASSERT_GREATER_THAN_UINT(HUNT_BENCH_REPETITIONS * 2, benchIterations);
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), ":b:BENCH: median "));
+#endif
+}
+
+void testBenchmarkWithoutLoopFails(void)
+{
+#ifndef HUNT_INCLUDE_BENCHMARK
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    benchWithoutLoop();
+    VERIFY_FAILS_END
+#endif
+}
+
+void testBenchmarkABCannotBeHundredPercentFaster(void)
+{
+#ifndef HUNT_INCLUDE_BENCHMARK
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    benchHundredPercentFaster();
+    VERIFY_FAILS_END
+#endif
+}
+
+void testBenchmarksAreIgnoredWhenDisabled(void)
+{
+#ifdef HUNT_INCLUDE_BENCHMARK
+    TEST_IGNORE();
+#else
+    EXPECT_ABORT_BEGIN
+    benchCountIterations();
+    VERIFY_IGNORES_END
+#endif
+}
+
+static HuntHistogram latencies;
+
+void testHistogramFindsPercentiles(void)
+{
+    HUNT_UINT i;
+
+    HuntHistogramReset(&latencies);
+    for (i = 1; i <= 1000; i++)
+    {
+        HuntHistogramRecord(&latencies, i);
+    }
+    TEST_ASSERT_EQUAL_UINT(1000, latencies.Total);
+    TEST_ASSERT_EQUAL_UINT(1, latencies.Min);
+    TEST_ASSERT_EQUAL_UINT(1000, latencies.Max);
+
+    /* each value is counted to within 1/32 of itself, and reported as the top of its bucket */
+    TEST_ASSERT_UINT_WITHIN(16, 500, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(50)));
+    TEST_ASSERT_UINT_WITHIN(28, 900, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(90)));
+    TEST_ASSERT_UINT_WITHIN(31, 990, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(99)));
+    TEST_ASSERT_EQUAL_UINT(1000, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(99.9)));
+    TEST_ASSERT_EQUAL_UINT(1000, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(100)));
+    TEST_ASSERT_EQUAL_UINT(1, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(0)));
+}
+
+void testHistogramCountsSmallValuesExactly(void)
+{
+    HUNT_UINT i;
+
+    HuntHistogramReset(&latencies);
+    for (i = 0; i < 60; i++)
+    {
+        HuntHistogramRecord(&latencies, i % 10);
+    }
+    TEST_ASSERT_EQUAL_UINT(4, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(50)));
+    TEST_ASSERT_EQUAL_UINT(8, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(90)));
+    TEST_ASSERT_EQUAL_UINT(9, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(99.9)));
+}
+
+void testHistogramHoldsTheLargestValues(void)
+{
+    HuntHistogramReset(&latencies);
+    HuntHistogramRecord(&latencies, (HUNT_UINT)-1);
+    HuntHistogramRecord(&latencies, (HUNT_UINT)-1 / 3);
+    TEST_ASSERT_EQUAL_UINT((HUNT_UINT)-1, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(99)));
+    TEST_ASSERT_UINT_WITHIN((HUNT_UINT)-1 / 96, (HUNT_UINT)-1 / 3, HuntHistogramPercentile(&latencies, HUNT_PERCENTILE(50)));
+}
+
+void testPercentileBelowPasses(void)
+{
+    HUNT_UINT i;
+
+    HuntHistogramReset(&latencies);
+    for (i = 0; i < 999; i++)
+    {
+        HuntHistogramRecord(&latencies, 100);
+    }
+    HuntHistogramRecord(&latencies, 100000);
+    TEST_ASSERT_PERCENTILE_BELOW(&latencies, 99.9, 110);
+    TEST_ASSERT_PERCENTILE_BELOW_MESSAGE(&latencies, 50, 110, "Median is fast");
+}
+
+void testPercentileBelowFailsInTheTail(void)
+{
+    HUNT_UINT i;
+
+    HuntHistogramReset(&latencies);
+    for (i = 0; i < 990; i++)
+    {
+        HuntHistogramRecord(&latencies, 100);
+    }
+    for (i = 0; i < 10; i++)
+    {
+        HuntHistogramRecord(&latencies, 100000);
+    }
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_PERCENTILE_BELOW(&latencies, 99.9, 1000);
+    VERIFY_FAILS_END
+}
+
+void testPercentileBelowFailsWithoutSamples(void)
+{
+    HuntHistogramReset(&latencies);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_PERCENTILE_BELOW(&latencies, 50, 1000);
+    VERIFY_FAILS_END
+}
+
+void testPercentileFailureNamesThePercentile(void)
+{
+#ifndef USING_OUTPUT_SPY
+    TEST_IGNORE();
+#else
+    HuntHistogramReset(&latencies);
+    HuntHistogramRecord(&latencies, 20);
+
+    EXPECT_ABORT_BEGIN
+    TEST_ASSERT_PERCENTILE_BELOW(&latencies, 99.99, 10);
+    VERIFY_FAILS_END
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(), ":FAIL: Expected p99.99 Below 10 ns Was 20 ns"));
+#endif
+}
+
+void testHistogramIsPrinted(void)
+{
+#ifndef USING_OUTPUT_SPY
+    TEST_IGNORE();
+#else
+    struct HUNT_STORAGE_T savedHunt = Hunt;
+    HUNT_UINT i;
+
+    HuntHistogramReset(&latencies);
+    for (i = 1; i <= 10; i++)
+    {
+        HuntHistogramRecord(&latencies, i * 10);
+    }
+    Hunt.TestFile = "h.c";
+    Hunt.CurrentTestName = "h";
+    startPutcharSpy();
+    TEST_PRINT_HISTOGRAM(&latencies);
+    endPutcharSpy();
+    Hunt = savedHunt;
+
+    TEST_ASSERT_NOT_NULL(strstr(getBufferPutcharSpy(),
+        ":h:HIST: count 10, p50 50 ns, p90 91 ns, p99 100 ns, p99.9 100 ns, max 100 ns"));
+#endif
+}
+
+#define TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(expected, elapsed) {         \
+        startPutcharSpy(); HuntPrintExecTime((elapsed)); endPutcharSpy(); \
+        TEST_ASSERT_EQUAL_STRING((expected), getBufferPutcharSpy());      \
+        }
+
+void testExecTimeIsPrintedInAdaptiveUnits(void)
+{
+#if !defined(USING_OUTPUT_SPY) || defined(HUNT_USE_EXEC_TIME_NS) || defined(HUNT_INCLUDE_PHASE_TIMES) || \
+    !defined(HUNT_USE_DURATIONS)
+    TEST_IGNORE(); /* calibrated clock overhead would be taken off */
+#else
+    TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(" (0 ns)", 0);
+    TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(" (999 ns)", 999);
+    TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(" (1.23 us)", 1234);
+    TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(" (999.50 us)", 999499);
+    TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(" (12.35 ms)", 12345678);
+    TEST_ASSERT_EQUAL_PRINT_EXEC_TIME(" (2.50 s)", 2500000000u);
+#endif
+}
+
 void testCstringsEscapeSequence(void)
 {
 #ifndef USING_OUTPUT_SPY
@@ -172,3 +172,31 @@ void test_CharsArePreserved(unsigned index, char c)
 
 
 
+
+typedef struct
+{
+    unsigned in;
+    unsigned out;
+} DoubleCase;
+
+static const DoubleCase DoubleCases[] = { {0, 0}, {1, 2}, {50, 100}, {99, 198} };
+static unsigned DoubleCasesRun;
+
+TEST_PARAMS(test_TablesRunEveryEntry, DoubleCase, DoubleCases)
+{
+    TEST_ASSERT_EQUAL_UINT(param->out, param->in * 2);
+    DoubleCasesRun++;
+}
+
+void test_TablesRunAsOneTest(void)
+{
+    TEST_ASSERT_EQUAL_UINT(sizeof(DoubleCases) / sizeof(DoubleCases[0]), DoubleCasesRun);
+}
+
+static const HUNT_INT ShiftWidths[] = { 8, 16, 32 };
+static const HuntAxis ShiftAxes[] = { HUNT_AXIS_RANGE(0, 7, 1), HUNT_AXIS_VALUES(ShiftWidths) };
+
+TEST_COMBINATIONS(test_CombinationsRunEveryCombination, ShiftAxes, HUNT_CARTESIAN)
+{
+    TEST_ASSERT_LESS_THAN(param[1], param[0]);
+}